@@ -13,6 +13,7 @@
 #include <cmath>
 #include <iomanip>
 #include <cstring>
+#include <algorithm>
 
 #include "Accuracy_Atm.h"
 #include "Utils.h"
@@ -81,7 +82,7 @@ Accuracy_Atm::residuumQuery_2D ( Array_1D &rad, Array_1D &the, Array &v, Array &
 
 std::tuple<double, int, int, int>
 Accuracy_Atm::residuumQuery_3D ( Array_1D &rad, Array_1D &the, Array &u, Array &v, Array &w, 
-                                        Vector3D<> &residuum_3d )
+                                        Vector3D<> *residuum_3d )
 {
     assert(is_3d_flag);
     // value of the residuum ( div c = 0 ) for the computation of the continuity equation ( min )
@@ -99,9 +100,9 @@ Accuracy_Atm::residuumQuery_3D ( Array_1D &rad, Array_1D &the, Array &u, Array &
                 double dvdthe = ( v.x[ i ][ j+1 ][ k ] - v.x[ i ][ j-1 ][ k ] ) / ( 2. * dthe );
                 double dwdphi = ( w.x[ i ][ j ][ k+1 ] - w.x[ i ][ j ][ k-1 ] ) / ( 2. * dphi );
 
-                double &residuum = residuum_3d(i,j,k) = dudr + 2. * u.x[ i ][ j ][ k ] / rad.z[ i ] + dvdthe / rad.z[ i ]
+                double residuum = dudr + 2. * u.x[ i ][ j ][ k ] / rad.z[ i ] + dvdthe / rad.z[ i ]
                             + costhe / rmsinthe * v.x[ i ][ j ][ k ] + dwdphi / rmsinthe;
-                //logger() << residuum_3d(i,j,k) << "  " << residuum << "  residuum" << std::endl;
+                if ( residuum_3d )  ( *residuum_3d )(i,j,k) = residuum;
                 if ( fabs ( residuum ) > min )
                 {
                     min = residuum;
@@ -115,7 +116,7 @@ Accuracy_Atm::residuumQuery_3D ( Array_1D &rad, Array_1D &the, Array &u, Array &
     return std::tuple<double, int, int, int>(min, i_res, j_res, k_res);
 }
 
-void Accuracy_Atm::steadyQuery_2D ( Array &v, Array &vn, Array &w, Array &wn, Array &p_dyn, Array &p_dynn )
+double Accuracy_Atm::steadyQuery_2D ( Array &v, Array &vn, Array &w, Array &wn, Array &p_dyn, Array &p_dynn )
 {
     // state of a steady solution ( min )
     double min_v = 0., min_w = 0., min_p = 0., tmp = 0.;
@@ -154,12 +155,12 @@ void Accuracy_Atm::steadyQuery_2D ( Array &v, Array &vn, Array &w, Array &wn, Ar
 
 
     // statements on the convergence und iterational process
-    cout.precision ( 6 );
-    cout.setf ( ios::fixed );
+    get_output().precision ( 6 );
+    get_output().setf ( ios::fixed );
 
     // printout of maximum and minimum absolute and relative errors of the computed values at their locations while iterating
 
-    cout << endl << endl << 
+    get_output() << endl << endl << 
         " 2D iterational process for the surface boundary conditions\n printout of maximum and minimum absolute and " <<
         "relative errors of the computed values at their locations: level, latitude, longitude"
          << endl << endl;
@@ -173,7 +174,7 @@ void Accuracy_Atm::steadyQuery_2D ( Array &v, Array &vn, Array &w, Array &wn, Ar
 
     print( " dw: Navier Stokes equation ", min_w, j_w, k_w);
 
-    return;
+    return std::max ( { min_v, min_w, min_p } );
 }
 
 
@@ -181,7 +182,7 @@ void Accuracy_Atm::print(const string& name, double value, int j, int k) const{
 
     AtomUtils::HemisphereCoords coords = AtomUtils::convert_coords(k, j);
 
-    cout << setiosflags ( ios::left ) << setw ( 36 ) << setfill ( '.' ) << name << " = " << resetiosflags ( ios::left ) << 
+    get_output() << setiosflags ( ios::left ) << setw ( 36 ) << setfill ( '.' ) << name << " = " << resetiosflags ( ios::left ) << 
         setw ( 12 ) << fixed << setfill ( ' ' ) << value << setw ( 5 ) << int(coords.lat) << setw ( 3 ) << coords.north_or_south 
         << setw ( 4 ) << int(coords.lon) << setw ( 3 ) << coords.east_or_west << endl;
 }
@@ -189,7 +190,7 @@ void Accuracy_Atm::print(const string& name, double value, int j, int k) const{
 
 
 
-void Accuracy_Atm::steadyQuery_3D ( Array &u, Array &un, Array &v, Array &vn, Array &w, Array &wn, Array &t, Array &tn, 
+double Accuracy_Atm::steadyQuery_3D ( Array &u, Array &un, Array &v, Array &vn, Array &w, Array &wn, Array &t, Array &tn, 
     Array &c, Array &cn, Array &cloud, Array &cloudn, Array &ice, Array &icen, Array &co2, Array &co2n, Array &p_dyn, 
     Array &p_dynn, double L_atm)
 {
@@ -305,12 +306,12 @@ void Accuracy_Atm::steadyQuery_3D ( Array &u, Array &un, Array &v, Array &vn, Ar
     }
 
     // statements on the convergence und iterational process
-    cout.precision ( 6 );
-    cout.setf ( ios::fixed );
+    get_output().precision ( 6 );
+    get_output().setf ( ios::fixed );
 
     // printout of maximum and minimum absolute and relative errors of the computed values at their locations while iterating
 
-    cout << endl << endl << " 3D iterational process for the surface boundary conditions\n printout of maximum and minimum " <<
+    get_output() << endl << endl << " 3D iterational process for the surface boundary conditions\n printout of maximum and minimum " <<
         "absolute and relative errors of the computed values at their locations: level, latitude, longitude" << endl;
     
     print(" residuum: continuity equation ", min, i_res * int ( L_atm ) / ( im - 1 ), j_res, k_res);
@@ -333,14 +334,19 @@ void Accuracy_Atm::steadyQuery_3D ( Array &u, Array &un, Array &v, Array &vn, Ar
 
     print(" dco: CO2 transport equation ", min_co2, i_co2 * int ( L_atm ) / ( im - 1 ), j_co2, k_co2);
 
-    return;
+    changes = { { "p_dyn", min_p, i_p, j_p, k_p }, { "u", min_u, i_u, j_u, k_u }, { "v", min_v, i_v, j_v, k_v }, 
+                { "w", min_w, i_w, j_w, k_w }, { "t", min_t, i_t, j_t, k_t }, { "c", min_c, i_c, j_c, k_c }, 
+                { "cloud", min_cloud, i_cloud, j_cloud, k_cloud }, { "ice", min_ice, i_ice, j_ice, k_ice }, 
+                { "co2", min_co2, i_co2, j_co2, k_co2 } };
+
+    return std::max ( { min_u, min_v, min_w, min_t, min_c, min_cloud, min_ice, min_co2, min_p } );
 }
 
 void Accuracy_Atm::print(const string& name, double value, int i, int j, int k) const{
 
     AtomUtils::HemisphereCoords coords = AtomUtils::convert_coords(k, j);
 
-    cout << setiosflags ( ios::left ) << setw ( 36 ) << setfill ( '.' ) << name << " = " << resetiosflags ( ios::left ) << 
+    get_output() << setiosflags ( ios::left ) << setw ( 36 ) << setfill ( '.' ) << name << " = " << resetiosflags ( ios::left ) << 
         setw ( 12 ) << fixed << setfill ( ' ' ) << value << setw ( 5 ) << int(coords.lat) << setw ( 3 ) << coords.north_or_south 
         << setw ( 4 ) << int(coords.lon) << setw ( 3 ) << coords.east_or_west << setw ( 6 ) << i << setw ( 2 ) << "m" << endl;
 }
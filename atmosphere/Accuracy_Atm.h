@@ -8,9 +8,11 @@
  * class to surveil the accuracy of the iterations
 */
 #include <tuple>
+#include <vector>
 
 #include "Array.h"
 #include "Array_1D.h"
+#include "Telemetry.h"
 
 #ifndef _ACCURACY_
 #define _ACCURACY_
@@ -24,6 +26,7 @@ class Accuracy_Atm
         double dr, dthe, dphi;
         double min;
         bool is_3d_flag;
+        std::vector<AtomUtils::FieldChange> changes;
     public:
 
         Accuracy_Atm( int im, int jm, int km, double dthe, double dphi );
@@ -33,13 +36,15 @@ class Accuracy_Atm
 
         std::tuple<double, int, int> residuumQuery_2D ( 
             Array_1D &rad, Array_1D &the, Array &v, Array &w, Vector3D<> & residuum_2d );
+        // the residuum field is only stored when residuum_3d is given
         std::tuple<double, int, int, int> 
             residuumQuery_3D ( Array_1D &rad, Array_1D &the, Array &u, Array &v,
-            Array &w, Vector3D<> & residuum_3d );
+            Array &w, Vector3D<> *residuum_3d = NULL );
         
-        void steadyQuery_2D ( Array &v, Array &vn, Array &w, Array &wn,
+        // largest change of the flow properties between two iterations
+        double steadyQuery_2D ( Array &v, Array &vn, Array &w, Array &wn,
             Array &p_dyn, Array &p_dynn );
-        void steadyQuery_3D ( Array &u, Array &un, Array &v, Array &vn,
+        double steadyQuery_3D ( Array &u, Array &un, Array &v, Array &vn,
             Array &w, Array &wn, Array &t, Array &tn, Array &c, Array &cn,
             Array &cloud, Array &cloudn, Array &ice, Array &icen, Array &co2,
             Array &co2n, Array &p_dyn, Array &p_dynn, double L_atm);
@@ -48,6 +53,8 @@ class Accuracy_Atm
         void print(const string& name, double value, int i, int j, int k) const;
 
         double out_min (  ) const;
+        // largest change of each field and its location found by steadyQuery_3D
+        const std::vector<AtomUtils::FieldChange>& out_changes (  ) const{ return changes; }
         int out_i_res (  ) const;
         int out_j_res (  ) const;
         int out_k_res (  ) const;
@@ -17,6 +17,7 @@
 #include <algorithm> 
 
 #include "BC_Bath_Atm.h"
+#include "DatasetCache.h"
 #include "Utils.h"
 
 using namespace std;
@@ -38,25 +39,19 @@ BC_Bathymetry_Atmosphere::~BC_Bathymetry_Atmosphere(){}
 
 void BC_Bathymetry_Atmosphere::BC_MountainSurface( string &topo_filename,
                                            double L_atm, Array_2D &Topography, Array &h ){
-    cout.precision ( 8 );
-    cout.setf ( ios::fixed );
+    get_output().precision ( 8 );
+    get_output().setf ( ios::fixed );
 
     // default adjustment, h must be 0 everywhere
     h.initArray(im, jm, km, 0.);
 
-    // reading data from file Name_Bathymetry_File_Read
-    ifstream ifile(topo_filename);
-    if ( ! ifile.is_open()) {
-        std::cerr << "ERROR: could not open Name_Bathymetry_File file: " <<  topo_filename << std::endl;
-        abort();
-    }
+    // reading data through the dataset cache from the grid archive of the data set or from file Name_Bathymetry_File_Read
+    DatasetCache::Handle heights = DatasetCache::grid ( topo_filename, jm, km, "Name_Bathymetry_File" );
 
-    double lon, lat, height;
-    int j, k;
-    for (j = 0; j < jm && !ifile.eof(); j++) {
-        for (k = 0; k < km && !ifile.eof(); k++) {
-            height = -999; // in case the height is NaN
-            ifile >> lon >> lat >> height;
+    for (int j = 0; j < jm; j++) {
+        for (int k = 0; k < km; k++) {
+            double height = ( *heights )[ j * km + k ];
+            if ( std::isnan ( height ) )  height = -999; // in case the height is NaN
             if ( height < 0. ){
                 h.x[ 0 ][ j ][ k ] = Topography.y[ j ][ k ] = 0.;
             }else{
@@ -66,19 +61,8 @@ void BC_Bathymetry_Atmosphere::BC_MountainSurface( string &topo_filename,
                     h.x[ i ][ j ][ k ] = 1.;
                 }
             }
-            if(ifile.fail()){
-                ifile.clear();
-                std::string tmp;
-                std::getline(ifile, tmp);
-                logger() << "bad data in topography at: " << lon << " " << lat << " " << tmp << std::endl;
-            }
-            //logger() << lon << " " << lat << " " << h.x[ 0 ][ j ][ k ] << std::endl;            
         }
     }
-    if(j != jm || k != km ){
-        std::cerr << "wrong topography file size! aborting..."<<std::endl;
-        abort();
-    }
 
     // rewriting bathymetrical data from -180° _ 0° _ +180° coordinate system to 0°- 360°
     for ( int j = 0; j < jm; j++ ){
@@ -154,10 +138,10 @@ void BC_Bathymetry_Atmosphere::land_oceanFraction ( Array &h ){
     h_ocean = h_point_max - h_land;
     ozean_land = ( double ) h_ocean / ( double ) h_land;
 
-    cout.precision ( 3 );
+    get_output().precision ( 3 );
 
-    cout << endl;
-    cout << setiosflags ( ios::left ) << setw ( 50 ) << setfill ( '.' ) << "      total number of points at constant hight " 
+    get_output() << endl;
+    get_output() << setiosflags ( ios::left ) << setw ( 50 ) << setfill ( '.' ) << "      total number of points at constant hight " 
         << " = " << resetiosflags ( ios::left ) << setw ( 7 ) << fixed << setfill ( ' ' ) << h_point_max << endl << 
         setiosflags ( ios::left ) << setw ( 50 ) << setfill ( '.' ) << "      number of points on the ocean surface " << " = " 
         << resetiosflags ( ios::left ) << setw ( 7 ) << fixed << setfill ( ' ' ) << h_ocean << endl << setiosflags ( ios::left ) 
@@ -167,13 +151,13 @@ void BC_Bathymetry_Atmosphere::land_oceanFraction ( Array &h ){
         << endl << endl;
 
 
-    cout << setiosflags ( ios::left ) << setw ( 50 ) << setfill ( '.' ) << "      addition of CO2 by ocean surface " << " = " <<    
+    get_output() << setiosflags ( ios::left ) << setw ( 50 ) << setfill ( '.' ) << "      addition of CO2 by ocean surface " << " = " <<    
         resetiosflags ( ios::left ) << setw ( 7 ) << fixed << setfill ( ' ' ) << co2_ocean << endl << setiosflags ( ios::left ) << 
         setw ( 50 ) << setfill ( '.' ) << "      addition of CO2 by land surface " << " = " << resetiosflags ( ios::left ) << setw ( 7 ) 
         << fixed << setfill ( ' ' ) << co2_land << endl << setiosflags ( ios::left ) << setw ( 50 ) << setfill ( '.' ) 
         << "      subtraction of CO2 by vegetation " << " = " << resetiosflags ( ios::left ) << setw ( 7 ) << fixed << setfill ( ' ' ) 
         << co2_vegetation << endl << setiosflags ( ios::left ) << setw ( 50 ) << "      valid for one single point on the surface"<< endl << endl;
-    cout << endl;
+    get_output() << endl;
 }
 
 
@@ -19,13 +19,15 @@
 #include "BC_Thermo.h"
 #include "Array.h"
 #include "Array_2D.h"
+#include "DatasetCache.h"
 #include "cAtmosphereModel.h"
 #include "Utils.h"
-#include "AtmParameters.h"
+#include "Thermo.h"
+#include "VecMath.h"
+#include "TraceRecorder.h"
 
 using namespace std;
 using namespace AtomUtils;
-using namespace AtmParameters;
 
 BC_Thermo::BC_Thermo (cAtmosphereModel* model, int im, int jm, int km, Array& h): 
         m_model(model),
@@ -85,6 +87,12 @@ BC_Thermo::BC_Thermo (cAtmosphereModel* model, int im, int jm, int km, Array& h)
     this-> declination = model->declination;
     this-> sun_position_lat = model->sun_position_lat;
     this-> sun_position_lon = model->sun_position_lon;
+    this-> debug = model->debug;
+    this-> math_accuracy = model->math_accuracy;
+    this-> saturation_table_exact = model->saturation_table_exact;
+    this-> t_land = model->t_land;
+    this-> c_land = model->c_land;
+    this-> co2_0 = model->co2_0;
 
     im_tropopause = model->get_tropopause();
 
@@ -122,8 +130,8 @@ BC_Thermo::BC_Thermo (cAtmosphereModel* model, int im, int jm, int km, Array& h)
 
     dr_dim = dr * L_atm;  // = 0.025 * 16000 = 400
 
-    cout.precision ( 8 );
-    cout.setf ( ios::fixed );
+    get_output().precision ( 8 );
+    get_output().setf ( ios::fixed );
 
     // Array "i_topography" integer field for mapping the topography
     // land surface in a 2D field
@@ -187,8 +195,8 @@ void BC_Thermo::BC_Radiation_multi_layer ( Array_2D &albedo, Array_2D &epsilon,
     logger() << "co2 min: " << co2.min() * co2_0 << "  ice min: " << ice.min() * 1000. << "  cloud min: "
     << cloud.min() * 1000. <<"  water vapour min: " << c.min() * 1000. << std::endl;
 */
-    cout.precision ( 4 );
-    cout.setf ( ios::fixed );
+    get_output().precision ( 4 );
+    get_output().setf ( ios::fixed );
 
     pi180 = 180./M_PI;
 
@@ -260,7 +268,7 @@ void BC_Thermo::BC_Radiation_multi_layer ( Array_2D &albedo, Array_2D &epsilon,
                 if( i >= i_mount ){ //start from the mountain top
                     epsilon_3D.x[ i ][ j ][ k ] = co2_coeff * epsilon_eff + .0416 * sqrt ( e );
                     radiation_3D.x[ i ][ j ][ k ] = ( 1. - epsilon_3D.x[ i ][ j ][ k ] ) * sigma * 
-                                    pow ( t.x[ i ][ j ][ k ] * t_0, 4. );
+                                    vm_pow4 ( t.x[ i ][ j ][ k ] * t_0, math_accuracy );
                 }
                 if ( epsilon_3D.x[ i ][ j ][ k ] > 1. )  epsilon_3D.x[ i ][ j ][ k ] = 1.;
             }
@@ -277,7 +285,7 @@ void BC_Thermo::BC_Radiation_multi_layer ( Array_2D &albedo, Array_2D &epsilon,
                 epsilon_3D.x[ i ][ j ][ k ] = epsilon_3D.x[ i_trop ][ j ][ k ];
                 t.x[ i ][ j ][ k ] = t_tropopause;
                 radiation_3D.x[ i ][ j ][ k ] = ( 1. - epsilon_3D.x[ i ][ j ][ k ] ) * sigma *
-                                 pow ( t.x[ i ][ j ][ k ] * t_0, 4. );
+                                 vm_pow4 ( t.x[ i ][ j ][ k ] * t_0, math_accuracy );
             }
         }
     }
@@ -313,11 +321,11 @@ void BC_Thermo::BC_Radiation_multi_layer ( Array_2D &albedo, Array_2D &epsilon,
 
                 // radiation leaving the atmosphere above the tropopause, later needed for non-dimensionalisation
                 radiation_3D.x[ i_trop ][ j ][ k ] = ( 1. - epsilon_3D.x[ i_trop ][ j ][ k ] ) * sigma * 
-                    pow ( t.x[ i_trop ][ j ][ k ] * t_0, 4. ); 
+                    vm_pow4 ( t.x[ i_trop ][ j ][ k ] * t_0, math_accuracy ); 
 
                 // back radiation absorbed by the first water vapour layer out of 40
                 radiation_back = epsilon_3D.x[ i_mount + 1 ][ j ][ k ] * sigma * 
-                    pow ( t.x[ i_mount + 1 ][ j ][ k ] * t_0, 4. );
+                    vm_pow4 ( t.x[ i_mount + 1 ][ j ][ k ] * t_0, math_accuracy );
                 atmospheric_window = .1007 * radiation_surface.y[ j ][ k ]; // radiation loss through the atmospheric window
                 rad_surf_diff = radiation_back + radiation_surface.y[ j ][ k ] - atmospheric_window; // radiation leaving the surface
 
@@ -330,11 +338,11 @@ void BC_Thermo::BC_Radiation_multi_layer ( Array_2D &albedo, Array_2D &epsilon,
                 CC[ i_mount ][ i_mount ] = 0.; // no absorption of radiation on the surface by water vapour
 
                 radiation_3D.x[ i_mount ][ j ][ k ] = ( 1. - epsilon_3D.x[ i_mount ][ j ][ k ] ) * sigma * 
-                    pow ( t.x[ i_mount ][ j ][ k ] * t_0, 4. ) / radiation_3D.x[ i_trop ][ j ][ k ]; // radiation leaving the surface
+                    vm_pow4 ( t.x[ i_mount ][ j ][ k ] * t_0, math_accuracy ) / radiation_3D.x[ i_trop ][ j ][ k ]; // radiation leaving the surface
 
                 for ( int i = i_mount + 1; i <= i_trop; i++ ){
                     AA[ i ] = AA[ i - 1 ] * ( 1. - epsilon_3D.x[ i ][ j ][ k ] ); // transmitted radiation from each layer
-                    double tmp = sigma * pow ( t.x[ i ][ j ][ k ] * t_0, 4. ) / radiation_3D.x[ i_trop ][ j ][ k ];
+                    double tmp = sigma * vm_pow4 ( t.x[ i ][ j ][ k ] * t_0, math_accuracy ) / radiation_3D.x[ i_trop ][ j ][ k ];
                     CC[ i ][ i ]= epsilon_3D.x[ i ][ j ][ k ] * tmp; // absorbed radiation in each layer
                     radiation_3D.x[ i ][ j ][ k ] = ( 1. - epsilon_3D.x[ i ][ j ][ k ] ) * tmp; // radiation leaving each layer
 
@@ -372,21 +380,21 @@ void BC_Thermo::BC_Radiation_multi_layer ( Array_2D &albedo, Array_2D &epsilon,
                 // radiation leaving the atmosphere above the tropopause, later needed for non-dimensionalisation
                     t.x[ i_trop ][ j ][ k ] = t_tropopause;
                     radiation_3D.x[ i_trop ][ j ][ k ] = ( 1. - epsilon_3D.x[ i_trop ][ j ][ k ] ) * sigma * 
-                        pow ( t.x[ i_trop ][ j ][ k ] * t_0, 4. );
+                        vm_pow4 ( t.x[ i_trop ][ j ][ k ] * t_0, math_accuracy );
 
                 // recurrence formula for the radiation and temperature
                 for ( int i = i_trop - 1; i >= i_mount; i-- ){
                     // above assumed tropopause constant temperature t_tropopause
                     // Thomas algorithm, recurrence formula
                     radiation_3D.x[ i ][ j ][ k ] = - alfa[ i ] * radiation_3D.x[ i + 1 ][ j ][ k ] + beta[ i ];
-                    t.x[ i ][ j ][ k ] = .5 * ( t.x[ i ][ j ][ k ] + pow ( radiation_3D.x[ i ][ j ][ k ] / sigma, 
-                        ( 1. / 4. ) ) / t_0 );    // averaging of temperature values to smooth the iterations
+                    t.x[ i ][ j ][ k ] = .5 * ( t.x[ i ][ j ][ k ] + vm_root4 ( radiation_3D.x[ i ][ j ][ k ] / sigma, math_accuracy )
+                        / t_0 );    // averaging of temperature values to smooth the iterations
                 }
 
                 for ( int i = i_trop; i < im; i++ ){ // above tropopause
                     t.x[ i ][ j ][ k ] = t_tropopause;
                     radiation_3D.x[ i ][ j ][ k ] = ( 1. - epsilon_3D.x[ i_trop ][ j ][ k ] ) * sigma * 
-                        pow ( t.x[ i ][ j ][ k ] * t_0, 4. );
+                        vm_pow4 ( t.x[ i ][ j ][ k ] * t_0, math_accuracy );
                 }
             }
         }
@@ -450,13 +458,13 @@ void BC_Thermo::BC_Temperature( Array_2D &temperature_NASA, Array &h, Array &t,
         t_cretaceous_add /= t_0; 
     }
 
-    cout.precision ( 3 );
+    get_output().precision ( 3 );
 
     string time_slice_comment = "      time slice of Cretaceous-AGCM:";
     string time_slice_number = " Ma = ";
     string time_slice_unit = " million years";
 
-    cout << endl << setiosflags ( ios::left ) << setw ( 55 ) << setfill ( '.' ) << time_slice_comment << 
+    get_output() << endl << setiosflags ( ios::left ) << setw ( 55 ) << setfill ( '.' ) << time_slice_comment << 
         resetiosflags ( ios::left ) << setw ( 6 ) << fixed << setfill ( ' ' ) << time_slice_number << 
         setw ( 3 ) << Ma << setw ( 12 ) << time_slice_unit << endl << endl;
 
@@ -468,7 +476,7 @@ void BC_Thermo::BC_Temperature( Array_2D &temperature_NASA, Array &h, Array &t,
     string temperature_average_cret = " t cretaceous";
     string temperature_unit =  "°C ";
 
-    cout << endl << setiosflags ( ios::left ) << setw ( 55 ) << setfill ( '.' ) << temperature_comment << 
+    get_output() << endl << setiosflags ( ios::left ) << setw ( 55 ) << setfill ( '.' ) << temperature_comment << 
         resetiosflags ( ios::left ) << setw ( 12 ) << temperature_gain << " = " << setw ( 7 ) << setfill ( ' ' ) << 
         t_cretaceous << setw ( 5 ) << temperature_unit << endl << setw ( 55 ) << setfill ( '.' )  << setiosflags ( ios::left ) 
         << temperature_modern << resetiosflags ( ios::left ) << setw ( 13 ) << temperature_average  << " = "  << setw ( 7 )  
@@ -713,7 +721,7 @@ void BC_Thermo::BC_WaterVapour ( Array &h, Array &p_stat, Array &t, Array &c,
                 r_dry = 100. * p_stat.x[ i_mount ][ j ][ k ] / ( R_Air * t.x[ i_mount ][ j ][ k ] * t_0 );
                 r_humid = r_dry / ( 1. + ( R_WaterVapour / R_Air - 1. ) * c.x[ i_mount ][ j ][ k ] );
                 e = c.x[ i_mount ][ j ][ k ] * p_stat.x[ i_mount ][ j ][ k ] / ep;  // water vapour pressure in hPa
-                E = hp * exp_func ( t_u, 17.2694, 35.86 ); // saturation water vapour pressure for the water phase at t > 0°C in hPa
+                E = hp * saturation_water.E ( t_u, saturation_table_exact ); // saturation water vapour pressure for the water phase at t > 0°C in hPa
                 sat_difference = ( E - e );  // saturation difference in hPa/K
                 Dalton_Evaporation = 8.46e-4 * C_Dalton ( u_0, v.x[ i_mount ][ j ][ k ], w.x[ i_mount ][ j ][ k ] ) *
                     sat_difference * dt_dim / ( r_humid * dr_dim ) * 24.;  // mm/h in mm/d
@@ -802,7 +810,7 @@ void BC_Thermo::BC_CO2( Array_2D &Vegetation, Array &h, Array &t, Array &p_dyn,
     co2_average = 3.2886 * pow ( t_average, 2 ) - 32.8859 * t_average + 102.2148;  // in ppm
     co2_cretaceous = co2_cretaceous - co2_average;
 
-    cout.precision ( 3 );
+    get_output().precision ( 3 );
 
     string co_comment = "      co2 increase at cretaceous times: ";
     string co_gain = " co2 increase";
@@ -812,7 +820,7 @@ void BC_Thermo::BC_CO2( Array_2D &Vegetation, Array &h, Array &t, Array &p_dyn,
     string co_average_cret = " co2 cretaceous";
     string co_unit =  "ppm ";
 
-    cout << endl << setiosflags ( ios::left ) << setw ( 55 ) << setfill ( '.' ) <<
+    get_output() << endl << setiosflags ( ios::left ) << setw ( 55 ) << setfill ( '.' ) <<
         co_comment << resetiosflags ( ios::left )         << setw ( 12 ) << co_gain << " = "
         << setw ( 7 ) << setfill ( ' ' ) << co2_cretaceous << setw ( 5 ) << co_unit << 
         endl << setw ( 55 ) << setfill ( '.' )  << setiosflags ( ios::left ) << co_modern
@@ -822,7 +830,7 @@ void BC_Thermo::BC_CO2( Array_2D &Vegetation, Array &h, Array &t, Array &p_dyn,
         << co_cretaceous_str << resetiosflags ( ios::left ) << setw ( 13 ) << co_average_cret
         << " = "  << setw ( 7 )  << setfill ( ' ' ) << co2_average + co2_cretaceous
         << setw ( 5 ) << co_unit << endl;
-    cout << endl;
+    get_output() << endl;
 
     d_i_max = ( double ) i_max;
     d_j_half = ( double ) j_half;
@@ -2311,33 +2319,20 @@ void BC_Thermo::BC_Surface_Temperature_NASA ( const string &Name_SurfaceTemperat
                              Array_2D &temperature_NASA, Array &t ){
 // initial conditions for the Name_SurfaceTemperature_File at the sea surface
 
-    cout.precision ( 3 );
-    cout.setf ( ios::fixed );
+    get_output().precision ( 3 );
+    get_output().setf ( ios::fixed );
 
-    ifstream Name_SurfaceTemperature_File_Read(Name_SurfaceTemperature_File);
-
-    if (!Name_SurfaceTemperature_File_Read.is_open()) {
-        cerr << "ERROR: could not open SurfaceTemperature_File file at "
-        << Name_SurfaceTemperature_File << "\n";
-        abort();
-    }
+    // the lines run along the latitudes, bad lines are taken as 0°C
+    DatasetCache::Handle temperature = DatasetCache::grid ( Name_SurfaceTemperature_File, km, jm, "SurfaceTemperature_File" );
 
     k_half = ( km -1 ) / 2;                                                             // position at 180°E ( Greenwich )
-    int j = 0;
-    int k = 0;
-
-    while ( ( k < km ) && !Name_SurfaceTemperature_File_Read.eof() ){
-        while ( j < jm ){
-            double lat, lon, temperature;
-            Name_SurfaceTemperature_File_Read >> lat;
-            Name_SurfaceTemperature_File_Read >> lon;
-            Name_SurfaceTemperature_File_Read >> temperature;
 
-            t.x[ 0 ][ j ][ k ] = temperature_NASA.y[ j ][ k ] = ( temperature + t_0 ) / t_0;
-            j++;
+    for ( int k = 0; k < km; k++ ){
+        for ( int j = 0; j < jm; j++ ){
+            double value = ( *temperature )[ k * jm + j ];
+            if ( std::isnan ( value ) )  value = 0.;
+            t.x[ 0 ][ j ][ k ] = temperature_NASA.y[ j ][ k ] = ( value + t_0 ) / t_0;
         }
-    j = 0;
-    k++;
     }
 
     // correction of surface temperature around 180°E
@@ -2352,32 +2347,18 @@ void BC_Thermo::BC_Surface_Temperature_NASA ( const string &Name_SurfaceTemperat
 void BC_Thermo::BC_Surface_Precipitation_NASA ( const string &Name_SurfacePrecipitation_File,
                              Array_2D &precipitation_NASA ){
     // initial conditions for the Name_SurfacePrecipitation_File at the sea surface
-    cout.precision ( 3 );
-    cout.setf ( ios::fixed );
-
-    ifstream Name_SurfacePrecipitation_File_Read(Name_SurfacePrecipitation_File);
-
-    if (!Name_SurfacePrecipitation_File_Read.is_open()) {
-        cerr << "ERROR: could not open SurfacePrecipitation_File file at "
-        << Name_SurfacePrecipitation_File << "\n";
-        abort();
-    }
-
-    int j = 0;
-    int k = 0;
+    get_output().precision ( 3 );
+    get_output().setf ( ios::fixed );
 
-    while ( ( k < km ) && !Name_SurfacePrecipitation_File_Read.eof() ){
-        while ( j < jm ){
-            double lat, lon, precipitation;
-            Name_SurfacePrecipitation_File_Read >> lat;
-            Name_SurfacePrecipitation_File_Read >> lon;
-            Name_SurfacePrecipitation_File_Read >> precipitation;
+    // the lines run along the latitudes, bad lines are taken as no precipitation
+    DatasetCache::Handle precipitation = DatasetCache::grid ( Name_SurfacePrecipitation_File, km, jm,
+                                                              "SurfacePrecipitation_File" );
 
-            precipitation_NASA.y[ j ][ k ] = precipitation;
-            j++;
+    for ( int k = 0; k < km; k++ ){
+        for ( int j = 0; j < jm; j++ ){
+            double value = ( *precipitation )[ k * jm + j ];
+            precipitation_NASA.y[ j ][ k ] = std::isnan ( value ) ? 0. : value;
         }
-    j = 0;
-    k++;
     }
 }
 
@@ -2394,12 +2375,17 @@ void BC_Thermo::BC_Pressure ( Array &p_stat, Array &p_dyn, Array &t, Array &h ){
         }
     }
 
-    for ( int k = 0; k < km; k++ ){
+    // evaluated along the contiguous longitudes to use the SIMD version of pow
+    std::vector<double> ratio ( km );
+    for ( int i = 1; i < im; i++ ){
+        hight = ( double ) i * ( L_atm / ( double ) ( im-1 ) );
         for ( int j = 0; j < jm; j++ ){
-            for ( int i = 1; i < im; i++ ){
-                hight = ( double ) i * ( L_atm / ( double ) ( im-1 ) );
-                p_stat.x[ i ][ j ][ k ] = pow ( ( ( t.x[ 0 ][ j ][ k ] * t_0 - gam * hight * 1.e-2 ) /
-                    ( t.x[ 0 ][ j ][ k ] * t_0 ) ), exp_pressure ) * p_stat.x[ 0 ][ j ][ k ];
+            for ( int k = 0; k < km; k++ ){
+                ratio[ k ] = ( t.x[ 0 ][ j ][ k ] * t_0 - gam * hight * 1.e-2 ) / ( t.x[ 0 ][ j ][ k ] * t_0 );
+            }
+            vm_pow ( km, &ratio[ 0 ], exp_pressure, p_stat.x[ i ][ j ], math_accuracy );
+            for ( int k = 0; k < km; k++ ){
+                p_stat.x[ i ][ j ][ k ] = p_stat.x[ i ][ j ][ k ] * p_stat.x[ 0 ][ j ][ k ];
                 // linear temperature distribution T = T0 - gam * hight
                 // current air pressure, step size in 500 m, from politropic formula in hPa
             }
@@ -2444,13 +2430,6 @@ void BC_Thermo::Latent_Heat ( Array_1D &rad, Array_1D &the, Array_1D &phi, Array
         rmsinthe = rm * sinthe;
         for ( int k = 0; k < km; k++ ){
             int i_mount = i_topography[ j ][ k ];
-            t_Celsius = t.x[ i_mount ][ j ][ k ] * t_0 - t_0;  // conversion from Kelvin to Celsius
-            T = t.x[ i_mount ][ j ][ k ] * t_0;
-            p_h = p_stat.x[ i_mount ][ j ][ k ];
-            E_Rain = hp * exp_func ( T, 17.2694, 35.86 );  // saturation water vapour pressure for the water phase at t > 0°C in hPa
-            E_Ice = hp * exp_func ( T, 21.8746, 7.66 );  // saturation water vapour pressure for the ice phase in hPa
-            q_Rain  = ep * E_Rain / ( p_h - E_Rain );  // water vapour amount at saturation with water formation in kg/kg
-            q_Ice  = ep * E_Ice / ( p_h - E_Ice );  // water vapour amount at saturation with ice formation in kg/kg
             e = .01 * c.x[ i_mount ][ j ][ k ] * p_stat.x[ i_mount ][ j ][ k ] / ep;  // water vapour pressure in Pa
             a = e / ( R_WaterVapour * t.x[ i_mount ][ j ][ k ] * t_0 );  // absolute humidity in kg/m³
             Q_Latent.x[ i_mount ][ j ][ k ] = - coeff_Lv * a * ( - 3. * c.x[ i_mount ][ j ][ k ] +
@@ -2482,13 +2461,6 @@ void BC_Thermo::Latent_Heat ( Array_1D &rad, Array_1D &the, Array_1D &phi, Array
 // collection of coefficients
                 rm = rad.z[ i ];
                 rm2 = rm * rm;
-                t_Celsius = t.x[ i ][ j ][ k ] * t_0 - t_0;  // conversion from Kelvin to Celsius
-                T = t.x[ i ][ j ][ k ] * t_0; // in K
-                p_h = p_stat.x[ i ][ j ][ k ];
-                E_Rain = hp * exp_func ( T, 17.2694, 35.86 );  // saturation water vapour pressure for the water phase at t > 0°C in hPa
-                E_Ice = hp * exp_func ( T, 21.8746, 7.66 );  // saturation water vapour pressure for the ice phase in hPa
-                q_Rain  = ep * E_Rain / ( p_h - E_Rain );  // water vapour amount at saturation with water formation in kg/kg
-                q_Ice  = ep * E_Ice / ( p_h - E_Ice );  // water vapour amount at saturation with ice formation in kg/kg
                 e = .01 * c.x[ i ][ j ][ k ] * p_stat.x[ i ][ j ][ k ] / ep;  // water vapour pressure in Pa
                 a = e / ( r_water_vapour * t.x[ i ][ j ][ k ] * t_0 );  // absolute humidity in kg/m³
                 Q_Latent.x[ i ][ j ][ k ] = - coeff_Lv * a * ( c.x[ i+1 ][ j ][ k ] - c.x[ i-1 ][ j ][ k ] ) / ( 2. * dr );
@@ -2514,7 +2486,7 @@ void BC_Thermo::Ice_Water_Saturation_Adjustment ( Array &h, Array &c, Array &cn,
         assert(!c.has_nan());
         assert(!t.has_nan());
     }
-    cout.precision ( 6 );
+    get_output().precision ( 6 );
 // Ice_Water_Saturation_Adjustment, distribution of cloud ice and cloud water dependent on water vapour amount and temperature
 /*
     logger() << std::endl << std::endl << "enter %%%%%%%%%%%% Ice_Water_Saturation_Adjustment: temperature max: "
@@ -2533,266 +2505,214 @@ void BC_Thermo::Ice_Water_Saturation_Adjustment ( Array &h, Array &c, Array &cn,
 
     exp_pressure = g / ( 1.e-2 * gam * R_Air );
 
+    int warnings = 0;  // cells where T < gam * hight * 1.e-2 during the mixed phase iterations
+
     // setting water vapour, cloud water and cloud ice into the proper thermodynamic ratio based on the local temperatures
     // starting from a guessed parabolic temperature and water vapour distribution in north/south direction
-    for ( int k = 0; k < km; k++ ){
-        for ( int j = 0; j < jm; j++ ){
-            for ( int i = 0; i < im; i++ ){
-/** %%%%%%%%%%%%%%%%%%%%%%%%%%     saturation pressure     %%%%%%%%%%%%%%%%%%%%%%%%%%%% **/
-                t_u = t.x[ i ][ j ][ k ] * t_0; // in K
-                t_Celsius = t_u - t_0; // in C
-
-                p_SL =  .01 * ( r_air * R_Air * t.x[ 0 ][ j ][ k ] * t_0 ); // given in hPa
-                hight = ( double ) i * ( L_atm / ( double ) ( im-1 ) );
-                if ( i != 0 )           p_h = pow ( ( ( t.x[ i ][ j ][ k ] * t_0 - gam * hight * 1.e-2 ) /
-                                                      ( t.x[ i ][ j ][ k ] * t_0 ) ), exp_pressure ) * p_SL;
-                else                     p_h = p_SL;
-
-                r_dry = 100. * p_h / ( R_Air * t_u );
-//              r_humid = r_dry / ( 1. + ( R_WaterVapour / R_Air - 1. ) * c.x[ i ][ j ][ k ] );
-//                             density of humid air, COSMO version withot cloud and ice water, masses negligible
-                r_humid = r_dry * ( 1. + c.x[ i ][ j ][ k ] ) / ( 1. + R_WaterVapour / R_Air * c.x[ i ][ j ][ k ] );
-                e_h = .01 * r_humid * R_WaterVapour * t_u; // delivers the same results
-                a_h = 216.6 * e_h / t_u; // absolute humidity in kg/m3
-                q_h = c.x[ i ][ j ][ k ]; // threshold value for water vapour at local hight h in kg/kg
-                E_Rain = hp * exp_func ( t_u, 17.2694, 35.86 ); // saturation water vapour pressure for the water phase at t > 0°C in hPa
-                E_Ice = hp * exp_func ( t_u, 21.8746, 7.66 ); // saturation water vapour pressure for the ice phase in hPa
-                q_Rain = ep * E_Rain / ( p_h - E_Rain ); // water vapour amount at saturation with water formation in kg/kg
-                q_Ice = ep * E_Ice / ( p_h - E_Ice ); // water vapour amount at saturation with ice formation in kg/kg
+    // the columns are independent of each other and are distributed over the threads
+    #pragma omp parallel reduction ( + : warnings )
+    {
+        std::vector<double> p_h_column ( im );  // pressure profile of the column in hPa
 
-/** %%%%%%%%%%%%%%%%%%%%%%%%%%%     warm cloud phase     %%%%%%%%%%%%%%%%%%%%%%%%%%%%%% **/
+        // the share of each thread in the timeline, nowait ends it before the threads wait for each other
+        TraceScope chunk_trace ( "Saturation_Adjustment columns", "kernel" );
+        #pragma omp for collapse ( 2 ) schedule ( dynamic, 8 ) nowait
+        for ( int k = 0; k < km; k++ ){
+            for ( int j = 0; j < jm; j++ ){
+                // the surface cell is adjusted first, its new temperature determines p_SL for the cells above
+                double p_SL = .01 * ( r_air * R_Air * t.x[ 0 ][ j ][ k ] * t_0 ); // given in hPa
+                warnings += Saturation_Adjustment_Cell ( 0, j, k, p_SL, p_SL, h, c, cn, cloud, cloudn, ice, icen, t, S_c_c );
+
+                p_SL = .01 * ( r_air * R_Air * t.x[ 0 ][ j ][ k ] * t_0 ); // given in hPa
+                for ( int i = 1; i < im; i++ ){
+                    double t_u = t.x[ i ][ j ][ k ] * t_0; // in K
+                    double hight = ( double ) i * ( L_atm / ( double ) ( im-1 ) );
+                    p_h_column[ i ] = ( t_u - gam * hight * 1.e-2 ) / t_u;
+                }
+                vm_pow ( im - 1, &p_h_column[ 1 ], exp_pressure, &p_h_column[ 1 ], math_accuracy );
+                for ( int i = 1; i < im; i++ )  p_h_column[ i ] = p_h_column[ i ] * p_SL;
+                for ( int i = 1; i < im; i++ ){
+                    warnings += Saturation_Adjustment_Cell ( i, j, k, p_SL, p_h_column[ i ], h, c, cn, cloud, cloudn,
+                                                        ice, icen, t, S_c_c );
+                }
+            } // end j
+        } // end k
+    }
 
-// warm cloud phase in case water vapour is over-saturated
-                if ( t_Celsius >= 0. ){
-                    q_T = c.x[ i ][ j ][ k ] + cloud.x[ i ][ j ][ k ]; // total water content
-                    t_u = t.x[ i ][ j ][ k ] * t_0; // in K
-                    t_Celsius = t_u - t_0;
-
-                    p_SL = .01 * ( r_air * R_Air * t.x[ 0 ][ j ][ k ] * t_0 ); // given in hPa
-                    hight = ( double ) i * ( L_atm / ( double ) ( im-1 ) );
-                    if ( i != 0 )           p_h = pow ( ( ( t.x[ i ][ j ][ k ] * t_0 - gam * hight * 1.e-2 ) /
-                                                          ( t.x[ i ][ j ][ k ] * t_0 ) ), exp_pressure ) * p_SL;
-                    else                    p_h = p_SL;
-
-                    E_Rain = hp * exp_func ( t_u, 17.2694, 35.86 ); // saturation water vapour pressure for the water phase at t > 0°C in hPa
-                    q_Rain = ep * E_Rain / ( p_h - E_Rain ); // water vapour amount at saturation with water formation in kg/kg
-                    q_Rain_n = q_Rain;
-
-                    if ( q_T <= q_Rain ){ /**     subsaturated     **/
-                        c.x[ i ][ j ][ k ] = q_T; // total water amount as water vapour
-                        cloud.x[ i ][ j ][ k ] = 0.; // no cloud water available
-                        ice.x[ i ][ j ][ k ] = 0.; // no cloud ice available above 0 °C
-                        T_it = t_u;
+    if ( warnings > 0 ){
+        logger() << "WARNING: T is less than gam * hight * 1.e-2 in " << warnings << " iterations. " << __LINE__ << " "
+            << __FILE__ << std::endl;
+    }
 /*
-if ( ( i == 5 ) && ( j == 90 ) && ( k == 180 ) ){
-    logger() << "no cloud               Ice_Water_Saturation_Adjustment: temperature max: " << (t.max() - 1)*t_0 <<"          iter_prec: " << iter_prec << std::endl;
-    logger() << "no cloud               Ice_Water_Saturation_Adjustment: water vapour max: " << c.max() * 1000. << std::endl;
-    logger() << "no cloud               Ice_Water_Saturation_Adjustment: cloud water max: " << cloud.max() * 1000. << std::endl;
-    logger() << "no cloud               Ice_Water_Saturation_Adjustment: cloud ice max: " << ice.max() * 1000. << std::endl << std::endl;
-}
+    logger() << "end Ice_Water_Saturation_Adjustment: water vapour max: "
+        << c.max() * 1000. << std::endl;
+    logger() << "end Ice_Water_Saturation_Adjustment: cloud water max: "
+        << cloud.max() * 1000. << std::endl;
+    logger() << "end Ice_Water_Saturation_Adjustment: cloud ice max: "
+        << ice.max() * 1000. << std::endl << std::endl;
+
+    logger() << "end %%%%%%%%%%%% Ice_Water_Saturation_Adjustment: temperature max: "
+    << (t.max() - 1)*t_0 << std::endl << std::endl << std::endl;
 */
-                    }else{ /**     oversaturated     **/
-                        for(int iter_prec = 1; iter_prec <= 20; iter_prec++ ){ // iter_prec may be varied
-/*
-if ( ( i == 5 ) && ( j == 90 ) && ( k == 180 ) ){
-    logger() << "warm cloud               Ice_Water_Saturation_Adjustment: temperature max: " << (t.max() - 1)*t_0 <<"          iter_prec: " << iter_prec << std::endl;
-    logger() << "warm cloud               Ice_Water_Saturation_Adjustment: water vapour max: " << c.max() * 1000. << std::endl;
-    logger() << "warm cloud               Ice_Water_Saturation_Adjustment: cloud water max: " << cloud.max() * 1000. << std::endl;
-    logger() << "warm cloud               Ice_Water_Saturation_Adjustment: cloud ice max: " << ice.max() * 1000. << std::endl << std::endl;
+    if(debug){
+        assert(!cloud.has_nan());
+        assert(!ice.has_nan());
+        assert(!c.has_nan());
+        assert(!t.has_nan());
+    }
 }
-*/
-                            T_it = ( t_u + lv / cp_l * c.x[ i ][ j ][ k ] - lv / cp_l * q_Rain );
-                            E_Rain = hp * exp_func ( T_it, 17.2694, 35.86 ); // saturation water vapour pressure for the water phase at t > 0°C in hPa
-                            q_Rain = ep * E_Rain / ( p_h - E_Rain ); // water vapour amount at saturation with water formation in kg/kg
-                            q_Rain = .5 * ( q_Rain_n + q_Rain );  // smoothing the iteration process
-
-                            c.x[ i ][ j ][ k ] = q_Rain; // water vapour restricted to saturated water vapour amount
-                            cloud.x[ i ][ j ][ k ] = q_T - c.x[ i ][ j ][ k ]; // cloud water amount
-                            ice.x[ i ][ j ][ k ] = 0.; // no cloud ice available
-                            q_T = c.x[ i ][ j ][ k ] + cloud.x[ i ][ j ][ k ];
 
-                            if ( c.x[ i ][ j ][ k ] < 0. )  c.x[ i ][ j ][ k ] = 0.;
-                            if ( cloud.x[ i ][ j ][ k ] < 0. )  cloud.x[ i ][ j ][ k ] = 0.;
 
-//                            if ( fabs ( q_Rain / q_Rain_n - 1. ) <= 1.e-5 )     break;
 
-                            if( ( q_Rain_n ) > std::numeric_limits<double>::epsilon() &&
-                                fabs ( q_Rain / q_Rain_n - 1. ) <= 1.e-5 )    break;  // make sure q_Rain_n is not 0 divisor
-
-                            q_Rain_n = q_Rain;
-                        }
-                    }
-                    cn.x[ i ][ j ][ k ] = c.x[ i ][ j ][ k ];
-                    cloudn.x[ i ][ j ][ k ] = cloud.x[ i ][ j ][ k ];
-                    icen.x[ i ][ j ][ k ] = ice.x[ i ][ j ][ k ];
-                    t.x[ i ][ j ][ k ] = T_it / t_0;
-                } // end ( t_Celsius > 0. )
-/** %%%%%%%%%%%%%%%%%%%%%%%%%%%     end          warm cloud phase     %%%%%%%%%%%%%%%%%%%%%%%%%%%%%% **/
-
-
-/** %%%%%%%%%%%%%%%%%%%%%%%%%%%     mixed cloud phase     %%%%%%%%%%%%%%%%%%%%%%%%%%%%%% **/
+int BC_Thermo::Saturation_Adjustment_Cell ( int i, int j, int k, double p_SL, double p_h, Array &h, Array &c, 
+                            Array &cn, Array &cloud, Array &cloudn, Array &ice, Array &icen, Array &t, Array &S_c_c ) const{
+// adjustment of a single cell, all intermediate values are local so that cells can be processed concurrently
+// returns the number of mixed phase iterations in which p_h could not be computed from T
+    int warnings = 0;
 
 /** %%%%%%%%%%%%%%%%%%%%%%%%%%     saturation pressure     %%%%%%%%%%%%%%%%%%%%%%%%%%%% **/
-// mixed cloud phase, if 0°C > t > -37°C
-                if ( t_Celsius < 0. ){
-                    if ( t_Celsius < t_Celsius_2 )  cloud.x[ i ][ j ][ k ] = 0.;
-                    if ( t_Celsius > 0. )  ice.x[ i ][ j ][ k ] = 0.;
-                    q_v_b = c.x[ i ][ j ][ k ];
-                    q_c_b = cloud.x[ i ][ j ][ k ];
-                    q_i_b = ice.x[ i ][ j ][ k ];
-                    q_T = q_v_b + q_c_b + q_i_b; // total water content
-/*
-if ( ( i == 13 ) && ( j == 90 ) && ( k == 180 ) ){
-    logger() << "   q_v_b = " << q_v_b * 1000. << "   q_c_b = " << q_c_b * 1000.
-        << "   q_i_b = " << q_i_b * 1000. << "   q_T = " << q_T * 1000. << endl << endl;
-}
-*/
-                    t_u = t.x[ i ][ j ][ k ] * t_0; // in K
-                    T = T_nue = t_u; // in K
+    double t_u = t.x[ i ][ j ][ k ] * t_0; // in K
+    double t_Celsius = t_u - t_0; // in C
+    double hight = ( double ) i * ( L_atm / ( double ) ( im-1 ) );
 
-                    E_Rain = hp * exp_func ( T, 17.2694, 35.86 ); // saturation water vapour pressure for the water phase at t > 0°C in hPa
-                    E_Ice = hp * exp_func ( T, 21.8746, 7.66 ); // saturation water vapour pressure for the ice phase in hPa
-                    q_Rain = ep * E_Rain / ( p_h - E_Rain ); // water vapour amount at saturation with water formation in kg/kg
-                    q_Ice = ep * E_Ice / ( p_h - E_Ice ); // water vapour amount at saturation with ice formation in kg/kg
+    double E_Rain = hp * saturation_water.E ( t_u, saturation_table_exact ); // saturation water vapour pressure for the water phase at t > 0°C in hPa
+    double E_Ice = hp * saturation_ice.E ( t_u, saturation_table_exact ); // saturation water vapour pressure for the ice phase in hPa
+    double q_Rain = q_sat ( ep, E_Rain, p_h ); // water vapour amount at saturation with water formation in kg/kg
+    double q_Ice = q_sat ( ep, E_Ice, p_h ); // water vapour amount at saturation with ice formation in kg/kg
 
-                    if ( ( q_c_b > 0. ) && ( q_i_b > 0. ) )
-                        q_v_hyp = ( q_c_b * q_Rain + q_i_b * q_Ice ) / ( q_c_b + q_i_b );
-                    if ( ( q_c_b >= 0. ) && ( q_i_b == 0. ) )  q_v_hyp = q_Rain;
-                    if ( ( q_c_b == 0. ) && ( q_i_b > 0. ) )  q_v_hyp = q_Ice;
+/** %%%%%%%%%%%%%%%%%%%%%%%%%%%     warm cloud phase     %%%%%%%%%%%%%%%%%%%%%%%%%%%%%% **/
 
-/** §§§§§§§§§§§§§§§§§§§§§§§§§§§§§§§§§§     iterations for mixed cloud phase     §§§§§§§§§§§§§§§§§§§§§§§§§§§§§§§§§§§§§§§§§§§§§§§§ **/
+// warm cloud phase in case water vapour is over-saturated
+    if ( t_Celsius >= 0. ){
+        double q_T = c.x[ i ][ j ][ k ] + cloud.x[ i ][ j ][ k ]; // total water content
+        double q_Rain_n = q_Rain;
+        double T_it = t_u;
+
+        if ( q_T <= q_Rain ){ /**     subsaturated     **/
+            c.x[ i ][ j ][ k ] = q_T; // total water amount as water vapour
+            cloud.x[ i ][ j ][ k ] = 0.; // no cloud water available
+            ice.x[ i ][ j ][ k ] = 0.; // no cloud ice available above 0 °C
+        }else{ /**     oversaturated     **/
+            for(int iter_prec = 1; iter_prec <= 20; iter_prec++ ){ // iter_prec may be varied
+                T_it = ( t_u + lv / cp_l * c.x[ i ][ j ][ k ] - lv / cp_l * q_Rain );
+                E_Rain = hp * saturation_water.E ( T_it, saturation_table_exact ); // saturation water vapour pressure for the water phase at t > 0°C in hPa
+                q_Rain = q_sat ( ep, E_Rain, p_h ); // water vapour amount at saturation with water formation in kg/kg
+                q_Rain = .5 * ( q_Rain_n + q_Rain );  // smoothing the iteration process
+
+                c.x[ i ][ j ][ k ] = q_Rain; // water vapour restricted to saturated water vapour amount
+                cloud.x[ i ][ j ][ k ] = q_T - c.x[ i ][ j ][ k ]; // cloud water amount
+                ice.x[ i ][ j ][ k ] = 0.; // no cloud ice available
+                q_T = c.x[ i ][ j ][ k ] + cloud.x[ i ][ j ][ k ];
 
-                    for(int iter_prec = 1; iter_prec <= 20; iter_prec++ ){ // iter_prec may be varied
+                if ( c.x[ i ][ j ][ k ] < 0. )  c.x[ i ][ j ][ k ] = 0.;
+                if ( cloud.x[ i ][ j ][ k ] < 0. )  cloud.x[ i ][ j ][ k ] = 0.;
 
-/*
-if ( ( i == 13 ) && ( j == 90 ) && ( k == 180 ) ){
-    logger() << "mixed cloud               Ice_Water_Saturation_Adjustment: temperature max: "
-        << (t.max() - 1)*t_0 <<"          iter_prec: " << iter_prec << std::endl;
-    logger() << "mixed cloud               Ice_Water_Saturation_Adjustment: water vapour max: "
-        << c.max() * 1000. << std::endl;
-    logger() << "mixed cloud               Ice_Water_Saturation_Adjustment: cloud water max: "
-        << cloud.max() * 1000. << std::endl;
-    logger() << "mixed cloud               Ice_Water_Saturation_Adjustment: cloud ice max: "
-        << ice.max() * 1000. << std::endl << std::endl;
-}
-*/
-/** condensation == water vapor saturation for cloud water formation, deposition == ice crystal for cloud ice formation **/
-                        // t_0 = 273.15 K == 0 °C, t_00 = 236.15 K == -37 °C
-                        CND = ( T - t_00 ) / ( t_0 - t_00 );
-                        if ( T < t_00 ) CND = 0.;
-                         // T = t_00 => CND = 0 ( no condensation == no cloud water ),
-                         // T = t_0 => CND = 1 ( max condensation == max cloud water )
+                if( ( q_Rain_n ) > std::numeric_limits<double>::epsilon() &&
+                    fabs ( q_Rain / q_Rain_n - 1. ) <= 1.e-5 )    break;  // make sure q_Rain_n is not 0 divisor
 
-                        DEP = ( t_0 - T ) / ( t_0 - t_00 );
-                        if ( T > t_0 ) DEP = 0.;
-                        // T = t_0 => DEP = 0 ( no deposition == no cloud ice ),
-                        // T = t_00 => DEP = 1 ( max deposition == max cloud ice )
+                q_Rain_n = q_Rain;
+            }
+        }
+        cn.x[ i ][ j ][ k ] = c.x[ i ][ j ][ k ];
+        cloudn.x[ i ][ j ][ k ] = cloud.x[ i ][ j ][ k ];
+        icen.x[ i ][ j ][ k ] = ice.x[ i ][ j ][ k ];
+        t.x[ i ][ j ][ k ] = T_it / t_0;
+    } // end ( t_Celsius > 0. )
+/** %%%%%%%%%%%%%%%%%%%%%%%%%%%     end          warm cloud phase     %%%%%%%%%%%%%%%%%%%%%%%%%%%%%% **/
 
-                        d_q_v = q_v_hyp - q_v_b;  // changes in water vapour causing cloud water and cloud ice
-                        d_q_c = - d_q_v * CND;
-                        d_q_i = - d_q_v * DEP;
 
-                        d_t = ( lv * d_q_c + ls * d_q_i ) / cp_l; // in K, temperature changes
-                        T = T + d_t; // in K
+/** %%%%%%%%%%%%%%%%%%%%%%%%%%%     mixed cloud phase     %%%%%%%%%%%%%%%%%%%%%%%%%%%%%% **/
 
-                        q_v_b = c.x[ i ][ j ][ k ] + d_q_v;  // new values
-                        q_c_b = cloud.x[ i ][ j ][ k ] + d_q_c;
-                        q_i_b = ice.x[ i ][ j ][ k ] + d_q_i;
+// mixed cloud phase, if 0°C > t > -37°C
+    if ( t_Celsius < 0. ){
+        if ( t_Celsius < t_Celsius_2 )  cloud.x[ i ][ j ][ k ] = 0.;
+        double q_v_b = c.x[ i ][ j ][ k ];
+        double q_c_b = cloud.x[ i ][ j ][ k ];
+        double q_i_b = ice.x[ i ][ j ][ k ];
+        double T = t_u; // in K
+
+        double q_v_hyp = q_Rain;
+        if ( ( q_c_b > 0. ) && ( q_i_b > 0. ) )
+            q_v_hyp = ( q_c_b * q_Rain + q_i_b * q_Ice ) / ( q_c_b + q_i_b );
+        if ( ( q_c_b >= 0. ) && ( q_i_b == 0. ) )  q_v_hyp = q_Rain;
+        if ( ( q_c_b == 0. ) && ( q_i_b > 0. ) )  q_v_hyp = q_Ice;
 
-                        if ( q_v_b < 0. )  q_v_b = 0.;  // negative values excluded, when iteration starts
-                        if ( q_c_b < 0. )  q_c_b = 0.;
-                        if ( q_i_b < 0. )  q_i_b = 0.;
+/** §§§§§§§§§§§§§§§§§§§§§§§§§§§§§§§§§§     iterations for mixed cloud phase     §§§§§§§§§§§§§§§§§§§§§§§§§§§§§§§§§§§§§§§§§§§§§§§§ **/
 
-                        p_SL = .01 * ( r_air * R_Air * t.x[ 0 ][ j ][ k ] * t_0 ); // given in hPa, needed for saturation water vapour
-                        hight = ( double ) i * ( L_atm / ( double ) ( im-1 ) );
-                        if ( i != 0 ){
-                            if( T > gam * hight * 1.e-2){
-                                p_h = pow ( ( ( T - gam * hight * 1.e-2 ) / ( T ) ), exp_pressure ) * p_SL; // given in hPa
-                            }else{
-                                logger()<<"WARNING: T is less than gam * hight * 1.e-2. "<< __LINE__<<" "
-                                    << __FILE__<<std::endl; 
-                                p_h = p_SL;
-                            }
-                        }
-                        else  p_h = p_SL;
+        for(int iter_prec = 1; iter_prec <= 20; iter_prec++ ){ // iter_prec may be varied
+/** condensation == water vapor saturation for cloud water formation, deposition == ice crystal for cloud ice formation **/
+            // t_0 = 273.15 K == 0 °C, t_00 = 236.15 K == -37 °C
+            double CND = ( T - t_00 ) / ( t_0 - t_00 );
+            if ( T < t_00 ) CND = 0.;
+             // T = t_00 => CND = 0 ( no condensation == no cloud water ),
+             // T = t_0 => CND = 1 ( max condensation == max cloud water )
+
+            double DEP = ( t_0 - T ) / ( t_0 - t_00 );
+            if ( T > t_0 ) DEP = 0.;
+            // T = t_0 => DEP = 0 ( no deposition == no cloud ice ),
+            // T = t_00 => DEP = 1 ( max deposition == max cloud ice )
+
+            double d_q_v = q_v_hyp - q_v_b;  // changes in water vapour causing cloud water and cloud ice
+            double d_q_c = - d_q_v * CND;
+            double d_q_i = - d_q_v * DEP;
+
+            double d_t = ( lv * d_q_c + ls * d_q_i ) / cp_l; // in K, temperature changes
+            T = T + d_t; // in K
+
+            q_v_b = c.x[ i ][ j ][ k ] + d_q_v;  // new values
+            q_c_b = cloud.x[ i ][ j ][ k ] + d_q_c;
+            q_i_b = ice.x[ i ][ j ][ k ] + d_q_i;
+
+            if ( q_v_b < 0. )  q_v_b = 0.;  // negative values excluded, when iteration starts
+            if ( q_c_b < 0. )  q_c_b = 0.;
+            if ( q_i_b < 0. )  q_i_b = 0.;
+
+            if ( i != 0 ){
+                if( T > gam * hight * 1.e-2){
+                    p_h = pow ( ( ( T - gam * hight * 1.e-2 ) / ( T ) ), exp_pressure ) * p_SL; // given in hPa
+                }else{
+                    warnings++;
+                    p_h = p_SL;
+                }
+            }
+            else  p_h = p_SL;
 
-                        E_Rain = hp * exp_func ( T, 17.2694, 35.86 ); // saturation water vapour pressure for the water phase at t > 0°C in hPa
-                        E_Ice = hp * exp_func ( T, 21.8746, 7.66 ); // saturation water vapour pressure for the ice phase in hPa
-                        q_Rain = ep * E_Rain / ( p_h - E_Rain ); // water vapour amount at saturation with water formation in kg/kg
-                        q_Ice = ep * E_Ice / ( p_h - E_Ice ); // water vapour amount at saturation with ice formation in kg/kg
+            E_Rain = hp * saturation_water.E ( T, saturation_table_exact ); // saturation water vapour pressure for the water phase at t > 0°C in hPa
+            E_Ice = hp * saturation_ice.E ( T, saturation_table_exact ); // saturation water vapour pressure for the ice phase in hPa
+            q_Rain = q_sat ( ep, E_Rain, p_h ); // water vapour amount at saturation with water formation in kg/kg
+            q_Ice = q_sat ( ep, E_Ice, p_h ); // water vapour amount at saturation with ice formation in kg/kg
 
-                        if ( ( q_c_b > 0. ) && ( q_i_b > 0. ) )
-                            q_v_hyp = ( q_c_b * q_Rain + q_i_b * q_Ice ) / ( q_c_b + q_i_b );
-                        // average amount of ater vapour based on temperature changes
-                        if ( ( q_c_b >= 0. ) && ( q_i_b == 0. ) )  q_v_hyp = q_Rain;
-                        if ( ( q_c_b == 0. ) && ( q_i_b > 0. ) )  q_v_hyp = q_Ice;
+            if ( ( q_c_b > 0. ) && ( q_i_b > 0. ) )
+                q_v_hyp = ( q_c_b * q_Rain + q_i_b * q_Ice ) / ( q_c_b + q_i_b );
+            // average amount of ater vapour based on temperature changes
+            if ( ( q_c_b >= 0. ) && ( q_i_b == 0. ) )  q_v_hyp = q_Rain;
+            if ( ( q_c_b == 0. ) && ( q_i_b > 0. ) )  q_v_hyp = q_Ice;
 
-                        // rate of condensating or evaporating water vapour to form cloud water, 0.5 given by COSMO
-//                        S_c_c.x[ i ][ j ][ k ] = .5 * d_q_c / dt_dim;
-                        S_c_c.x[ i ][ j ][ k ] = .5 * ( cn.x[ i ][ j ][ k ] - c.x[ i ][ j ][ k ] ) / dt_dim;
-                        if ( is_land ( h, i, j, k ) )  S_c_c.x[ i ][ j ][ k ] = 0.;
+            // rate of condensating or evaporating water vapour to form cloud water, 0.5 given by COSMO
+            S_c_c.x[ i ][ j ][ k ] = .5 * ( cn.x[ i ][ j ][ k ] - c.x[ i ][ j ][ k ] ) / dt_dim;
+            if ( is_land ( h, i, j, k ) )  S_c_c.x[ i ][ j ][ k ] = 0.;
 
-                        q_T = q_v_b + q_c_b + q_i_b; // total water content, not used except for print out for mass conservation test
-/*
-if ( ( i == 13 ) && ( j == 90 ) && ( k == 180 ) ){
-    logger() << "   iter_prec = " << iter_prec << endl;
-    logger() << "   CND = " << CND << "   DEP = " << DEP << "   d_t = " << d_t << endl;
-    logger() << "   d_q_v = " << d_q_v * 1000. << "   d_q_c = " << d_q_c * 1000.
-        << "   d_q_i = " << d_q_i * 1000. << "   q_v_hyp = " << q_v_hyp * 1000.
-        << "   T = " << T << endl << endl;
-    logger() << "   q_v_b = " << q_v_b * 1000. << "   q_c_b = " << q_c_b * 1000.
-        << "   q_i_b = " << q_i_b * 1000. << "   q_T = " << q_T * 1000. << endl
-        << "   ( d_q_v + d_q_c + d_q_i ) = " << ( d_q_v + d_q_c + d_q_i ) * 1000.
-        << endl << "   fabs ( q_v_b / q_v_hyp - 1. ) = " << fabs ( q_v_b / q_v_hyp - 1. )
-        << endl << endl;
-}
-*/
-                        if( iter_prec >= 3 && (q_v_hyp) > std::numeric_limits<double>::epsilon() &&
-                            fabs ( q_v_b / q_v_hyp - 1. ) <= 1.e-5 )    break;  // make sure q_v_hyp is not 0 divisor
+            if( iter_prec >= 3 && (q_v_hyp) > std::numeric_limits<double>::epsilon() &&
+                fabs ( q_v_b / q_v_hyp - 1. ) <= 1.e-5 )    break;  // make sure q_v_hyp is not 0 divisor
 
-                        q_v_b = .5 * ( q_v_hyp + q_v_b );  // has smoothing effect
-                    } // iter_prec end
+            q_v_b = .5 * ( q_v_hyp + q_v_b );  // has smoothing effect
+        } // iter_prec end
 
 /** §§§§§§§§§§§§§§§§§§§§§§§§§§§§§§§§§§     end          iterations for mixed cloud phase     §§§§§§§§§§§§§§§§§§§§§§§§§§§§§§§§§§§§§§§§§§§§§§§§ **/
 
-                    cn.x[ i ][ j ][ k ] = c.x[ i ][ j ][ k ] = q_v_b;  // new values achieved after converged iterations
-                    cloudn.x[ i ][ j ][ k ] = cloud.x[ i ][ j ][ k ] = q_c_b;
-                    icen.x[ i ][ j ][ k ] = ice.x[ i ][ j ][ k ] = q_i_b;
+        cn.x[ i ][ j ][ k ] = c.x[ i ][ j ][ k ] = q_v_b;  // new values achieved after converged iterations
+        cloudn.x[ i ][ j ][ k ] = cloud.x[ i ][ j ][ k ] = q_c_b;
+        icen.x[ i ][ j ][ k ] = ice.x[ i ][ j ][ k ] = q_i_b;
 
-                    if ( t_Celsius < t_Celsius_2 )     cloudn.x[ i ][ j ][ k ] = cloud.x[ i ][ j ][ k ] = 0.;
-                    if ( t_Celsius > 0. )                     icen.x[ i ][ j ][ k ] = ice.x[ i ][ j ][ k ] = 0.;
-                    t.x[ i ][ j ][ k ] = T / t_0;
-                } // end ( ( t_Celsius < 0. ) && ( t_Celsius >= t_Celsius_2 ) )
-            } // end i
-        } // end j
-    } // end k
+        if ( t_Celsius < t_Celsius_2 )     cloudn.x[ i ][ j ][ k ] = cloud.x[ i ][ j ][ k ] = 0.;
+        t.x[ i ][ j ][ k ] = T / t_0;
+    } // end ( ( t_Celsius < 0. ) && ( t_Celsius >= t_Celsius_2 ) )
 
-    for ( int k = 0; k < km; k++ ){
-        for ( int j = 0; j < jm; j++ ){
-            for ( int i = 0; i < im; i++ ){
-                if ( c.x[ i ][ j ][ k ] < 0. )  c.x[ i ][ j ][ k ] = 0.;  // in case negative values appear
-                if ( cloud.x[ i ][ j ][ k ] < 0. )  cloud.x[ i ][ j ][ k ] = 0.;
-                if ( ice.x[ i ][ j ][ k ] < 0. )  ice.x[ i ][ j ][ k ] = 0.;
-            }
-        }
-    }
-/*
-    logger() << "end Ice_Water_Saturation_Adjustment: water vapour max: "
-        << c.max() * 1000. << std::endl;
-    logger() << "end Ice_Water_Saturation_Adjustment: cloud water max: "
-        << cloud.max() * 1000. << std::endl;
-    logger() << "end Ice_Water_Saturation_Adjustment: cloud ice max: "
-        << ice.max() * 1000. << std::endl << std::endl;
+    if ( c.x[ i ][ j ][ k ] < 0. )  c.x[ i ][ j ][ k ] = 0.;  // in case negative values appear
+    if ( cloud.x[ i ][ j ][ k ] < 0. )  cloud.x[ i ][ j ][ k ] = 0.;
+    if ( ice.x[ i ][ j ][ k ] < 0. )  ice.x[ i ][ j ][ k ] = 0.;
 
-    logger() << "end %%%%%%%%%%%% Ice_Water_Saturation_Adjustment: temperature max: "
-    << (t.max() - 1)*t_0 << std::endl << std::endl << std::endl;
-*/
-    if(debug){
-        assert(!cloud.has_nan());
-        assert(!ice.has_nan());
-        assert(!c.has_nan());
-        assert(!t.has_nan());
-    }
+    return warnings;
 }
 
 
@@ -2870,10 +2790,61 @@ void BC_Thermo::Two_Category_Ice_Scheme ( Array &h, Array &c, Array &t, Array &p
         }
     }
 
+/******************* activity mask for the columns *********************/
+
+// a column without cloud water and cloud ice, which is subsaturated with respect to ice where t <= 0°C, forms neither rain
+// nor snow, all precipitation fluxes and rates vanish except for the condensation rate S_c_c
+// q_Ice is smallest at the surface pressure p_SL, so comparing with it avoids the pressure profile and is on the safe side
+    std::vector<char> column_active ( jm * km );
+    int skipped_columns = 0;
+
+    for ( int k = 0; k < km; k++ ){
+        for ( int j = 0; j < jm; j++ ){
+            double p_SL = .01 * ( r_air * R_Air * t.x[ 0 ][ j ][ k ] * t_0 ); // given in hPa
+            bool active = false;
+            for ( int i = 0; i < im-1; i++ ){
+                if ( ( cloud.x[ i ][ j ][ k ] != 0. ) || ( ice.x[ i ][ j ][ k ] != 0. ) ){
+                    active = true;
+                    break;
+                }
+                double t_u = t.x[ i ][ j ][ k ] * t_0;
+                if ( t_u <= t_0 ){
+                    double E_Ice = hp * saturation_ice.E ( t_u, saturation_table_exact );
+                    if ( ( p_SL <= E_Ice ) || ( c.x[ i ][ j ][ k ] >= q_sat ( ep, E_Ice, p_SL ) ) ){
+                        active = true;
+                        break;
+                    }
+                }
+            }
+            column_active[ j * km + k ] = active;
+            if ( active )  continue;
+
+            skipped_columns++;
+            for ( int i = 0; i < im; i++ ){
+                P_rain.x[ i ][ j ][ k ] = 0.;
+                P_snow.x[ i ][ j ][ k ] = 0.;
+                S_r.x[ i ][ j ][ k ] = 0.;
+                S_s.x[ i ][ j ][ k ] = 0.;
+            }
+            for ( int i = 0; i < im-1; i++ ){
+                if ( ( is_land ( h, i, j, k ) ) && ( is_land ( h, i+1, j, k ) ) )  S_c_c.x[ i ][ j ][ k ] = 0.;
+                S_v.x[ i ][ j ][ k ] = - S_c_c.x[ i ][ j ][ k ];
+                S_c.x[ i ][ j ][ k ] = S_c_c.x[ i ][ j ][ k ];
+                S_i.x[ i ][ j ][ k ] = 0.;
+            }
+        }
+    }
+    S_i_dep = 0.;  // as left behind by the parameterization of an inactive column
+
+    logger() << "Two_Category_Ice_Scheme: inactive columns skipped: " << skipped_columns << " of " << jm * km
+        << " ( " << 100. * skipped_columns / ( jm * km ) << " % )" << std::endl;
+
 /******************* initial values for rain and snow calculation *********************/
 
     for ( int k = 0; k < km; k++ ){
         for ( int j = 0; j < jm; j++ ){
+            if ( !column_active[ j * km + k ] )  continue;
+
             P_rain.x[ im-1 ][ j ][ k ] = 0.;
             P_snow.x[ im-1 ][ j ][ k ] = 0.;
             S_r.x[ im-1 ][ j ][ k ] = 0.;
@@ -2896,10 +2867,10 @@ void BC_Thermo::Two_Category_Ice_Scheme ( Array &h, Array &c, Array &t, Array &p
                 r_dry = 100. * p_h / ( R_Air * t_u );  // density of dry air in kg/m³
                 r_humid = r_dry * ( 1. + c.x[ i ][ j ][ k ] ) / ( 1. + R_WaterVapour / R_Air * c.x[ i ][ j ][ k ] );
                 q_h = c.x[ i ][ j ][ k ];  // threshold value for water vapour at local hight h in kg/kg
-                E_Rain = hp * exp_func ( t_u, 17.2694, 35.86 );  // saturation water vapour pressure for the water phase at t > 0°C in hPa
-                E_Ice = hp * exp_func ( t_u, 21.8746, 7.66 );  // saturation water vapour pressure for the ice phase in hPa
-                q_Rain  = ep * E_Rain / ( p_h - E_Rain );  // water vapour amount at saturation with water formation in kg/kg
-                q_Ice  = ep * E_Ice / ( p_h - E_Ice );  // water vapour amount at saturation with ice formation in kg/kg
+                E_Rain = hp * saturation_water.E ( t_u, saturation_table_exact );  // saturation water vapour pressure for the water phase at t > 0°C in hPa
+                E_Ice = hp * saturation_ice.E ( t_u, saturation_table_exact );  // saturation water vapour pressure for the ice phase in hPa
+                q_Rain  = q_sat ( ep, E_Rain, p_h );  // water vapour amount at saturation with water formation in kg/kg
+                q_Ice  = q_sat ( ep, E_Ice, p_h );  // water vapour amount at saturation with ice formation in kg/kg
 
                 if ( ( t_u >= t_0 ) && ( c_c_au * cloud.x[ i ][ j ][ k ] > 0. ) )
                     S_c_au = c_c_au * cloud.x[ i ][ j ][ k ];
@@ -2960,6 +2931,8 @@ void BC_Thermo::Two_Category_Ice_Scheme ( Array &h, Array &c, Array &t, Array &p
         for(int iter_prec = 1; iter_prec <= 5; iter_prec++ ){ // iter_prec may be varied, but is sufficient
             for ( int k = 0; k < km; k++ ){
                 for ( int j = 0; j < jm; j++ ){
+                    if ( !column_active[ j * km + k ] )  continue;
+
                     P_rain.x[ im-1 ][ j ][ k ] = 0.;
                     P_snow.x[ im-1 ][ j ][ k ] = 0.;
 
@@ -2976,10 +2949,10 @@ void BC_Thermo::Two_Category_Ice_Scheme ( Array &h, Array &c, Array &t, Array &p
                         r_dry = 100. * p_h / ( R_Air * t_u );  // density of dry air in kg/m³
                         r_humid = r_dry * ( 1. + c.x[ i ][ j ][ k ] ) / ( 1. + R_WaterVapour / R_Air * c.x[ i ][ j ][ k ] );
                         q_h = c.x[ i ][ j ][ k ];  // threshold value for water vapour at local hight h in kg/kg
-                        E_Rain = hp * exp_func ( t_u, 17.2694, 35.86 );  // saturation water vapour pressure for the water phase at t > 0°C in hPa
-                        E_Ice = hp * exp_func ( t_u, 21.8746, 7.66 );  // saturation water vapour pressure for the ice phase in hPa
-                        q_Rain = ep * E_Rain / ( p_h - E_Rain );  // water vapour amount at saturation with water formation in kg/kg
-                        q_Ice  = ep * E_Ice / ( p_h - E_Ice );  // water vapour amount at saturation with ice formation in kg/kg
+                        E_Rain = hp * saturation_water.E ( t_u, saturation_table_exact );  // saturation water vapour pressure for the water phase at t > 0°C in hPa
+                        E_Ice = hp * saturation_ice.E ( t_u, saturation_table_exact );  // saturation water vapour pressure for the ice phase in hPa
+                        q_Rain = q_sat ( ep, E_Rain, p_h );  // water vapour amount at saturation with water formation in kg/kg
+                        q_Ice  = q_sat ( ep, E_Ice, p_h );  // water vapour amount at saturation with ice formation in kg/kg
 
 // ice and snow average size
                         if ( t_u <= t_0 )  N_i = N_i_0 * exp ( .2 * ( t_0 - t_u ) );
@@ -2992,6 +2965,7 @@ void BC_Thermo::Two_Category_Ice_Scheme ( Array &h, Array &c, Array &t, Array &p
                         }
 
 // nucleation and depositional growth of cloud ice
+                        S_nuc = 0.;
                         if ( ice.x[ i ][ j ][ k ] == 0. ){
                             if ( ( t_u < t_d ) && ( c.x[ i ][ j ][ k ] >= q_Ice ) )
                                 S_nuc = m_i_0 / ( r_humid * dt_snow_dim ) * N_i;  // nucleation of cloud ice, < I >
@@ -3074,7 +3048,7 @@ void BC_Thermo::Two_Category_Ice_Scheme ( Array &h, Array &c, Array &t, Array &p
                             p_SL = .01 * ( r_air * R_Air * t.x[ 0 ][ j ][ k ] * t_0 );  // given in hPa
                             hight = ( double ) i * ( L_atm / ( double ) ( im-1 ) );
                             p_t_in = pow ( ( ( t_0 - gam * hight * 1.e-2 ) / t_0 ), exp_pressure ) * p_SL;  // given in hPa
-                            E_Rain_t_in = hp * exp_func ( t_0, 17.2694, 35.86 );
+                            E_Rain_t_in = hp * saturation_water.E ( t_0, saturation_table_exact );
                                 // saturation water vapour pressure for the water phase at t = 0°C in hPa
                             q_Rain_t_in = ep * E_Rain_t_in / ( p_t_in - E_Rain_t_in );
                                 // water vapour amount at saturation with water formation in kg/kg
@@ -45,6 +45,9 @@ class BC_Thermo
         int n_smooth;
         int j_r, k_r, j_sun;
         int RadiationModel, sun_position_lat, sun_position_lon, declination, NASATemperature;
+        bool debug;
+        int math_accuracy;
+        bool saturation_table_exact;
         
         int *im_tropopause;
         std::vector<std::vector<int> > i_topography;
@@ -63,7 +66,7 @@ class BC_Thermo
             d_j_75s, d_j_30s, d_j_60n, d_j_60s, d_j_90n, d_j_90s, d_diff;
         double t_cretaceous, t_cretaceous_eff;
         double j_par_f, j_pol_f, e, a, j_d, t_dd, k_par_f, k_pol_f;
-        double g, ep, hp, u_0, p_0, t_0, sigma, cp_l, r_air, L_atm, c13, c43;
+        double g, ep, hp, u_0, p_0, t_0, sigma, cp_l, r_air, L_atm, c13, c43, t_land, c_land, co2_0;
         double R_Air, r_h, r_water_vapour, R_WaterVapour, precipitablewater_average,
             precipitation_average, precipitation_NASA_average;
         double eps, c_ocean, c_coeff, t_average, co2_average,
@@ -99,6 +102,9 @@ class BC_Thermo
         double coeff_P;
         double coeff_Lv, coeff_Ls, coeff_Q, N_i;
 
+        int Saturation_Adjustment_Cell ( int i, int j, int k, double p_SL, double p_h, Array &h, Array &c,
+            Array &cn, Array &cloud, Array &cloudn, Array &ice, Array &icen, Array &t, Array &S_c_c ) const;
+
     public:
         BC_Thermo (cAtmosphereModel* model, int im, int jm, int km, Array& h);
 
@@ -12,8 +12,11 @@
 #include <iostream>
 #include <iomanip>
 #include <cstring>
+#include <cstdlib>
 
 #include "MinMax_Atm.h"
+#include "TraceRecorder.h"
+#include "Utils.h"
 
 using namespace std;
 
@@ -46,6 +49,79 @@ namespace{
         }
         return ret;
     }
+
+    void print_line ( const string &name_maxValue, const string &name_minValue, const string &name_unitValue, 
+                      double maxValue, int imax, int jmax, int kmax, double minValue, int imin, int jmin, int kmin )
+    {
+        int imax_level = imax * 400;
+        int imin_level = imin * 400;
+
+        //  maximum latitude and longitude units recalculated
+        HemisphereCoords coords = convert_coords(kmax, jmax);
+        int jmax_deg = coords.lat;
+        string deg_lat_max = coords.north_or_south;
+        int kmax_deg = coords.lon;
+        string deg_lon_max = coords.east_or_west;
+
+        //  minimum latitude and longitude units recalculated
+        coords = convert_coords(kmin, jmin);
+        int jmin_deg = coords.lat;
+        string deg_lat_min= coords.north_or_south;
+        int kmin_deg = coords.lon;
+        string deg_lon_min = coords.east_or_west;
+
+        AtomUtils::get_output().precision ( 6 );
+
+        AtomUtils::get_output() << setiosflags ( ios::left ) << setw ( 26 ) << setfill ( '.' ) << name_maxValue << " = " << 
+            resetiosflags ( ios::left ) << setw ( 12 ) << fixed << setfill ( ' ' ) << maxValue << setw ( 6 ) << 
+            name_unitValue << setw ( 5 ) << jmax_deg << setw ( 3 ) << deg_lat_max << setw ( 4 ) << kmax_deg << 
+            setw ( 3 ) << deg_lon_max << setw ( 6 ) << imax_level << setw ( 2 ) << level << "          " << 
+            setiosflags ( ios::left ) << setw ( 26 ) << setfill ( '.' ) << name_minValue << " = "<< 
+            resetiosflags ( ios::left ) << setw ( 12 ) << fixed << setfill ( ' ' ) << minValue << setw ( 6 ) << 
+            name_unitValue << setw ( 5 )  << jmin_deg << setw ( 3 ) << deg_lat_min << setw ( 4 ) << kmin_deg << 
+            setw ( 3 ) << deg_lon_min  << setw ( 6 ) << imin_level << setw ( 2 ) << level << endl;
+    }
+
+    //  extremum of a field and its location as index in the order j, k, i the fields were searched in,
+    //  the first location of equal values wins
+    struct Extremum{
+        double maxValue, minValue;
+        long max_index, min_index;
+    };
+
+    void update ( Extremum &e, double value, long index )
+    {
+        if ( value > e.maxValue || ( value == e.maxValue && index < e.max_index ) ){
+            e.maxValue = value;
+            e.max_index = index;
+        }
+        if ( value < e.minValue || ( value == e.minValue && index < e.min_index ) ){
+            e.minValue = value;
+            e.min_index = index;
+        }
+    }
+
+    void merge ( Extremum &e, const Extremum &other )
+    {
+        if ( other.maxValue > e.maxValue || ( other.maxValue == e.maxValue && other.max_index < e.max_index ) ){
+            e.maxValue = other.maxValue;
+            e.max_index = other.max_index;
+        }
+        if ( other.minValue < e.minValue || ( other.minValue == e.minValue && other.min_index < e.min_index ) ){
+            e.minValue = other.minValue;
+            e.min_index = other.min_index;
+        }
+    }
+
+    //  name of a field in the JSON object, the name of its maximum without " max "
+    string json_name ( const string &name_maxValue )
+    {
+        size_t begin = name_maxValue.find_first_not_of ( ' ' );
+        size_t end = name_maxValue.find_last_not_of ( ' ' );
+        string name = begin == string::npos ? string() : name_maxValue.substr ( begin, end - begin + 1 );
+        if ( name.compare ( 0, 4, "max " ) == 0 )  name = name.substr ( 4 );
+        return name;
+    }
 }
 
 MinMax_Atm::MinMax_Atm ( int jm, int km )
@@ -101,40 +177,14 @@ void MinMax_Atm::searchMinMax_3D( string name_maxValue, string name_minValue, st
         }
     }
 
-    int imax_level = imax * 400;
-    int imin_level = imin * 400;
-
-    //  maximum latitude and longitude units recalculated
-    HemisphereCoords coords = convert_coords(kmax, jmax);
-    int jmax_deg = coords.lat;
-    string deg_lat_max = coords.north_or_south;
-    int kmax_deg = coords.lon;
-    string deg_lon_max = coords.east_or_west;
-
-    //  minimum latitude and longitude units recalculated
-    coords = convert_coords(kmin, jmin);
-    int jmin_deg = coords.lat;
-    string deg_lat_min= coords.north_or_south;
-    int kmin_deg = coords.lon;
-    string deg_lon_min = coords.east_or_west;
-
-    cout.precision ( 6 );
-
     if(print_heading){
-        cout << endl << heading_1 << endl << heading_2 << endl << endl;
+        AtomUtils::get_output() << endl << heading_1 << endl << heading_2 << endl << endl;
     }
 
     maxValue = lambda(maxValue * coeff);
     minValue = lambda(minValue * coeff);
 
-    cout << setiosflags ( ios::left ) << setw ( 26 ) << setfill ( '.' ) << name_maxValue << " = " << 
-        resetiosflags ( ios::left ) << setw ( 12 ) << fixed << setfill ( ' ' ) << maxValue << setw ( 6 ) << 
-        name_unitValue << setw ( 5 ) << jmax_deg << setw ( 3 ) << deg_lat_max << setw ( 4 ) << kmax_deg << 
-        setw ( 3 ) << deg_lon_max << setw ( 6 ) << imax_level << setw ( 2 ) << level << "          " << 
-        setiosflags ( ios::left ) << setw ( 26 ) << setfill ( '.' ) << name_minValue << " = "<< 
-        resetiosflags ( ios::left ) << setw ( 12 ) << fixed << setfill ( ' ' ) << minValue << setw ( 6 ) << 
-        name_unitValue << setw ( 5 )  << jmin_deg << setw ( 3 ) << deg_lat_min << setw ( 4 ) << kmin_deg << 
-        setw ( 3 ) << deg_lon_min  << setw ( 6 ) << imin_level << setw ( 2 ) << level << endl;
+    print_line ( name_maxValue, name_minValue, name_unitValue, maxValue, imax, jmax, kmax, minValue, imin, jmin, kmin );
 }
 
 void MinMax_Atm::searchMinMax_2D ( string name_maxValue, string name_minValue, string name_unitValue, 
@@ -160,36 +210,10 @@ void MinMax_Atm::searchMinMax_2D ( string name_maxValue, string name_minValue, s
         }
     }
 
-    int imax_level = 0;
-    int imin_level = 0;
-
-    //  maximum latitude and longitude units recalculated
-    HemisphereCoords coords = convert_coords(kmax, jmax);
-    int jmax_deg = coords.lat;
-    string deg_lat_max = coords.north_or_south;
-    int kmax_deg = coords.lon;
-    string deg_lon_max = coords.east_or_west;
-
-    //  minimum latitude and longitude units recalculated
-    coords = convert_coords(kmin, jmin);
-    int jmin_deg = coords.lat;
-    string deg_lat_min= coords.north_or_south;
-    int kmin_deg = coords.lon;
-    string deg_lon_min = coords.east_or_west;
-
-    cout.precision ( 6 );
-
     maxValue = maxValue * coeff;
     minValue = minValue * coeff;
 
-    cout << setiosflags ( ios::left ) << setw ( 26 ) << setfill ( '.' ) << name_maxValue << " = " << 
-        resetiosflags ( ios::left ) << setw ( 12 ) << fixed << setfill ( ' ' ) << maxValue << setw ( 6 ) << 
-        name_unitValue << setw ( 5 ) << jmax_deg << setw ( 3 ) << deg_lat_max << setw ( 4 ) << kmax_deg << 
-        setw ( 3 ) << deg_lon_max << setw ( 6 ) << imax_level << setw ( 2 ) << level << "          " << 
-        setiosflags ( ios::left ) << setw ( 26 ) << setfill ( '.' ) << name_minValue << " = "<< 
-        resetiosflags ( ios::left ) << setw ( 12 ) << fixed << setfill ( ' ' ) << minValue << setw ( 6 ) << 
-        name_unitValue << setw ( 5 )  << jmin_deg << setw ( 3 ) << deg_lat_min << setw ( 4 ) << kmin_deg << 
-        setw ( 3 ) << deg_lon_min  << setw ( 6 ) << imin_level << setw ( 2 ) << level << endl;
+    print_line ( name_maxValue, name_minValue, name_unitValue, maxValue, 0, jmax, kmax, minValue, 0, jmin, kmin );
 }
 
 double MinMax_Atm::out_maxValue (  ) const
@@ -202,3 +226,157 @@ double MinMax_Atm::out_minValue (  ) const
     return minValue;
 }
 
+
+
+Diagnostics_Atm::Diagnostics_Atm ( int im, int jm, int km )
+{
+    this-> im = im;
+    this-> jm = jm;
+    this-> km = km;
+}
+
+Diagnostics_Atm::~Diagnostics_Atm () {}
+
+void Diagnostics_Atm::add_text ( string text )
+{
+    Entry entry;
+    entry.text = text;
+    entry.field_3D = NULL;
+    entry.field_2D = NULL;
+    entry.coeff = 1.;
+    entry.print_heading = false;
+    entry.maxValue = entry.minValue = 0.;
+    entry.imax = entry.jmax = entry.kmax = entry.imin = entry.jmin = entry.kmin = 0;
+    entries.push_back ( entry );
+}
+
+void Diagnostics_Atm::add_3D ( string name_maxValue, string name_minValue, string name_unitValue, 
+                               Array &value_D, double coeff, 
+                               std::function< double(double) > lambda,
+                               bool print_heading )
+{
+    add_text ( "" );
+    Entry &entry = entries.back();
+    entry.name_maxValue = name_maxValue;
+    entry.name_minValue = name_minValue;
+    entry.name_unitValue = name_unitValue;
+    entry.field_3D = &value_D;
+    entry.coeff = coeff;
+    entry.lambda = lambda;
+    entry.print_heading = print_heading;
+}
+
+void Diagnostics_Atm::add_2D ( string name_maxValue, string name_minValue, string name_unitValue, 
+                               Array_2D &value, double coeff )
+{
+    add_text ( "" );
+    Entry &entry = entries.back();
+    entry.name_maxValue = name_maxValue;
+    entry.name_minValue = name_minValue;
+    entry.name_unitValue = name_unitValue;
+    entry.field_2D = &value;
+    entry.coeff = coeff;
+    entry.lambda = default_lambda;
+}
+
+void Diagnostics_Atm::search (  )
+{
+    // all fields are searched in one pass over the latitudes, each thread searches its share and the extrema of
+    // the threads are merged, the 2D fields are searched on the sea surface without the boundary rows and columns
+    const int n_entries = entries.size();
+    std::vector<Extremum> extrema ( n_entries );
+    for ( int n = 0; n < n_entries; n++ ){
+        const Entry &entry = entries[ n ];
+        double start = entry.field_3D ? entry.field_3D->x[ 0 ][ 0 ][ 0 ] : entry.field_2D ? entry.field_2D->y[ 0 ][ 0 ] : 0.;
+        Extremum e = { start, start, 0, 0 };
+        extrema[ n ] = e;
+    }
+
+    #pragma omp parallel
+    {
+        std::vector<Extremum> local ( extrema );
+
+        // the share of each thread in the timeline, nowait ends it before the threads merge their extrema
+        {
+            AtomUtils::TraceScope chunk_trace ( "Diagnostics_Atm rows", "kernel" );
+            #pragma omp for schedule ( static ) nowait
+            for ( int j = 0; j < jm; j++ ){
+                for ( int n = 0; n < n_entries; n++ ){
+                    const Entry &entry = entries[ n ];
+                    if ( entry.field_3D ){
+                        for ( int i = 0; i < im; i++ ){
+                            const double *row = entry.field_3D->x[ i ][ j ];
+                            for ( int k = 0; k < km; k++ ){
+                                update ( local[ n ], row[ k ], ( long ( j ) * km + k ) * im + i );
+                            }
+                        }
+                    }else if ( entry.field_2D && j > 0 && j < jm - 1 ){
+                        const double *row = entry.field_2D->y[ j ];
+                        for ( int k = 1; k < km - 1; k++ ){
+                            update ( local[ n ], row[ k ], long ( j ) * km + k );
+                        }
+                    }
+                }
+            }
+        }
+
+        #pragma omp critical
+        for ( int n = 0; n < n_entries; n++ ){
+            merge ( extrema[ n ], local[ n ] );
+        }
+    }
+
+    for ( int n = 0; n < n_entries; n++ ){
+        Entry &entry = entries[ n ];
+        if ( !entry.field_3D && !entry.field_2D )  continue;
+        const Extremum &e = extrema[ n ];
+        int i_dim = entry.field_3D ? im : 1;
+        entry.imax = e.max_index % i_dim;
+        entry.kmax = ( e.max_index / i_dim ) % km;
+        entry.jmax = e.max_index / i_dim / km;
+        entry.imin = e.min_index % i_dim;
+        entry.kmin = ( e.min_index / i_dim ) % km;
+        entry.jmin = e.min_index / i_dim / km;
+        entry.maxValue = entry.lambda ( e.maxValue * entry.coeff );
+        entry.minValue = entry.lambda ( e.minValue * entry.coeff );
+    }
+}
+
+void Diagnostics_Atm::print (  ) const
+{
+    for ( size_t n = 0; n < entries.size(); n++ ){
+        const Entry &entry = entries[ n ];
+        AtomUtils::get_output() << entry.text;
+        if ( !entry.field_3D && !entry.field_2D )  continue;
+        if ( entry.print_heading ){
+            AtomUtils::get_output() << endl << heading_1 << endl << heading_2 << endl << endl;
+        }
+        print_line ( entry.name_maxValue, entry.name_minValue, entry.name_unitValue, entry.maxValue, 
+                     entry.imax, entry.jmax, entry.kmax, entry.minValue, entry.imin, entry.jmin, entry.kmin );
+    }
+}
+
+void Diagnostics_Atm::write_json ( std::ostream &os, int Ma, int n ) const
+{
+    os << std::setprecision ( 9 ) << "{\"Ma\": " << Ma << ", \"n\": " << n << ", \"fields\": {";
+    bool first = true;
+    for ( size_t m = 0; m < entries.size(); m++ ){
+        const Entry &entry = entries[ m ];
+        if ( !entry.field_3D && !entry.field_2D )  continue;
+        os << ( first ? "" : ", " ) << "\"" << json_name ( entry.name_maxValue ) << "\": {\"unit\": \"" 
+           << entry.name_unitValue << "\", \"max\": " << entry.maxValue << ", \"max_at\": [" << entry.imax << ", " 
+           << entry.jmax << ", " << entry.kmax << "], \"min\": " << entry.minValue << ", \"min_at\": [" 
+           << entry.imin << ", " << entry.jmin << ", " << entry.kmin << "]}";
+        first = false;
+    }
+    os << "}}\n";
+}
+
+double Diagnostics_Atm::out_maxValue ( const string &name_maxValue ) const
+{
+    for ( size_t n = 0; n < entries.size(); n++ ){
+        if ( entries[ n ].name_maxValue == name_maxValue )  return entries[ n ].maxValue;
+    }
+    std::cerr << "ERROR: no diagnostics of " << name_maxValue << "\n";
+    abort();
+}
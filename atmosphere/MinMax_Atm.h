@@ -11,6 +11,7 @@
 #include <functional>
 #include <iostream>
 #include <cstring>
+#include <vector>
 
 #include "Array.h"
 #include "Array_2D.h"
@@ -45,4 +46,47 @@ class MinMax_Atm
 
         double out_minValue (  ) const;
 };
+
+//  extrema and their locations of all added fields searched in one parallel pass over the grid, the printout is
+//  the one of MinMax_Atm, the locations are the same as searching the fields one after the other
+class Diagnostics_Atm
+{
+    private:
+        struct Entry{
+            string name_maxValue, name_minValue, name_unitValue;
+            string text;                    // printed before the field, an entry without a field only prints it
+            Array *field_3D;
+            Array_2D *field_2D;
+            double coeff;
+            std::function< double(double) > lambda;
+            bool print_heading;
+            double maxValue, minValue;      // in the units of the printout
+            int imax, jmax, kmax, imin, jmin, kmin;
+        };
+
+        int im, jm, km;
+        std::vector<Entry> entries;
+
+    public:
+        Diagnostics_Atm ( int, int, int );
+        ~Diagnostics_Atm ();
+
+        void add_text ( string text );
+
+        void add_3D ( string , string , string , Array &, 
+                      double coeff=1.0, 
+                      std::function< double(double) > lambda = default_lambda,
+                      bool print_heading=false );
+
+        void add_2D ( string , string , string , Array_2D &, double coeff=1.0 );
+
+        void search (  );
+
+        void print (  ) const;
+
+        //  one JSON object of the extrema and their locations ( i, j, k ) of all fields
+        void write_json ( std::ostream &os, int Ma, int n ) const;
+
+        double out_maxValue ( const string &name_maxValue ) const;
+};
 #endif
@@ -16,83 +16,84 @@
 
 #include "PostProcess_Atm.h"
 #include "Utils.h"
+#include "Thermo.h"
+#include "VtkWriter.h"
 
 using namespace std;
 using namespace AtomUtils;
 
-PostProcess_Atmosphere::PostProcess_Atmosphere( int im, int jm, int km, string &output_path )
+PostProcess_Atmosphere::PostProcess_Atmosphere( int im, int jm, int km, string &output_path, int vtk_format, bool vtk_float64 )
 {
     this->im = im;
     this->jm = jm;
     this->km = km;
     this->output_path = output_path;
+    this->vtk_format = vtk_format;
+    this->vtk_float64 = vtk_float64;
 }
 
 PostProcess_Atmosphere::~PostProcess_Atmosphere(){}
 
-void PostProcess_Atmosphere::dump_array( const string &name, Array &a, double multiplier, ofstream &f )
+void PostProcess_Atmosphere::dump_array( const string &name, Array &a, double multiplier, VtsWriter &vts )
 {
-    f <<  "    <DataArray type=\"Float32\" Name=\"" << name << "\" format=\"ascii\">\n";
+    vts.begin_array ( name );
 
     for (int k = 0; k < km; k++) {
         for (int j = 0; j < jm; j++) {
             for (int i = 0; i < im; i++) {
-                f << (a.x[i][j][k] * multiplier) << endl;
+                vts.value ( a.x[i][j][k] * multiplier );
             }
-            f << "\n";
         }
-        f << "\n";
     }
-    f << "\n";
-    f << "    </DataArray>\n";
+    vts.end_array ( );
 }
 
-void PostProcess_Atmosphere::dump_radial( const string &desc, Array &a, double multiplier, int i, ofstream &f )
+void PostProcess_Atmosphere::dump_radial( const string &desc, Array &a, double multiplier, int i, VtkLegacyWriter &vtk )
 {
-    f << "SCALARS " << desc << " float " << 1 << endl;
-    f << "LOOKUP_TABLE default" << endl;
+    vtk.scalars ( desc );
 
     for (int j = 0; j < jm; j++) {
         for (int k = 0; k < km; k++) {
-            f << (a.x[i][j][k] * multiplier) << endl;
+            vtk.value ( a.x[i][j][k] * multiplier );
         }
     }
+    vtk.end_values ( );
 }
 
-void PostProcess_Atmosphere::dump_radial_2d( const string &desc, Array_2D &a, double multiplier, ofstream &f )
+void PostProcess_Atmosphere::dump_radial_2d( const string &desc, Array_2D &a, double multiplier, VtkLegacyWriter &vtk )
 {
-    f << "SCALARS " << desc << " float " << 1 << endl;
-    f << "LOOKUP_TABLE default" << endl;
+    vtk.scalars ( desc );
 
     for (int j = 0; j < jm; j++) {
         for (int k = 0; k < km; k++) {
-            f << (a.y[j][k] * multiplier) << endl;
+            vtk.value ( a.y[j][k] * multiplier );
         }
     }
+    vtk.end_values ( );
 }
 
-void PostProcess_Atmosphere::dump_zonal( const string &desc, Array &a, double multiplier, int k, ofstream &f )
+void PostProcess_Atmosphere::dump_zonal( const string &desc, Array &a, double multiplier, int k, VtkLegacyWriter &vtk )
 {
-    f <<  "SCALARS " << desc << " float " << 1 << endl;
-    f <<  "LOOKUP_TABLE default" << endl;
+    vtk.scalars ( desc );
 
     for ( int i = 0; i < im; i++ ) {
         for ( int j = 0; j < jm; j++ ) {
-            f << (a.x[ i ][ j ][ k ] * multiplier) << endl;
+            vtk.value ( a.x[ i ][ j ][ k ] * multiplier );
         }
     }
+    vtk.end_values ( );
 }
 
-void PostProcess_Atmosphere::dump_longal( const string &desc, Array &a, double multiplier, int j, ofstream &f )
+void PostProcess_Atmosphere::dump_longal( const string &desc, Array &a, double multiplier, int j, VtkLegacyWriter &vtk )
 {
-    f << "SCALARS " << desc << " float " << 1 << endl;
-    f << "LOOKUP_TABLE default" << endl;
+    vtk.scalars ( desc );
 
     for (int i = 0; i < im; i++) {
         for (int k = 0; k < km; k++) {
-            f << (a.x[i][j][k] * multiplier) << endl;
+            vtk.value ( a.x[i][j][k] * multiplier );
         }
     }
+    vtk.end_values ( );
 }
 
 void PostProcess_Atmosphere::Atmosphere_v_w_Transfer ( string &Name_Bathymetry_File, double u_0, Array &v, Array &w, Array &t, Array &p_dyn, Array_2D &Evaporation_Dalton, Array_2D &Precipitation )
@@ -104,7 +105,7 @@ void PostProcess_Atmosphere::Atmosphere_v_w_Transfer ( string &Name_Bathymetry_F
     v_w_Transfer_File.open(Name_v_w_Transfer_File);
 
     if (!v_w_Transfer_File.is_open()) {
-        cout << "ERROR: transfer file name in atmosphere: " << Name_v_w_Transfer_File << "\n";
+        get_output() << "ERROR: transfer file name in atmosphere: " << Name_v_w_Transfer_File << "\n";
         cerr << "ERROR: could not open transfer file " << __FILE__ << " at line " << __LINE__ << "\n";
         abort();
     }
@@ -133,16 +134,17 @@ void PostProcess_Atmosphere::paraview_panorama_vts (string &Name_Bathymetry_File
         abort();
     }
 
+    VtsWriter vts ( Atmosphere_panorama_vts_File, vtk_format, vtk_float64 );
+
     Atmosphere_panorama_vts_File <<  "<?xml version=\"1.0\"?>\n"  << endl;
-    Atmosphere_panorama_vts_File <<  "<VTKFile type=\"StructuredGrid\" version=\"0.1\" byte_order=\"LittleEndian\">\n"  << endl;
+    Atmosphere_panorama_vts_File <<  "<VTKFile type=\"StructuredGrid\" version=\"0.1\"" << vts.file_attributes ( ) << ">\n"  << endl;
     Atmosphere_panorama_vts_File <<  " <StructuredGrid WholeExtent=\"" << 1 << " "<< im << " "<< 1 << " " << jm << " "<< 1 << " " << km << "\">\n"  << endl;
     Atmosphere_panorama_vts_File <<  "  <Piece Extent=\"" << 1 << " "<< im << " "<< 1 << " " << jm << " "<< 1 << " " << km << "\">\n"  << endl;
 
     Atmosphere_panorama_vts_File <<  "   <PointData Vectors=\"Velocity\" Scalars=\"Topography u-component v-component w-component Temperature CondensationTemp EvaporationTemp Epsilon_3D PressureDynamic PressureStatic WaterVapour CloudWater CloudIce CO2-Concentration Q_Latent Rain RainSuper Ice PrecipitationRain PrecipitationSnow PrecipitationConv Updraft Downdraft\">\n"  << endl;
 
 // writing u, v und w velocity components in cartesian coordinates
-    Atmosphere_panorama_vts_File <<  "    <DataArray type=\"Float32\" NumberOfComponents=\"3\" Name=\"Velocity\" format=\"ascii\">\n"  << endl;
-
+    vts.begin_array ( "Velocity", 3 );
 
     for ( int k = 0; k < km; k++ )
     {
@@ -151,54 +153,48 @@ void PostProcess_Atmosphere::paraview_panorama_vts (string &Name_Bathymetry_File
             for ( int i = 0; i < im; i++ )
             {
 // transformtion from spherical to cartesian coordinates for representation in ParaView
-                Atmosphere_panorama_vts_File << u.x[ i ][ j ][ k ] << " " << v.x[ i ][ j ][ k ] << " " << w.x[ i ][ j ][ k ] << endl;
+                vts.value ( u.x[ i ][ j ][ k ], v.x[ i ][ j ][ k ], w.x[ i ][ j ][ k ] );
             }
-            Atmosphere_panorama_vts_File <<  "\n"  << endl;
         }
-        Atmosphere_panorama_vts_File <<  "\n"  << endl;
     }
-    Atmosphere_panorama_vts_File <<  "\n"  << endl;
-    Atmosphere_panorama_vts_File <<  "    </DataArray>\n" << endl;
+    vts.end_array ( );
 
 
-    dump_array("Topography", h, 1.0, Atmosphere_panorama_vts_File);
-    dump_array("u-component", u, 1.0, Atmosphere_panorama_vts_File);
-    dump_array("v-component", v, 1.0, Atmosphere_panorama_vts_File);
-    dump_array("w-component", w, 1.0, Atmosphere_panorama_vts_File);
+    dump_array("Topography", h, 1.0, vts);
+    dump_array("u-component", u, 1.0, vts);
+    dump_array("v-component", v, 1.0, vts);
+    dump_array("w-component", w, 1.0, vts);
 
 // writing of temperature
-    Atmosphere_panorama_vts_File <<  "    <DataArray type=\"Float32\" Name=\"Temperature\" format=\"ascii\">\n"  << endl;
+    vts.begin_array ( "Temperature" );
     for ( int k = 0; k < km; k++ )
     {
         for ( int j = 0; j < jm; j++ )
         {
             for ( int i = 0; i < im; i++ )
             {
-                Atmosphere_panorama_vts_File << t.x[ i ][ j ][ k ] * t_0 - t_0 << endl;
+                vts.value ( t.x[ i ][ j ][ k ] * t_0 - t_0 );
             }
-            Atmosphere_panorama_vts_File <<  "\n"  << endl;
         }
-        Atmosphere_panorama_vts_File <<  "\n"  << endl;
     }
-    Atmosphere_panorama_vts_File <<  "\n"  << endl;
-    Atmosphere_panorama_vts_File <<  "    </DataArray>\n" << endl;
-
-    dump_array("Epsilon_3D", epsilon_3D, 1.0, Atmosphere_panorama_vts_File);
-    dump_array("WaterVapour", c, 1000.0, Atmosphere_panorama_vts_File);
-    dump_array("CloudWater", cloud, 1000.0, Atmosphere_panorama_vts_File);
-    dump_array("CloudIce", ice, 1000.0, Atmosphere_panorama_vts_File);
-    dump_array("PrecipitationRain", P_rain, 86400., Atmosphere_panorama_vts_File);
-    dump_array("PrecipitationSnow", P_snow, 86400., Atmosphere_panorama_vts_File);
-    dump_array("PressureDynamic", p_dyn, u_0 * u_0 * r_air *.01, Atmosphere_panorama_vts_File);
-    dump_array("PressureStatic", p_stat, 1.0, Atmosphere_panorama_vts_File);
-    dump_array("BuoyancyForce", BuoyancyForce, 1.0, Atmosphere_panorama_vts_File);
-    dump_array("CO2-Concentration", co2, 1.0, Atmosphere_panorama_vts_File);
-    dump_array("Q_Latent", Q_Latent, 1.0, Atmosphere_panorama_vts_File);
-    dump_array("Q_Sensible", Q_Sensible, 1.0, Atmosphere_panorama_vts_File);
+    vts.end_array ( );
+
+    dump_array("Epsilon_3D", epsilon_3D, 1.0, vts);
+    dump_array("WaterVapour", c, 1000.0, vts);
+    dump_array("CloudWater", cloud, 1000.0, vts);
+    dump_array("CloudIce", ice, 1000.0, vts);
+    dump_array("PrecipitationRain", P_rain, 86400., vts);
+    dump_array("PrecipitationSnow", P_snow, 86400., vts);
+    dump_array("PressureDynamic", p_dyn, u_0 * u_0 * r_air *.01, vts);
+    dump_array("PressureStatic", p_stat, 1.0, vts);
+    dump_array("BuoyancyForce", BuoyancyForce, 1.0, vts);
+    dump_array("CO2-Concentration", co2, 1.0, vts);
+    dump_array("Q_Latent", Q_Latent, 1.0, vts);
+    dump_array("Q_Sensible", Q_Sensible, 1.0, vts);
 
     Atmosphere_panorama_vts_File <<  "   </PointData>\n" << endl;
     Atmosphere_panorama_vts_File <<  "   <Points>\n"  << endl;
-    Atmosphere_panorama_vts_File <<  "    <DataArray type=\"Float32\" NumberOfComponents=\"3\" format=\"ascii\">\n"  << endl;
+    vts.begin_array ( "", 3 );
 
 // writing cartesian coordinates
     x = 0.;
@@ -217,21 +213,20 @@ void PostProcess_Atmosphere::paraview_panorama_vts (string &Name_Bathymetry_File
             {
                 if ( k == 0 || j == 0 ) x = 0.;
                 else x = x + dx;
-                Atmosphere_panorama_vts_File << x << " " << y << " " << z  << endl;
+                vts.value ( x, y, z );
             }
             x = 0;
             y = y + dy;
-            Atmosphere_panorama_vts_File <<  "\n"  << endl;
         }
         y = 0;
         z = z + dz;
-        Atmosphere_panorama_vts_File <<  "\n"  << endl;
     }
 
-    Atmosphere_panorama_vts_File <<  "    </DataArray>\n"  << endl;
+    vts.end_array ( );
     Atmosphere_panorama_vts_File <<  "   </Points>\n"  << endl;
     Atmosphere_panorama_vts_File <<  "  </Piece>\n"  << endl;
     Atmosphere_panorama_vts_File <<  " </StructuredGrid>\n"  << endl;
+    vts.append_data ( );
     Atmosphere_panorama_vts_File <<  "</VTKFile>\n"  << endl;
 
     Atmosphere_panorama_vts_File.close();
@@ -253,12 +248,14 @@ void PostProcess_Atmosphere::paraview_vtk_radial( string &Name_Bathymetry_File,
         abort();
     }
 
+    VtkLegacyWriter vtk ( Atmosphere_vtk_radial_File, vtk_format, vtk_float64 );
+
     Atmosphere_vtk_radial_File <<  "# vtk DataFile Version 3.0" << endl;
     Atmosphere_vtk_radial_File <<  "Radial_Data_Atmosphere_Circulation\n";
-    Atmosphere_vtk_radial_File <<  "ASCII" << endl;
+    Atmosphere_vtk_radial_File <<  vtk.file_format ( ) << endl;
     Atmosphere_vtk_radial_File <<  "DATASET STRUCTURED_GRID" << endl;
     Atmosphere_vtk_radial_File <<  "DIMENSIONS " << km << " "<< jm << " " << 1 << endl;
-    Atmosphere_vtk_radial_File <<  "POINTS " << jm * km << " float" << endl;
+    vtk.points ( jm * km );
 
 // transformation from spherical to cartesian coordinates
     x = 0.;
@@ -275,11 +272,12 @@ void PostProcess_Atmosphere::paraview_vtk_radial( string &Name_Bathymetry_File,
             if ( k == 0 ) y = 0.;
             else y = y + dy;
 
-            Atmosphere_vtk_radial_File << x << " " << y << " "<< z << endl;
+            vtk.value ( x, y, z );
         }
         y = 0.;
         x = x + dx;
     }
+    vtk.end_values ( );
 
 
     i_mount = 0;
@@ -311,84 +309,85 @@ void PostProcess_Atmosphere::paraview_vtk_radial( string &Name_Bathymetry_File,
 
     Atmosphere_vtk_radial_File <<  "POINT_DATA " << jm * km << endl;
 
-    dump_radial("u-Component", u, 1., i_radial, Atmosphere_vtk_radial_File);
-    dump_radial("v-Component", v, 1., i_radial, Atmosphere_vtk_radial_File);
-    dump_radial("w-Component", w, 1., i_radial, Atmosphere_vtk_radial_File);
+    dump_radial("u-Component", u, 1., i_radial, vtk);
+    dump_radial("v-Component", v, 1., i_radial, vtk);
+    dump_radial("w-Component", w, 1., i_radial, vtk);
 
 // writing temperature
-    Atmosphere_vtk_radial_File <<  "SCALARS Temperature float " << 1 << endl;
-    Atmosphere_vtk_radial_File <<  "LOOKUP_TABLE default"  <<endl;
+    vtk.scalars ( "Temperature" );
     for ( int j = 0; j < jm; j++ )
     {
         for ( int k = 0; k < km; k++ )
         {
-            Atmosphere_vtk_radial_File << t.x[ i_radial ][ j ][ k ] * t_0 - t_0 << endl;
+            vtk.value ( t.x[ i_radial ][ j ][ k ] * t_0 - t_0 );
         }
     }
+    vtk.end_values ( );
 
 
 
-    dump_radial_2d("Temp_NASA", temp_NASA, 1., Atmosphere_vtk_radial_File);
-    dump_radial("Temp_NASA_diff", aux_v, 1., i_radial, Atmosphere_vtk_radial_File);
+    dump_radial_2d("Temp_NASA", temp_NASA, 1., vtk);
+    dump_radial("Temp_NASA_diff", aux_v, 1., i_radial, vtk);
 
-    dump_radial("Topography", h, 1., i_radial, Atmosphere_vtk_radial_File);
-    dump_radial_2d("Topography_m", Topography, 1., Atmosphere_vtk_radial_File);
+    dump_radial("Topography", h, 1., i_radial, vtk);
+    dump_radial_2d("Topography_m", Topography, 1., vtk);
 
-    dump_radial("WaterVapour", c, 1000., i_radial, Atmosphere_vtk_radial_File);
-    dump_radial("CloudWater", cloud, 1000., i_radial, Atmosphere_vtk_radial_File);
-    dump_radial("CloudIce", ice, 1000., i_radial, Atmosphere_vtk_radial_File);
+    dump_radial("WaterVapour", c, 1000., i_radial, vtk);
+    dump_radial("CloudWater", cloud, 1000., i_radial, vtk);
+    dump_radial("CloudIce", ice, 1000., i_radial, vtk);
 
-//    dump_radial("PrecipitationRain", P_rain, 8.64e6, i_radial, Atmosphere_vtk_radial_File);
-//    dump_radial("PrecipitationSnow", P_snow, 8.64e6, i_radial, Atmosphere_vtk_radial_File);
-    dump_radial("PrecipitationRain", P_rain, 86400., i_radial, Atmosphere_vtk_radial_File);
-    dump_radial("PrecipitationSnow", P_snow, 86400., i_radial, Atmosphere_vtk_radial_File);
-    dump_radial_2d("Precipitation", Precipitation, 1., Atmosphere_vtk_radial_File);
+//    dump_radial("PrecipitationRain", P_rain, 8.64e6, i_radial, vtk);
+//    dump_radial("PrecipitationSnow", P_snow, 8.64e6, i_radial, vtk);
+    dump_radial("PrecipitationRain", P_rain, 86400., i_radial, vtk);
+    dump_radial("PrecipitationSnow", P_snow, 86400., i_radial, vtk);
+    dump_radial_2d("Precipitation", Precipitation, 1., vtk);
 
-    dump_radial_2d("PrecipitableWater_2D", precipitable_water, 1., Atmosphere_vtk_radial_File);
-    dump_radial_2d("Precipitation_NASA", precipitation_NASA, 1., Atmosphere_vtk_radial_File);
+    dump_radial_2d("PrecipitableWater_2D", precipitable_water, 1., vtk);
+    dump_radial_2d("Precipitation_NASA", precipitation_NASA, 1., vtk);
 
-    dump_radial("PressureDynamic", p_dyn, u_0 * u_0 * r_air *.01, i_radial, Atmosphere_vtk_radial_File);
-    dump_radial("PressureStatic", p_stat, 1., i_radial, Atmosphere_vtk_radial_File);
+    dump_radial("PressureDynamic", p_dyn, u_0 * u_0 * r_air *.01, i_radial, vtk);
+    dump_radial("PressureStatic", p_stat, 1., i_radial, vtk);
 
-    dump_radial("Epsilon_3D", epsilon_3D, 1., i_radial, Atmosphere_vtk_radial_File);
+    dump_radial("Epsilon_3D", epsilon_3D, 1., i_radial, vtk);
 
-    dump_radial_2d("albedo_2D", albedo, 1., Atmosphere_vtk_radial_File);
-    dump_radial_2d("epsilon_2D", epsilon, 1., Atmosphere_vtk_radial_File);
+    dump_radial_2d("albedo_2D", albedo, 1., vtk);
+    dump_radial_2d("epsilon_2D", epsilon, 1., vtk);
 
-    dump_radial_2d("Q_radiation_2D", Q_radiation, 1., Atmosphere_vtk_radial_File);
-    dump_radial_2d("Q_bottom_2D", Q_bottom, 1., Atmosphere_vtk_radial_File);
-    dump_radial_2d("Q_latent_2D", Q_latent, 1., Atmosphere_vtk_radial_File);
-    dump_radial_2d("Q_sensible_2D", Q_sensible, 1., Atmosphere_vtk_radial_File);
+    dump_radial_2d("Q_radiation_2D", Q_radiation, 1., vtk);
+    dump_radial_2d("Q_bottom_2D", Q_bottom, 1., vtk);
+    dump_radial_2d("Q_latent_2D", Q_latent, 1., vtk);
+    dump_radial_2d("Q_sensible_2D", Q_sensible, 1., vtk);
 
-    dump_radial("BuoyancyForce", BuoyancyForce, 1., i_radial, Atmosphere_vtk_radial_File);
+    dump_radial("BuoyancyForce", BuoyancyForce, 1., i_radial, vtk);
 
-    dump_radial("Q_Radiation", radiation_3D, 1., i_radial, Atmosphere_vtk_radial_File);
-    dump_radial("Q_Latent", Q_Latent, 1., i_radial, Atmosphere_vtk_radial_File);
-    dump_radial("Q_Sensible", Q_Sensible, 1., i_radial, Atmosphere_vtk_radial_File);
+    dump_radial("Q_Radiation", radiation_3D, 1., i_radial, vtk);
+    dump_radial("Q_Latent", Q_Latent, 1., i_radial, vtk);
+    dump_radial("Q_Sensible", Q_Sensible, 1., i_radial, vtk);
 
-    dump_radial_2d("Evaporation_Penman", Evaporation_Penman, 1., Atmosphere_vtk_radial_File);
-    dump_radial_2d("Evaporation_Dalton", Evaporation_Dalton, 1., Atmosphere_vtk_radial_File);
-    dump_radial_2d("Heat_Evaporation", Q_Evaporation, 1., Atmosphere_vtk_radial_File);
-    dump_radial("Evap-Precip", aux_w, 1., i_radial, Atmosphere_vtk_radial_File);
+    dump_radial_2d("Evaporation_Penman", Evaporation_Penman, 1., vtk);
+    dump_radial_2d("Evaporation_Dalton", Evaporation_Dalton, 1., vtk);
+    dump_radial_2d("Heat_Evaporation", Q_Evaporation, 1., vtk);
+    dump_radial("Evap-Precip", aux_w, 1., i_radial, vtk);
 
-    dump_radial_2d("Vegetation", Vegetation, 1., Atmosphere_vtk_radial_File);
+    dump_radial_2d("Vegetation", Vegetation, 1., vtk);
 
-    dump_radial("CO2-Concentration", co2, co2_0, i_radial, Atmosphere_vtk_radial_File);
+    dump_radial("CO2-Concentration", co2, co2_0, i_radial, vtk);
 
 
 // writing zonal u-v cell structure
-    Atmosphere_vtk_radial_File <<  "VECTORS v-w-Cell float " << endl;
+    vtk.vectors ( "v-w-Cell" );
     for ( int j = 0; j < jm; j++ )
     {
         for ( int k = 0; k < km; k++ )
         {
-            Atmosphere_vtk_radial_File << v.x[ i_radial ][ j ][ k ] << " " << w.x[ i_radial ][ j ][ k ] << " " << z << endl;
+            vtk.value ( v.x[ i_radial ][ j ][ k ], w.x[ i_radial ][ j ][ k ], z );
         }
     }
+    vtk.end_values ( );
     Atmosphere_vtk_radial_File.close();
 }
 
-void PostProcess_Atmosphere::paraview_vtk_zonal ( string &Name_Bathymetry_File, int k_zonal, int n, double &hp, double &ep, double &R_Air, double &g, double &L_atm, double &u_0, double &t_0, double &p_0, double &r_air, double &c_0, double &co2_0, Array &h, Array &p_dyn, Array &p_stat, Array &BuoyancyForce, Array &t, Array &u, Array &v, Array &w, Array &c, Array &co2, Array &cloud, Array &ice, Array &aux_u, Array &aux_v, Array &aux_w, Array &Q_Latent, Array &Q_Sensible, Array &radiation_3D, Array &epsilon_3D, Array &P_rain, Array &P_snow, Array &S_v, Array &S_c, Array &S_i, Array &S_r, Array &S_s, Array &S_c_c )
+void PostProcess_Atmosphere::paraview_vtk_zonal ( string &Name_Bathymetry_File, int k_zonal, int n, double &hp, double &ep, double &R_Air, double &g, double &L_atm, double &u_0, double &t_0, double &p_0, double &r_air, double &c_0, double &co2_0, Array &h, Array &p_dyn, Array &p_stat, Array &BuoyancyForce, Array &t, Array &u, Array &v, Array &w, Array &c, Array &co2, Array &cloud, Array &ice, Array &aux_u, Array &aux_v, Array &aux_w, Array &Q_Latent, Array &Q_Sensible, Array &radiation_3D, Array &epsilon_3D, Array &P_rain, Array &P_snow, Array &S_v, Array &S_c, Array &S_i, Array &S_r, Array &S_s, Array &S_c_c, bool saturation_table_exact )
 {
     double x, y, z, dx, dy;
 
@@ -404,12 +403,14 @@ void PostProcess_Atmosphere::paraview_vtk_zonal ( string &Name_Bathymetry_File,
         abort();
     }
 
+    VtkLegacyWriter vtk ( Atmosphere_vtk_zonal_File, vtk_format, vtk_float64 );
+
     Atmosphere_vtk_zonal_File <<  "# vtk DataFile Version 3.0" << endl;
     Atmosphere_vtk_zonal_File <<  "Zonal_Data_Atmosphere_Circulation\n";
-    Atmosphere_vtk_zonal_File <<  "ASCII" << endl;
+    Atmosphere_vtk_zonal_File <<  vtk.file_format ( ) << endl;
     Atmosphere_vtk_zonal_File <<  "DATASET STRUCTURED_GRID" << endl;
     Atmosphere_vtk_zonal_File <<  "DIMENSIONS " << jm << " "<< im << " " << 1 << endl;
-    Atmosphere_vtk_zonal_File <<  "POINTS " << im * jm << " float" << endl;
+    vtk.points ( im * jm );
 
 // transformation from spherical to cartesian coordinates
     x = 0.;
@@ -426,28 +427,29 @@ void PostProcess_Atmosphere::paraview_vtk_zonal ( string &Name_Bathymetry_File,
             if ( j == 0 ) y = 0.;
             else y = y + dy;
 
-            Atmosphere_vtk_zonal_File << x << " " << y << " "<< z << endl;
+            vtk.value ( x, y, z );
         }
         y = 0.;
         x = x + dx;
     }
+    vtk.end_values ( );
 
     Atmosphere_vtk_zonal_File <<  "POINT_DATA " << im * jm << endl;
 
-    dump_zonal("u-Component", u, 1., k_zonal, Atmosphere_vtk_zonal_File);
-    dump_zonal("v-Component", v, 1., k_zonal, Atmosphere_vtk_zonal_File);
-    dump_zonal("w-Component", w, 1., k_zonal, Atmosphere_vtk_zonal_File);
+    dump_zonal("u-Component", u, 1., k_zonal, vtk);
+    dump_zonal("v-Component", v, 1., k_zonal, vtk);
+    dump_zonal("w-Component", w, 1., k_zonal, vtk);
 
 // writing of temperature
-    Atmosphere_vtk_zonal_File <<  "SCALARS Temperature float " << 1 << endl;
-    Atmosphere_vtk_zonal_File <<  "LOOKUP_TABLE default"  <<endl;
+    vtk.scalars ( "Temperature" );
     for ( int i = 0; i < im; i++ )
     {
         for ( int j = 0; j < jm; j++ )
         {
-            Atmosphere_vtk_zonal_File << t.x[ i ][ j ][ k_zonal ] * t_0 - t_0 << endl;
+            vtk.value ( t.x[ i ][ j ][ k_zonal ] * t_0 - t_0 );
         }
     }
+    vtk.end_values ( );
 
     for ( int i = 0; i < im; i++ )
     {
@@ -465,11 +467,11 @@ void PostProcess_Atmosphere::paraview_vtk_zonal ( string &Name_Bathymetry_File,
 
             r_dry = p_h / ( R_Air * t_u );
 
-            E_Rain = hp * exp_func ( T, 17.2694, 35.86 );                                        // saturation water vapour pressure for the water phase at t > 0°C in hPa
-            E_Ice = hp * exp_func ( T, 21.8746, 7.66 );                                            // saturation water vapour pressure for the ice phase in hPa
+            E_Rain = hp * saturation_water.E ( T, saturation_table_exact );                                        // saturation water vapour pressure for the water phase at t > 0°C in hPa
+            E_Ice = hp * saturation_ice.E ( T, saturation_table_exact );                                            // saturation water vapour pressure for the ice phase in hPa
 
-            q_Rain = ep * E_Rain / ( p_h - E_Rain );                                            // water vapour amount at saturation with water formation in kg/kg
-            q_Ice = ep * E_Ice / ( p_h - E_Ice );                                                // water vapour amount at saturation with ice formation in kg/kg
+            q_Rain = q_sat ( ep, E_Rain, p_h );                                            // water vapour amount at saturation with water formation in kg/kg
+            q_Ice = q_sat ( ep, E_Ice, p_h );                                                // water vapour amount at saturation with ice formation in kg/kg
 
             aux_u.x[ i ][ j ][ k_zonal ] = c.x[ i ][ j ][ k_zonal ] / q_Rain;
 
@@ -481,41 +483,42 @@ void PostProcess_Atmosphere::paraview_vtk_zonal ( string &Name_Bathymetry_File,
         }
     }
 
-    dump_zonal("Topography", h, 1., k_zonal, Atmosphere_vtk_zonal_File);
-    dump_zonal("WaterVapour", c, 1000., k_zonal, Atmosphere_vtk_zonal_File);
-    dump_zonal("CloudWater", cloud, 1000., k_zonal, Atmosphere_vtk_zonal_File);
-    dump_zonal("CloudIce", ice, 1000., k_zonal, Atmosphere_vtk_zonal_File);
-    dump_zonal("Saturation_Water", aux_u, 1., k_zonal, Atmosphere_vtk_zonal_File);
-    dump_zonal("Saturation_Ice", aux_v, 1., k_zonal, Atmosphere_vtk_zonal_File);
-    dump_zonal("Total_Water", aux_w, 1000., k_zonal, Atmosphere_vtk_zonal_File);
-//    dump_zonal("PrecipitationRain", P_rain, 8.64e6, k_zonal, Atmosphere_vtk_zonal_File);
-//    dump_zonal("PrecipitationSnow", P_snow, 8.64e6, k_zonal, Atmosphere_vtk_zonal_File);
-    dump_zonal("PrecipitationRain", P_rain, 86400., k_zonal, Atmosphere_vtk_zonal_File);
-    dump_zonal("PrecipitationSnow", P_snow, 86400., k_zonal, Atmosphere_vtk_zonal_File);
-    dump_zonal("Source_WaterVapour", S_v, 1000., k_zonal, Atmosphere_vtk_zonal_File);
-    dump_zonal("Source_CloudWater", S_c, 1000., k_zonal, Atmosphere_vtk_zonal_File);
-    dump_zonal("Source_CloudIce", S_i, 1000., k_zonal, Atmosphere_vtk_zonal_File);
-    dump_zonal("Source_Rain", S_r, 1000., k_zonal, Atmosphere_vtk_zonal_File);
-    dump_zonal("Source_Snow", S_s, 1000., k_zonal, Atmosphere_vtk_zonal_File);
-    dump_zonal("Source_CloudWater_CondEvap", S_c_c, 1000., k_zonal, Atmosphere_vtk_zonal_File);
-    dump_zonal("BuoyancyForce", BuoyancyForce, 1., k_zonal, Atmosphere_vtk_zonal_File);
-    dump_zonal("Q_Radiation", radiation_3D, 1., k_zonal, Atmosphere_vtk_zonal_File);
-    dump_zonal("Epsilon_3D", epsilon_3D, 1., k_zonal, Atmosphere_vtk_zonal_File);
-    dump_zonal("Q_Latent", Q_Latent, 1., k_zonal, Atmosphere_vtk_zonal_File);
-    dump_zonal("Q_Sensible", Q_Sensible, 1., k_zonal, Atmosphere_vtk_zonal_File);
-    dump_zonal("PressureDynamic", p_dyn, u_0 * u_0 * r_air *.01, k_zonal, Atmosphere_vtk_zonal_File);
-    dump_zonal("PressureStatic", p_stat, 1., k_zonal, Atmosphere_vtk_zonal_File);
-    dump_zonal("CO2-Concentration", co2, co2_0, k_zonal, Atmosphere_vtk_zonal_File);
+    dump_zonal("Topography", h, 1., k_zonal, vtk);
+    dump_zonal("WaterVapour", c, 1000., k_zonal, vtk);
+    dump_zonal("CloudWater", cloud, 1000., k_zonal, vtk);
+    dump_zonal("CloudIce", ice, 1000., k_zonal, vtk);
+    dump_zonal("Saturation_Water", aux_u, 1., k_zonal, vtk);
+    dump_zonal("Saturation_Ice", aux_v, 1., k_zonal, vtk);
+    dump_zonal("Total_Water", aux_w, 1000., k_zonal, vtk);
+//    dump_zonal("PrecipitationRain", P_rain, 8.64e6, k_zonal, vtk);
+//    dump_zonal("PrecipitationSnow", P_snow, 8.64e6, k_zonal, vtk);
+    dump_zonal("PrecipitationRain", P_rain, 86400., k_zonal, vtk);
+    dump_zonal("PrecipitationSnow", P_snow, 86400., k_zonal, vtk);
+    dump_zonal("Source_WaterVapour", S_v, 1000., k_zonal, vtk);
+    dump_zonal("Source_CloudWater", S_c, 1000., k_zonal, vtk);
+    dump_zonal("Source_CloudIce", S_i, 1000., k_zonal, vtk);
+    dump_zonal("Source_Rain", S_r, 1000., k_zonal, vtk);
+    dump_zonal("Source_Snow", S_s, 1000., k_zonal, vtk);
+    dump_zonal("Source_CloudWater_CondEvap", S_c_c, 1000., k_zonal, vtk);
+    dump_zonal("BuoyancyForce", BuoyancyForce, 1., k_zonal, vtk);
+    dump_zonal("Q_Radiation", radiation_3D, 1., k_zonal, vtk);
+    dump_zonal("Epsilon_3D", epsilon_3D, 1., k_zonal, vtk);
+    dump_zonal("Q_Latent", Q_Latent, 1., k_zonal, vtk);
+    dump_zonal("Q_Sensible", Q_Sensible, 1., k_zonal, vtk);
+    dump_zonal("PressureDynamic", p_dyn, u_0 * u_0 * r_air *.01, k_zonal, vtk);
+    dump_zonal("PressureStatic", p_stat, 1., k_zonal, vtk);
+    dump_zonal("CO2-Concentration", co2, co2_0, k_zonal, vtk);
 
 // writing zonal u-v cell structure
-    Atmosphere_vtk_zonal_File <<  "VECTORS u-v-Cell float" << endl;
+    vtk.vectors ( "u-v-Cell" );
     for ( int i = 0; i < im; i++ )
     {
         for ( int j = 0; j < jm; j++ )
         {
-            Atmosphere_vtk_zonal_File << u.x[ i ][ j ][ k_zonal ] << " " << v.x[ i ][ j ][ k_zonal ] << " " << z << endl;
+            vtk.value ( u.x[ i ][ j ][ k_zonal ], v.x[ i ][ j ][ k_zonal ], z );
         }
     }
+    vtk.end_values ( );
     Atmosphere_vtk_zonal_File.close();
 }
 
@@ -535,12 +538,14 @@ void PostProcess_Atmosphere::paraview_vtk_longal (string &Name_Bathymetry_File,
         abort();
     }
 
+    VtkLegacyWriter vtk ( Atmosphere_vtk_longal_File, vtk_format, vtk_float64 );
+
     Atmosphere_vtk_longal_File <<  "# vtk DataFile Version 3.0" << endl;
     Atmosphere_vtk_longal_File <<  "Longitudinal_Data_Atmosphere_Circulation\n";
-    Atmosphere_vtk_longal_File <<  "ASCII" << endl;
+    Atmosphere_vtk_longal_File <<  vtk.file_format ( ) << endl;
     Atmosphere_vtk_longal_File <<  "DATASET STRUCTURED_GRID" << endl;
     Atmosphere_vtk_longal_File <<  "DIMENSIONS " << km << " "<< im << " " << 1 << endl;
-    Atmosphere_vtk_longal_File <<  "POINTS " << im * km << " float" << endl;
+    vtk.points ( im * km );
 
 // transformation from spherical to cartesian coordinates
     x = 0.;
@@ -560,28 +565,29 @@ void PostProcess_Atmosphere::paraview_vtk_longal (string &Name_Bathymetry_File,
                 z = z + dz;
             }
 
-            Atmosphere_vtk_longal_File << x << " " << y << " "<< z << endl;
+            vtk.value ( x, y, z );
         }
         z = 0.;
         x = x + dx;
     }
+    vtk.end_values ( );
 
     Atmosphere_vtk_longal_File <<  "POINT_DATA " << im * km << endl;
 
-    dump_longal("u-Component", u, 1., j_longal, Atmosphere_vtk_longal_File);
-    dump_longal("v-Component", v, 1., j_longal, Atmosphere_vtk_longal_File);
-    dump_longal("w-Component", w, 1., j_longal, Atmosphere_vtk_longal_File);
+    dump_longal("u-Component", u, 1., j_longal, vtk);
+    dump_longal("v-Component", v, 1., j_longal, vtk);
+    dump_longal("w-Component", w, 1., j_longal, vtk);
 
 // writing of temperature
-    Atmosphere_vtk_longal_File <<  "SCALARS Temperature float " << 1 << endl;
-    Atmosphere_vtk_longal_File <<  "LOOKUP_TABLE default"  <<endl;
+    vtk.scalars ( "Temperature" );
     for ( int i = 0; i < im; i++ )
     {
         for ( int k = 0; k < km; k++ )
         {
-            Atmosphere_vtk_longal_File << t.x[ i ][ j_longal ][ k ] * t_0 - t_0 << endl;
+            vtk.value ( t.x[ i ][ j_longal ][ k ] * t_0 - t_0 );
         }
     }
+    vtk.end_values ( );
 
     for ( int i = 0; i < im; i++ )
     {
@@ -591,32 +597,33 @@ void PostProcess_Atmosphere::paraview_vtk_longal (string &Name_Bathymetry_File,
         }
     }
 
-    dump_longal("Topography", h, 1., j_longal, Atmosphere_vtk_longal_File);
-    dump_longal("WaterVapour", c, 1000., j_longal, Atmosphere_vtk_longal_File);
-    dump_longal("CloudWater", cloud, 1000., j_longal, Atmosphere_vtk_longal_File);
-    dump_longal("CloudIce", ice, 1000., j_longal, Atmosphere_vtk_longal_File);
-    dump_longal("Total_Water", aux_w, 1000., j_longal, Atmosphere_vtk_longal_File);
-//    dump_longal("PrecipitationRain", P_rain, 8.64e6, j_longal, Atmosphere_vtk_longal_File);
-//    dump_longal("PrecipitationSnow", P_snow, 8.64e6, j_longal, Atmosphere_vtk_longal_File);
-    dump_longal("PrecipitationRain", P_rain, 86400., j_longal, Atmosphere_vtk_longal_File);
-    dump_longal("PrecipitationSnow", P_snow, 86400., j_longal, Atmosphere_vtk_longal_File);
-    dump_longal("PressureDynamic", p_dyn, u_0 * u_0 * r_air *.01, j_longal, Atmosphere_vtk_longal_File);
-    dump_longal("PressureStatic", p_stat, 1., j_longal, Atmosphere_vtk_longal_File);
-    dump_longal("BuoyancyForce", BuoyancyForce, 1., j_longal, Atmosphere_vtk_longal_File);
-    dump_longal("Q_Latent", Q_Latent, 1., j_longal, Atmosphere_vtk_longal_File);
-    dump_longal("Q_Sensible", Q_Sensible, 1., j_longal, Atmosphere_vtk_longal_File);
-    dump_longal("Epsilon_3D", epsilon_3D, 1., j_longal, Atmosphere_vtk_longal_File);
-    dump_longal("CO2-Concentration", co2, co2_0, j_longal, Atmosphere_vtk_longal_File);
+    dump_longal("Topography", h, 1., j_longal, vtk);
+    dump_longal("WaterVapour", c, 1000., j_longal, vtk);
+    dump_longal("CloudWater", cloud, 1000., j_longal, vtk);
+    dump_longal("CloudIce", ice, 1000., j_longal, vtk);
+    dump_longal("Total_Water", aux_w, 1000., j_longal, vtk);
+//    dump_longal("PrecipitationRain", P_rain, 8.64e6, j_longal, vtk);
+//    dump_longal("PrecipitationSnow", P_snow, 8.64e6, j_longal, vtk);
+    dump_longal("PrecipitationRain", P_rain, 86400., j_longal, vtk);
+    dump_longal("PrecipitationSnow", P_snow, 86400., j_longal, vtk);
+    dump_longal("PressureDynamic", p_dyn, u_0 * u_0 * r_air *.01, j_longal, vtk);
+    dump_longal("PressureStatic", p_stat, 1., j_longal, vtk);
+    dump_longal("BuoyancyForce", BuoyancyForce, 1., j_longal, vtk);
+    dump_longal("Q_Latent", Q_Latent, 1., j_longal, vtk);
+    dump_longal("Q_Sensible", Q_Sensible, 1., j_longal, vtk);
+    dump_longal("Epsilon_3D", epsilon_3D, 1., j_longal, vtk);
+    dump_longal("CO2-Concentration", co2, co2_0, j_longal, vtk);
 
 // writing longitudinal u-v cell structure
-    Atmosphere_vtk_longal_File <<  "VECTORS u-w-Cell float" << endl;
+    vtk.vectors ( "u-w-Cell" );
     for ( int i = 0; i < im; i++ )
     {
         for ( int k = 0; k < km; k++ )
         {
-            Atmosphere_vtk_longal_File << u.x[ i ][ j_longal ][ k ] << " " << y << " " << w.x[ i ][ j_longal ][ k ] << endl;
+            vtk.value ( u.x[ i ][ j_longal ][ k ], y, w.x[ i ][ j_longal ][ k ] );
         }
     }
+    vtk.end_values ( );
     Atmosphere_vtk_longal_File.close();
 }
 
@@ -687,8 +694,3 @@ void PostProcess_Atmosphere::save(  const string &filename, const std::vector<st
 }
 
 
-double PostProcess_Atmosphere::exp_func ( double &T_K, const double &co_1, const double &co_2 )
-{
-    return exp ( co_1 * ( T_K - 273.15 ) / ( T_K - co_2 ) );                        // temperature in °K
-}
-
@@ -14,6 +14,7 @@
 #include "Array.h"
 #include "Array_2D.h"
 #include "Array_1D.h"
+#include "VtkWriter.h"
 
 #ifndef _POSTPROCESS_ATMOSPHERE_
 #define _POSTPROCESS_ATMOSPHERE_
@@ -28,14 +29,18 @@ private:
 
     string output_path;
 
-    void dump_radial(const string &desc, Array &a, double multiplier, int i, ofstream &f);
-    void dump_longal(const string &desc, Array &a, double multiplier, int j, ofstream &f);
-    void dump_radial_2d(const string &desc, Array_2D &a, double multiplier, ofstream &f);
-    void dump_zonal(const string &desc, Array &a, double multiplier, int k, ofstream &f);
-    void dump_array(const string &name, Array &a, double multiplier, ofstream &f);
+    int vtk_format;
+    bool vtk_float64;
+
+    void dump_radial(const string &desc, Array &a, double multiplier, int i, AtomUtils::VtkLegacyWriter &vtk);
+    void dump_longal(const string &desc, Array &a, double multiplier, int j, AtomUtils::VtkLegacyWriter &vtk);
+    void dump_radial_2d(const string &desc, Array_2D &a, double multiplier, AtomUtils::VtkLegacyWriter &vtk);
+    void dump_zonal(const string &desc, Array &a, double multiplier, int k, AtomUtils::VtkLegacyWriter &vtk);
+    void dump_array(const string &name, Array &a, double multiplier, AtomUtils::VtsWriter &vts);
 
 public:
-    PostProcess_Atmosphere(int, int, int, string &output_path);
+    // vtk_format and vtk_float64 select ascii or binary paraview files, see AtomUtils::VtkWriter
+    PostProcess_Atmosphere(int, int, int, string &output_path, int vtk_format = 0, bool vtk_float64 = false);
     ~PostProcess_Atmosphere();
 
     void paraview_vts ( string &, int iter_cnt, Array_1D &, Array_1D &, Array_1D &, Array &,
@@ -52,7 +57,7 @@ public:
                                     double &, double &, Array &, Array &, Array &, Array &, Array &,
                                     Array &, Array &, Array &, Array &, Array &, Array &, Array &, Array &,
                                     Array &, Array &, Array &, Array &, Array &, Array &, Array &, Array &,
-                                    Array &, Array &, Array &, Array &, Array &,Array & );
+                                    Array &, Array &, Array &, Array &, Array &,Array &, bool );
 
     void paraview_vtk_longal ( string &, int, int iter_cnt, double &, double &, double &,
                                     double &, double &, double &, Array &, Array &, Array &, Array &,
@@ -73,8 +78,6 @@ public:
     void Atmosphere_PlotData ( string &Name_Bathymetry_File, int iter_cnt, double u_0, double t_0,
         Array &h, Array &v, Array &w, Array &t, Array &c, Array_2D &Precipitation, Array_2D &precipitable_water );
 
-    double exp_func ( double &, const double &, const double & );
-
     void save( const string &filename, const std::vector<string> &field_names,
                const std::vector<Vector3D<>* > &data, unsigned layer=0 );
 };
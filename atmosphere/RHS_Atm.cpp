@@ -80,8 +80,8 @@ void RHS_Atmosphere::RK_RHS_3D_Atmosphere ( int n, int i, int j, int k, double l
                                             Array_2D &Topography, Array_2D &Evaporation_Dalton, 
                                             Array_2D &Precipitation )
 {
-    cout.precision ( 8 );
-    cout.setf ( ios::fixed );
+    get_output().precision ( 8 );
+    get_output().setf ( ios::fixed );
 
     double k_Force = 1.;// factor for acceleration of convergence processes inside the immersed boundary conditions
     double cc = 1.;
@@ -403,10 +403,13 @@ void RHS_Atmosphere::RK_RHS_3D_Atmosphere ( int n, int i, int j, int k, double l
 
     double RS_buoyancy_Momentum = Buoyancy * ( r_humid - r_dry ) / r_dry * g; // any humid air is less dense than dry air
 
-    BuoyancyForce.x[ i ][ j ][ k ] = - RS_buoyancy_Momentum * coeff_buoy * 1000.;// dimension as pressure in kN/m2
+    //  only kept for the result files, the momentum equations use RS_buoyancy_Momentum
+    if ( BuoyancyForce.is_allocated() ){
+        BuoyancyForce.x[ i ][ j ][ k ] = - RS_buoyancy_Momentum * coeff_buoy * 1000.;// dimension as pressure in kN/m2
 
-    if ( is_land ( h, i, j, k ) ){
-        BuoyancyForce.x[ i ][ j ][ k ] = 0.;
+        if ( is_land ( h, i, j, k ) ){
+            BuoyancyForce.x[ i ][ j ][ k ] = 0.;
+        }
     }
 
     if ( i == 1 ){
@@ -15,6 +15,8 @@
 
 #include "Results_Atm.h"
 #include "Utils.h"
+#include "Thermo.h"
+#include "VecMath.h"
 
 using namespace std;
 using namespace AtomUtils;
@@ -128,7 +130,8 @@ void Results_MSL_Atm::run_MSL_data ( int n, int velocity_iter_max, int Radiation
                                     Array_2D &Q_sensible, Array_2D &Q_bottom, Array_2D &Evaporation_Penman,
                                     Array_2D &Evaporation_Dalton, Array_2D &Vegetation, Array_2D &albedo,
                                     Array_2D &co2_total, Array_2D &Precipitation, Array &S_v, Array &S_c,
-                                    Array &S_i, Array &S_r, Array &S_s, Array &S_c_c ){
+                                    Array &S_i, Array &S_r, Array &S_s, Array &S_c_c,
+                                    int math_accuracy, bool saturation_table_exact ){
 // determination of temperature and pressure by the law of Clausius-Clapeyron for water vapour concentration
 // reaching saturation of water vapour pressure leads to formation of rain or ice
 // precipitation and cloud formation by formulas from Häckel
@@ -152,8 +155,8 @@ void Results_MSL_Atm::run_MSL_data ( int n, int velocity_iter_max, int Radiation
 // on the boundary between land and air searching for the top of mountains
                 if ( ( is_land ( h, i, j, k ) ) && ( is_air ( h, i+1, j, k ) ) ){
                     if ( i == 0 )     p_stat.x[ 0 ][ j ][ k ] = ( r_air * R_Air * t.x[ 0 ][ j ][ k ] * t_0 ) * .01; // given in hPa
-                    else     p_stat.x[ i ][ j ][ k ] = exp ( - g * ( double ) i * ( L_atm /
-                        ( double ) ( im-1 ) ) / ( R_Air * t.x[ i ][ j ][ k ] * t_0 ) ) * p_stat.x[ 0 ][ j ][ k ];    // given in hPa
+                    else     p_stat.x[ i ][ j ][ k ] = vm_exp ( - g * ( double ) i * ( L_atm /
+                        ( double ) ( im-1 ) ) / ( R_Air * t.x[ i ][ j ][ k ] * t_0 ), math_accuracy ) * p_stat.x[ 0 ][ j ][ k ];    // given in hPa
                         // current air pressure, step size in 500 m, from a polytropic atmosphere in hPa
 
                     t_Celsius = t.x[ i ][ j ][ k ] * t_0 - t_0;
@@ -164,11 +167,10 @@ void Results_MSL_Atm::run_MSL_data ( int n, int velocity_iter_max, int Radiation
 
                     e = c.x[ i ][ j ][ k ] * p_stat.x[ i ][ j ][ k ] / ep;  // water vapour pressure in hPa
 
-                    t_denom = t_Celsius + 234.175;
-                    E = hp * exp ( 17.0809 * t_Celsius / t_denom );
+                    E = hp * saturation_magnus.E ( t.x[ i ][ j ][ k ] * t_0, saturation_table_exact );
                     // saturation vapour pressure in the water phase for t > 0°C in hPa
 
-                    Delta = 4000. * E / ( t_denom * t_denom );
+                    Delta = hp * saturation_magnus.dE ( t.x[ i ][ j ][ k ] * t_0, saturation_table_exact );
                     // gradient of the water vapour pressure curve in hPa/K, coef = 234.175 * 17.0809
                     sat_deficit = ( E - e );  // saturation deficit in hPa
                     gamma = p_stat.x[ 0 ][ j ][ k ] * cp_l / ( ep * lv );  // Psychrometer constant in hPa/K
@@ -208,9 +210,8 @@ void Results_MSL_Atm::run_MSL_data ( int n, int velocity_iter_max, int Radiation
                     r_humid = r_dry / ( 1. + ( R_WaterVapour / R_Air - 1. ) * c.x[ i ][ j ][ k ] );
                     // density of humid air, COSMO version withot cloud and ice water, masses negligible
                     e = c.x[ i ][ j ][ k ] * p_stat.x[ i ][ j ][ k ] / ep;  // water vapour pressure in Pa
-                    t_denom = t_Celsius + 234.175;
-                    E = hp * exp ( 17.0809 * t_Celsius / t_denom );  // saturation vapour pressure in the water phase for t > 0°C in hPa
-                    Delta = 4000. * E / ( t_denom * t_denom );  // gradient of the water vapour pressure curve in hPa/K, coef = 234.175 * 17.0809
+                    E = hp * saturation_magnus.E ( t.x[ 0 ][ j ][ k ] * t_0, saturation_table_exact );  // saturation vapour pressure in the water phase for t > 0°C in hPa
+                    Delta = hp * saturation_magnus.dE ( t.x[ 0 ][ j ][ k ] * t_0, saturation_table_exact );  // gradient of the water vapour pressure curve in hPa/K, coef = 234.175 * 17.0809
                     sat_deficit = ( E - e );  // saturation deficit in hPa/K
                     gamma = p_stat.x[ 0 ][ j ][ k ] * cp_l / ( ep * lv );  // Psychrometer constant in hPa/K
                     E_a = .35 * ( 1. + .15 * sqrt ( ( v.x[ 1 ][ j ][ k ] * v.x[ 1 ][ j ][ k ] +
@@ -245,35 +246,37 @@ void Results_MSL_Atm::run_MSL_data ( int n, int velocity_iter_max, int Radiation
 
 
 // boundaries of various variables
-    for ( int k = 1; k < km-1; k++ ){
-        for ( int j = 1; j < jm-1; j++ ){
-            BuoyancyForce.x[ 0 ][ j ][ k ] = c43 * BuoyancyForce.x[ 1 ][ j ][ k ] -
-                c13 * BuoyancyForce.x[ 2 ][ j ][ k ];
-            BuoyancyForce.x[ im-1 ][ j ][ k ] = c43 * BuoyancyForce.x[ im-2 ][ j ][ k ] -
-                c13 * BuoyancyForce.x[ im-3 ][ j ][ k ];
-            if ( is_land ( h, 0, j, k ) )  BuoyancyForce.x[ 0 ][ j ][ k ] = 0.;
+    if ( BuoyancyForce.is_allocated() ){
+        for ( int k = 1; k < km-1; k++ ){
+            for ( int j = 1; j < jm-1; j++ ){
+                BuoyancyForce.x[ 0 ][ j ][ k ] = c43 * BuoyancyForce.x[ 1 ][ j ][ k ] -
+                    c13 * BuoyancyForce.x[ 2 ][ j ][ k ];
+                BuoyancyForce.x[ im-1 ][ j ][ k ] = c43 * BuoyancyForce.x[ im-2 ][ j ][ k ] -
+                    c13 * BuoyancyForce.x[ im-3 ][ j ][ k ];
+                if ( is_land ( h, 0, j, k ) )  BuoyancyForce.x[ 0 ][ j ][ k ] = 0.;
+            }
         }
-    }
 
-    for ( int k = 0; k < km; k++ ){
-        for ( int i = 0; i < im; i++ ){
-            BuoyancyForce.x[ i ][ 0 ][ k ] = c43 * BuoyancyForce.x[ i ][ 1 ][ k ] -
-                 c13 * BuoyancyForce.x[ i ][ 2 ][ k ];
-            BuoyancyForce.x[ i ][ jm-1 ][ k ] = c43 * BuoyancyForce.x[ i ][ jm-2 ][ k ] -
-                 c13 * BuoyancyForce.x[ i ][ jm-3 ][ k ];
+        for ( int k = 0; k < km; k++ ){
+            for ( int i = 0; i < im; i++ ){
+                BuoyancyForce.x[ i ][ 0 ][ k ] = c43 * BuoyancyForce.x[ i ][ 1 ][ k ] -
+                     c13 * BuoyancyForce.x[ i ][ 2 ][ k ];
+                BuoyancyForce.x[ i ][ jm-1 ][ k ] = c43 * BuoyancyForce.x[ i ][ jm-2 ][ k ] -
+                     c13 * BuoyancyForce.x[ i ][ jm-3 ][ k ];
 //            if ( h.x[ i ][ 0 ][ k ] == 1. )     BuoyancyForce.x[ i ][ 0 ][ k ] = 0.;
+            }
         }
-    }
 
-    for ( int i = 0; i < im; i++ ){
-        for ( int j = 1; j < jm-1; j++ ){
-            BuoyancyForce.x[ i ][ j ][ 0 ] = c43 * BuoyancyForce.x[ i ][ j ][ 1 ] -
-                c13 * BuoyancyForce.x[ i ][ j ][ 2 ];
-            BuoyancyForce.x[ i ][ j ][ km-1 ] = c43 * BuoyancyForce.x[ i ][ j ][ km-2 ] -
-                c13 * BuoyancyForce.x[ i ][ j ][ km-3 ];
-            BuoyancyForce.x[ i ][ j ][ 0 ] = BuoyancyForce.x[ i ][ j ][ km-1 ] =
-                ( BuoyancyForce.x[ i ][ j ][ 0 ] + BuoyancyForce.x[ i ][ j ][ km-1 ] ) / 2.;
+        for ( int i = 0; i < im; i++ ){
+            for ( int j = 1; j < jm-1; j++ ){
+                BuoyancyForce.x[ i ][ j ][ 0 ] = c43 * BuoyancyForce.x[ i ][ j ][ 1 ] -
+                    c13 * BuoyancyForce.x[ i ][ j ][ 2 ];
+                BuoyancyForce.x[ i ][ j ][ km-1 ] = c43 * BuoyancyForce.x[ i ][ j ][ km-2 ] -
+                    c13 * BuoyancyForce.x[ i ][ j ][ km-3 ];
+                BuoyancyForce.x[ i ][ j ][ 0 ] = BuoyancyForce.x[ i ][ j ][ km-1 ] =
+                    ( BuoyancyForce.x[ i ][ j ][ 0 ] + BuoyancyForce.x[ i ][ j ][ km-1 ] ) / 2.;
 //            if ( h.x[ i ][ j ][ 0 ] == 1. )     BuoyancyForce.x[ i ][ j ][ 0 ] = 0.;
+            }
         }
     }
 
@@ -393,7 +396,7 @@ void Results_MSL_Atm::run_MSL_data ( int n, int velocity_iter_max, int Radiation
     precipitation_NASA_average = GetMean_2D(jm, km, precipitation_NASA);
 */
 
-    cout.precision ( 2 );
+    get_output().precision ( 2 );
 
     level = "m";
     deg_north = "°N";
@@ -441,27 +444,27 @@ void Results_MSL_Atm::run_MSL_data ( int n, int velocity_iter_max, int Radiation
     heading_Sydney = " City of Sydney, New South Wales, Australia";
     heading_Pacific = " Equator in the central Pacific";
 
-    cout << endl << endl << heading << endl << endl;
+    get_output() << endl << endl << heading << endl << endl;
 
     int choice = { 1 };
     preparation:
     switch ( choice ){
-        case 1 :    cout << heading_Dresden << endl;
+        case 1 :    get_output() << heading_Dresden << endl;
                         i_loc_level = 0;  // sea level
                         j_loc = j_loc_Dresden;  // 51°N, Dresden Germany
                         k_loc = k_loc_Dresden;  // 14°W, Dresden Germany
                         break;
-        case 2 :    cout << heading_Sydney << endl;
+        case 2 :    get_output() << heading_Sydney << endl;
                         i_loc_level = 0;  // sea level
                         j_loc = j_loc_Sydney;  // 33°S, Dresden Germany
                         k_loc = k_loc_Sydney;  // 151°E, Dresden Germany
                         break;
-        case 3 :    cout << heading_Pacific << endl;
+        case 3 :    get_output() << heading_Pacific << endl;
                         i_loc_level = 0;  // sea level
                         j_loc = j_loc_Pacific;  // 0°N, Equator
                         k_loc = k_loc_Pacific;  // 180°E, central Pacific
                         break;
-    default :     cout << choice << "error in iterationPrintout member function in class Accuracy" << endl;
+    default :     get_output() << choice << "error in iterationPrintout member function in class Accuracy" << endl;
     }
 
     if ( j_loc <= 90 ){
@@ -489,7 +492,7 @@ void Results_MSL_Atm::run_MSL_data ( int n, int velocity_iter_max, int Radiation
     Value_3 = Q_sensible.y[ j_loc ][ k_loc ];
     Value_4 = Q_bottom.y[ j_loc ][ k_loc ];
 
-    cout << setw ( 6 ) << i_loc_level << setw ( 2 ) << level << setw ( 5 ) << j_loc_deg
+    get_output() << setw ( 6 ) << i_loc_level << setw ( 2 ) << level << setw ( 5 ) << j_loc_deg
         << setw ( 3 ) << deg_lat << setw ( 4 ) << k_loc_deg << setw ( 3 ) << deg_lon
         << "  " << setiosflags ( ios::left ) << setw ( 25 ) << setfill ( '.' ) << name_Value_1
         << " = " << resetiosflags ( ios::left ) << setw ( 7 ) << fixed << setfill ( ' ' )
@@ -508,7 +511,7 @@ void Results_MSL_Atm::run_MSL_data ( int n, int velocity_iter_max, int Radiation
     Value_19 = 0.;
     Value_23 = precipitable_water.y[ j_loc ][ k_loc ];
 
-    cout << setw ( 6 ) << i_loc_level << setw ( 2 ) << level << setw ( 5 ) << j_loc_deg
+    get_output() << setw ( 6 ) << i_loc_level << setw ( 2 ) << level << setw ( 5 ) << j_loc_deg
         << setw ( 3 ) << deg_lat << setw ( 4 ) << k_loc_deg << setw ( 3 ) << deg_lon
         << "  " << setiosflags ( ios::left ) << setw ( 25 ) << setfill ( '.' ) << name_Value_23
         << " = " << resetiosflags ( ios::left ) << setw ( 7 ) << fixed << setfill ( ' ' )
@@ -527,7 +530,7 @@ void Results_MSL_Atm::run_MSL_data ( int n, int velocity_iter_max, int Radiation
     Value_16 = 0.;
     Value_24 = Precipitation.y[ j_loc ][ k_loc ];
 
-    cout << setw ( 6 ) << i_loc_level << setw ( 2 ) << level << setw ( 5 ) << j_loc_deg
+    get_output() << setw ( 6 ) << i_loc_level << setw ( 2 ) << level << setw ( 5 ) << j_loc_deg
         << setw ( 3 ) << deg_lat << setw ( 4 ) << k_loc_deg << setw ( 3 ) << deg_lon
         << "  " << setiosflags ( ios::left ) << setw ( 25 ) << setfill ( '.' ) << name_Value_24
         << " = " << resetiosflags ( ios::left ) << setw ( 7 ) << fixed << setfill ( ' ' )
@@ -544,7 +547,7 @@ void Results_MSL_Atm::run_MSL_data ( int n, int velocity_iter_max, int Radiation
     Value_5 = Evaporation_Penman.y[ j_loc ][ k_loc ];
     Value_6 = Evaporation_Dalton.y[ j_loc ][ k_loc ];
 
-    cout << setw ( 6 ) << i_loc_level << setw ( 2 ) << level << setw ( 5 ) << j_loc_deg
+    get_output() << setw ( 6 ) << i_loc_level << setw ( 2 ) << level << setw ( 5 ) << j_loc_deg
         << setw ( 3 ) << deg_lat << setw ( 4 ) << k_loc_deg << setw ( 3 ) << deg_lon
         << "  " << setiosflags ( ios::left ) << setw ( 25 ) << setfill ( '.' ) << name_Value_5
         << " = " << resetiosflags ( ios::left ) << setw ( 7 ) << fixed << setfill ( ' ' )
@@ -556,12 +559,12 @@ void Results_MSL_Atm::run_MSL_data ( int n, int velocity_iter_max, int Radiation
     choice++;
     if ( choice <= 3 ) goto preparation;
 
-    cout << endl;
+    get_output() << endl;
 
     Value_7 = precipitablewater_average;
     Value_8 = precipitation_average;
 
-    cout << setw ( 6 ) << setiosflags ( ios::left ) << setw ( 40 ) << setfill ( '.' )
+    get_output() << setw ( 6 ) << setiosflags ( ios::left ) << setw ( 40 ) << setfill ( '.' )
         << name_Value_7 << " = " << resetiosflags ( ios::left ) << setw ( 7 ) << fixed
         << setfill ( ' ' ) << Value_7 << setw ( 6 ) << name_unit_mm << "   " << setiosflags ( ios::left )
         << setw ( 40 ) << setfill ( '.' ) << name_Value_8 << " = " << resetiosflags ( ios::left )
@@ -572,7 +575,7 @@ void Results_MSL_Atm::run_MSL_data ( int n, int velocity_iter_max, int Radiation
 
     Value_10 = precipitation_NASA_average;
 
-    cout << setw ( 6 ) << setiosflags ( ios::left ) << setw ( 40 ) << setfill ( '.' )
+    get_output() << setw ( 6 ) << setiosflags ( ios::left ) << setw ( 40 ) << setfill ( '.' )
         << name_Value_7 << " = " << resetiosflags ( ios::left ) << setw ( 7 )
         << fixed << setfill ( ' ' ) << Value_7 << setw ( 6 ) << name_unit_mm
         << "   " << setiosflags ( ios::left ) << setw ( 40 ) << setfill ( '.' ) << name_Value_10
@@ -584,7 +587,7 @@ void Results_MSL_Atm::run_MSL_data ( int n, int velocity_iter_max, int Radiation
 
     Value_13 = Evaporation_Dalton_average;
 
-    cout << setw ( 6 ) << setiosflags ( ios::left ) << setw ( 40 ) << setfill ( '.' )
+    get_output() << setw ( 6 ) << setiosflags ( ios::left ) << setw ( 40 ) << setfill ( '.' )
         << name_Value_7 << " = " << resetiosflags ( ios::left ) << setw ( 7 )
         << fixed << setfill ( ' ' ) << Value_7 << setw ( 6 ) << name_unit_mm
         << "   " << setiosflags ( ios::left ) << setw ( 40 ) << setfill ( '.' )
@@ -598,7 +601,7 @@ void Results_MSL_Atm::run_MSL_data ( int n, int velocity_iter_max, int Radiation
     Value_9 = co2_vegetation_average * co2_0;
     Value_12 = Evaporation_Penman_average;
 
-    cout << setw ( 6 ) << setiosflags ( ios::left ) << setw ( 40 ) << setfill ( '.' )
+    get_output() << setw ( 6 ) << setiosflags ( ios::left ) << setw ( 40 ) << setfill ( '.' )
         << name_Value_22 << " = " << resetiosflags ( ios::left ) << setw ( 7 )
         << fixed << setfill ( ' ' ) << Value_9 << setw ( 6 ) << name_unit_ppm
         << "   " << setiosflags ( ios::left ) << setw ( 40 ) << setfill ( '.' ) << name_Value_12
@@ -613,7 +616,7 @@ void Results_MSL_Atm::run_MSL_data ( int n, int velocity_iter_max, int Radiation
     Value_26 = temperature_surf_average;
     Value_27 = t_average + t_cretaceous * t_0;
 
-    cout << setw ( 6 ) << setiosflags ( ios::left ) << setw ( 40 ) << setfill ( '.' )
+    get_output() << setw ( 6 ) << setiosflags ( ios::left ) << setw ( 40 ) << setfill ( '.' )
         << name_Value_25 << " = " << resetiosflags ( ios::left ) << setw ( 7 )
         << fixed << setfill ( ' ' ) << Value_25 << setw ( 6 ) << name_unit_t << "   "
         << setiosflags ( ios::left ) << setw ( 40 ) << setfill ( '.' ) << name_Value_26
@@ -634,7 +637,7 @@ float Results_MSL_Atm::GetMean_3D(int jm, int km, Array &val_3D){
     double ret=0., weight=0.;
     for(int j=0; j<jm; j++){
         for(int k=0; k<km; k++){
-            //std::cout << (val_3D.x[0][j][k]-1)*t_0 << "  " << m_node_weights[j][k] << std::endl;
+            //get_output() << (val_3D.x[0][j][k]-1)*t_0 << "  " << m_node_weights[j][k] << std::endl;
             ret+=val_3D.x[0][j][k]*m_node_weights[j][k];
             weight+=m_node_weights[j][k];
         }
@@ -652,7 +655,7 @@ float Results_MSL_Atm::GetMean_2D(int jm, int km, Array_2D &val_2D){
     double ret=0., weight=0.;
     for(int j=0; j<jm; j++){
         for(int k=0; k<km; k++){
-            //std::cout << (val_2D.y[ j ][ k ]-1)*t_0 << "  " << m_node_weights[j][k] << std::endl;
+            //get_output() << (val_2D.y[ j ][ k ]-1)*t_0 << "  " << m_node_weights[j][k] << std::endl;
             ret+=val_2D.y[ j ][ k ]*m_node_weights[j][k];
             weight+=m_node_weights[j][k];
         }
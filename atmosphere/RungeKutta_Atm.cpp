@@ -11,6 +11,7 @@
 #include <cmath>
 #include "RungeKutta_Atm.h"
 #include "RHS_Atm.h"
+#include "Utils.h"
 
 using namespace std;
 
@@ -168,8 +169,8 @@ void RungeKutta_Atmosphere::solveRungeKutta_2D_Atmosphere ( RHS_Atmosphere &prep
 // Runge-Kutta 4. order for u, v and w component, temperature, water vapour and co2 content
 //  2D surface iterations
 // Runge-Kutta 4. order for u, v and w component, temperature and salt concentration
-    cout.precision ( 9 );
-    cout.setf ( ios::fixed );
+    AtomUtils::get_output().precision ( 9 );
+    AtomUtils::get_output().setf ( ios::fixed );
 
     for ( int j = 1; j < jm-1; j++ ){
         for ( int k = 1; k < km-1; k++ ){
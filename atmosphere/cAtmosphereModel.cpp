@@ -2,7 +2,9 @@
 
 #include <fenv.h>
 
+#include <algorithm>
 #include <fstream>
+#include <memory>
 #include <iostream>
 #include <iomanip>
 #include <sstream>
@@ -26,15 +28,21 @@
 #include "Results_Atm.h"
 #include "MinMax_Atm.h"
 #include "Utils.h"
+#include "Thermo.h"
+#include "VecMath.h"
+#include "Convergence.h"
+#include "SliceFarm.h"
 #include "Config.h"
-#include "AtmParameters.h"
+#include "DatasetCache.h"
+#include "Checkpoint.h"
+#include "TraceRecorder.h"
+#include "MemoryAccount.h"
+#include "Telemetry.h"
 
 using namespace std;
 using namespace tinyxml2;
 using namespace AtomUtils;
 
-cAtmosphereModel* cAtmosphereModel::m_model = NULL;
-
 const double cAtmosphereModel::pi180 = 180./ M_PI;      // pi180 = 57.3
 
 const double cAtmosphereModel::the_degree = 1.;         // compares to 1° step size laterally
@@ -62,19 +70,19 @@ cAtmosphereModel::cAtmosphereModel() :
     old_arrays_2d {&v,  &w,  &p_dyn }, 
     new_arrays_2d {&vn, &wn, &p_dynn},
     residuum_2d(1, jm, km),
-    residuum_3d(im, jm, km)
+    warm_Ma(-1),
+    cold_start_Ma(-1),
+    cold_start_iterations(0),
+    // Python and Notebooks can't capture stdout from this module, the output of this model
+    // goes through a streambuf which redirects it to Python
+    output_buffer(PythonStream::is_enable() ? &ps : std::cout.rdbuf()),
+    output_stream(&output_buffer),
+    log_buffer(log_file_stream.rdbuf()),
+    log_output(&log_buffer)
 {
-    // Python and Notebooks can't capture stdout from this module. We override
-    // cout's streambuf with a class that redirects stdout out to Python.
-    //PythonStream::OverrideCout();
-    if(PythonStream::is_enable())
-    {
-        backup = std::cout.rdbuf();
-        std::cout.rdbuf(&ps);
-    }
-    
-    // If Ctrl-C is pressed, quit
-    signal(SIGINT, exit);
+    // If Ctrl-C is pressed, quit, iterations which write restart files stop after writing them
+    Checkpoint::catch_signals();
+    Checkpoint::set_drain ( drain_streams );
 
     // set default configuration
     SetDefaultConfig();
@@ -84,27 +92,41 @@ cAtmosphereModel::cAtmosphereModel() :
     im_tropopause = new int [ jm ];// location of the tropopaus
 
     emin = epsres * 100.;
-    
-    m_model = this;
 
     load_temperature_curve();
 }
 
 cAtmosphereModel::~cAtmosphereModel() {
-    if(PythonStream::is_enable()){
-        std::cout.rdbuf(backup);
-    }
+    output_buffer.drain();
+    log_buffer.drain();
 
     delete [] im_tropopause;
     im_tropopause = NULL;
-    m_model = NULL;
-    logger().close();
+}
+
+std::ostream& cAtmosphereModel::log_stream(){
+    output_buffer.set_interval ( log_flush_interval );
+    log_buffer.set_interval ( log_flush_interval );
+    if ( !log_file_stream.is_open() || log_file_name != log_file ){
+        log_buffer.drain();
+        log_file_stream.close();
+        log_file_stream.clear();
+        log_file_stream.open ( log_file.c_str(), std::ofstream::out );
+        log_file_name = log_file;
+    }
+    return log_output;
+}
+
+AtomUtils::LogLevel cAtmosphereModel::log_level() const{
+    return AtomUtils::log_level ( log_levels, "atm" );
 }
  
 #include "cAtmosphereDefaults.cpp.inc"
 
 void cAtmosphereModel::LoadConfig ( const char *filename ) 
 {
+    StreamScope stream_scope ( output_stream, std::clog );
+
     XMLDocument doc;
     XMLError err = doc.LoadFile ( filename );
     try{
@@ -139,12 +161,33 @@ void cAtmosphereModel::LoadConfig ( const char *filename )
 
 void cAtmosphereModel::RunTimeSlice ( int Ma )
 {
+    StreamScope stream_scope ( output_stream, log_stream(), log_level() );
+
+    if ( !trace_file.empty() ){
+        TraceRecorder::open ( trace_file );
+    }
+    TraceRecorder::name_thread ( "atm" );
+    TraceScope slice_trace ( "atm time slice", "slice", "Ma", Ma );
+    TraceScope setup_trace ( "initial and boundary conditions", "slice" );
+
     if(debug){
         feenableexcept(FE_INVALID | FE_OVERFLOW | FE_DIVBYZERO); //not platform independent, bad, very bad, I know
     }
 //    logger() << "RunTimeSlice: " << Ma << " Ma"<< std::endl <<std::endl;
 
-    reset_arrays();    
+    allocate_fields();
+
+    if ( memory_report ){
+        report_memory ( "memory of the atmosphere at the start of time slice " + std::to_string ( Ma ) + " Ma" );
+    }
+
+    output_writer.set_depth ( output_queue_depth );
+
+    math_accuracy = checked_vm_accuracy ( math_accuracy );
+    if(debug){
+        logger() << "saturation table max relative error, water: " << saturation_water.max_rel_error()
+            << "  ice: " << saturation_ice.max_rel_error() << "  Magnus: " << saturation_magnus.max_rel_error() << std::endl;
+    }
 
     m_current_time = m_time_list.insert(float(Ma)).first;
 
@@ -157,8 +200,8 @@ void cAtmosphereModel::RunTimeSlice ( int Ma )
     // maximum number of inner velocity loop iterations ( velocity_iter_max )
     // maximum number of outer pressure loop iterations ( pressure_iter_max )
 
-    cout.precision ( 6 );
-    cout.setf ( ios::fixed );
+    get_output().precision ( 6 );
+    get_output().setf ( ios::fixed );
 
     //  Coordinate system in form of a spherical shell
     //  rad for r-direction normal to the surface of the earth, the for lateral and phi for longitudinal direction
@@ -184,37 +227,37 @@ void cAtmosphereModel::RunTimeSlice ( int Ma )
             std::string cmd_str = "python " + reconstruction_script_path + " " + std::to_string(Ma - time_step) + " " + 
                 std::to_string(Ma) + " " + output_path + " " + BathymetrySuffix + " atm";
             int ret = system(cmd_str.c_str());
-            std::cout << " reconstruction script returned: " << ret << std::endl;
+            get_output() << " reconstruction script returned: " << ret << std::endl;
         } 
     }
 
     bathymetry_name = std::to_string(Ma) + BathymetrySuffix;
     bathymetry_filepath = bathymetry_path + "/" + bathymetry_name;
 
-    cout << "\n   Output is being written to " << output_path << "\n";
-    cout << "   Ma = " << Ma << "\n";
-    cout << "   bathymetry_path = " << bathymetry_path << "\n";
-    cout << "   bathymetry_filepath = " << bathymetry_filepath << "\n\n";
+    get_output() << "\n   Output is being written to " << output_path << "\n";
+    get_output() << "   Ma = " << Ma << "\n";
+    get_output() << "   bathymetry_path = " << bathymetry_path << "\n";
+    get_output() << "   bathymetry_filepath = " << bathymetry_filepath << "\n\n";
 
     if (verbose) {
-        cout << endl << endl << endl;
-        cout << "***** Atmosphere General Circulation Model ( AGCM ) applied to laminar flow" << endl;
-        cout << "***** program for the computation of geo-atmospherical circulating flows in a spherical shell" << endl;
-        cout << "***** finite difference scheme for the solution of the 3D Navier-Stokes equations" << endl;
-        cout << "***** with 4 additional transport equations to describe the water vapour, cloud water, cloud ice and co2 concentration" << endl;
-        cout << "***** 4th order Runge-Kutta scheme to solve 2nd order differential equations inside an inner iterational loop" << endl;
-        cout << "***** Poisson equation for the pressure solution in an outer iterational loop" << endl;
-        cout << "***** multi-layer and two-layer radiation model for the computation of the surface temperature" << endl;
-        cout << "***** temperature distribution given as a parabolic distribution from pole to pole, zonaly constant" << endl;
-        cout << "***** water vapour distribution given by Clausius-Claperon equation for the partial pressure" << endl;
-        cout << "***** water vapour is part of the Boussinesq approximation and the absorptivity in the radiation model" << endl;
-        cout << "***** two category ice scheme for cold clouds applying parameterization schemes provided by the COSMO code ( German Weather Forecast )" << endl;
-        cout << "***** rain and snow precipitation solved by column equilibrium applying the diagnostic equations" << endl;
-        cout << "***** co2 concentration appears in the absorptivity of the radiation models" << endl;
-        cout << "***** code developed by Roger Grundmann, Zum Marktsteig 1, D-01728 Bannewitz ( roger.grundmann@web.de )" << endl << endl;
-
-        cout << "***** original program name:  " << __FILE__ << endl;
-        cout << "***** compiled:  " << __DATE__  << "  at time:  " << __TIME__ << endl << endl;
+        get_output() << endl << endl << endl;
+        get_output() << "***** Atmosphere General Circulation Model ( AGCM ) applied to laminar flow" << endl;
+        get_output() << "***** program for the computation of geo-atmospherical circulating flows in a spherical shell" << endl;
+        get_output() << "***** finite difference scheme for the solution of the 3D Navier-Stokes equations" << endl;
+        get_output() << "***** with 4 additional transport equations to describe the water vapour, cloud water, cloud ice and co2 concentration" << endl;
+        get_output() << "***** 4th order Runge-Kutta scheme to solve 2nd order differential equations inside an inner iterational loop" << endl;
+        get_output() << "***** Poisson equation for the pressure solution in an outer iterational loop" << endl;
+        get_output() << "***** multi-layer and two-layer radiation model for the computation of the surface temperature" << endl;
+        get_output() << "***** temperature distribution given as a parabolic distribution from pole to pole, zonaly constant" << endl;
+        get_output() << "***** water vapour distribution given by Clausius-Claperon equation for the partial pressure" << endl;
+        get_output() << "***** water vapour is part of the Boussinesq approximation and the absorptivity in the radiation model" << endl;
+        get_output() << "***** two category ice scheme for cold clouds applying parameterization schemes provided by the COSMO code ( German Weather Forecast )" << endl;
+        get_output() << "***** rain and snow precipitation solved by column equilibrium applying the diagnostic equations" << endl;
+        get_output() << "***** co2 concentration appears in the absorptivity of the radiation models" << endl;
+        get_output() << "***** code developed by Roger Grundmann, Zum Marktsteig 1, D-01728 Bannewitz ( roger.grundmann@web.de )" << endl << endl;
+
+        get_output() << "***** original program name:  " << __FILE__ << endl;
+        get_output() << "***** compiled:  " << __DATE__  << "  at time:  " << __TIME__ << endl << endl;
     }
 
     //  initialization of the bathymetry/topography
@@ -291,6 +334,14 @@ void cAtmosphereModel::RunTimeSlice ( int Ma )
     //  class element for the parabolic CO2 distribution from pol to pol, maximum CO2 volume at equator
     circulation.BC_CO2 ( Vegetation, h, t, p_dyn, co2 );
 
+    //  the converged flow of the previous time slice replaces the analytic profiles
+    int warm_start_Ma = warm_Ma;
+    bool warm_started = warm_start && apply_warm_start ( Ma );
+    if ( warm_started ){
+        //  surface pressure of the warm started temperature
+        circulation.BC_Pressure ( p_stat, p_dyn, t, h );
+    }
+
     // class element for the surface temperature computation by radiation flux density
     if ( RadiationModel == 1 ){
         circulation.BC_Radiation_multi_layer ( albedo, epsilon, radiation_surface,  
@@ -303,38 +354,113 @@ void cAtmosphereModel::RunTimeSlice ( int Ma )
 
 
 
+    //  an interrupted time slice continues the 3D iterations from its restart file
+    restart_state.clear();
+    bool resumed = restart && restart_checkpoint().read ( restart_file ( Ma ), Ma, restart_state );
+    if ( resumed ){
+        get_output() << " restart file " << restart_file ( Ma ) << " read, continuing at n = " 
+            << int ( restart_state[ "iter_cnt" ] ) << endl;
+        logger() << "time slice " << Ma << " resumed from " << restart_file ( Ma ) << " at n = " 
+            << int ( restart_state[ "iter_cnt" ] ) << std::endl;
+    }
+
+
+
     // ***********************************   start of pressure and velocity iterations ***********************************
 
-    run_2D_loop(boundary, result, LandArea, prepare_2D, startPressure, circulation);
+    //  the surface flow of a warm start is converged already, the 2D loop is not needed
+    setup_trace.end();
+    if ( !warm_started && !resumed ){
+        TraceScope loop_trace ( "2D iterations", "slice" );
+        run_2D_loop(boundary, result, LandArea, prepare_2D, startPressure, circulation);
+    }
     
-    cout << endl << endl;
+    get_output() << endl << endl;
+
+    int iterations_3D;
+    {
+        TraceScope loop_trace ( "3D iterations", "slice" );
+        iterations_3D = run_3D_loop( boundary, result, LandArea, prepare, startPressure, calculate_MSL, circulation);
+    }
+
+    //  the iterations of the time slice are complete, a new run starts it afresh
+    if ( restart ){
+        std::remove ( restart_file ( Ma ).c_str() );
+    }
 
-    run_3D_loop( boundary, result, LandArea, prepare, startPressure, calculate_MSL, circulation);
+    if ( phase_report && !phase_profile.empty() ){
+        string report = phase_profile.report ( "3D iterations" );
+        get_output() << endl << report << endl;
+        logger() << report << std::endl;
+        phase_profile.write_json ( output_path + "/" + std::to_string ( Ma ) + "Ma_atm_phases.json", "atm", Ma );
+    }
+
+    //  the 3D iterations to convergence, without convergence_window all time slices run the same number of them
+    if ( warm_started && convergence_window > 0 ){
+        std::ostringstream report;
+        report << " warm start from Ma = " << warm_start_Ma << ": " << iterations_3D << " 3D iterations to convergence";
+        if ( cold_start_Ma >= 0 ){
+            report << ", cold start of Ma = " << cold_start_Ma << ": " << cold_start_iterations << " 3D iterations";
+        }
+        get_output() << endl << report.str() << endl;
+        logger() << report.str() << std::endl;
+    }else if ( warm_started ){
+        get_output() << endl << " warm start from Ma = " << warm_start_Ma << ": the 2D iterations are skipped, "
+            << "the 3D iterations only stop at convergence with convergence_window > 0" << endl;
+    }else if ( !resumed ){
+        cold_start_Ma = Ma;
+        cold_start_iterations = iterations_3D;
+    }
+
+    if ( warm_start ){
+        save_warm_start ( Ma );
+    }
 
-    cout << std::endl << " ************** NaNs detected in temperature ********************: temperature has_nan: "
+    get_output() << std::endl << " ************** NaNs detected in temperature ********************: temperature has_nan: "
     << t.has_nan() << std::endl;
-    cout << " ************** NaNs detected in water vapor ********************: water vapor has_nan: "
+    get_output() << " ************** NaNs detected in water vapor ********************: water vapor has_nan: "
     << c.has_nan() << std::endl;
-    cout << " ************** NaNs detected in cloud water ********************: cloud water has_nan: "
+    get_output() << " ************** NaNs detected in cloud water ********************: cloud water has_nan: "
     << cloud.has_nan() << std::endl;
-    cout << " ************** NaNs detected in cloud ice ********************: cloud ice has_nan: "
+    get_output() << " ************** NaNs detected in cloud ice ********************: cloud ice has_nan: "
     << ice.has_nan() << std::endl;
 
-    cout << endl << endl;
+    get_output() << endl << endl;
 
     restrain_temperature();
 
 //    Print:
 
     //write the ouput files
-    write_file(bathymetry_name, output_path, true);
+    {
+        TraceScope write_trace ( "write result files", "io" );
+        write_file(bathymetry_name, output_path, true);
+    }
+
+    //  the result files of the time slice are complete before the next time slice or the hydrosphere reads them
+    {
+        TraceScope wait_trace ( "wait for output writer", "io" );
+        output_writer.wait();
+    }
+    if ( output_writer.get_depth() > 0 ){
+        string report = output_writer.report();
+        get_output() << endl << report << endl;
+        logger() << report << std::endl;
+    }
+
+    if ( memory_report ){
+        report_memory ( "memory of the atmosphere at the end of time slice " + std::to_string ( Ma ) + " Ma" );
+    }
 
     //  final remarks
-    cout << endl << "***** end of the Atmosphere General Circulation Modell ( AGCM ) *****" << endl << endl;
+    get_output() << endl << "***** end of the Atmosphere General Circulation Modell ( AGCM ) *****" << endl << endl;
     if ( emin <= epsres ){
-        cout << "***** steady solution reached! *****" << endl;
+        get_output() << "***** steady solution reached! *****" << endl;
     }
 
+    slice_trace.end();
+    TraceRecorder::flush();
+
     if(debug){
         fedisableexcept(FE_INVALID | FE_OVERFLOW |FE_DIVBYZERO); //not platform independent(bad, very bad, I know)
     }
@@ -344,40 +470,155 @@ void cAtmosphereModel::RunTimeSlice ( int Ma )
 
 void cAtmosphereModel::Run() 
 {
+    StreamScope stream_scope ( output_stream, log_stream(), log_level() );
+
     mkdir(output_path.c_str(), 0777);
 
-    cout << std::endl << "Output is being written to " << output_path << std::endl << std::endl;
+    get_output() << std::endl << "Output is being written to " << output_path << std::endl << std::endl;
 
     if (verbose) {
-        cout << endl << endl << endl;
-        cout << "***** Atmosphere General Circulation Model ( AGCM ) applied to laminar flow" << endl;
-        cout << "***** program for the computation of geo-atmospherical circulating flows in a spherical shell" << endl;
-        cout << "***** finite difference scheme for the solution of the 3D Navier-Stokes equations" << endl;
-        cout << "***** with 4 additional transport equations to describe the water vapour, cloud water, cloud ice and co2 concentration" << endl;
-        cout << "***** 4th order Runge-Kutta scheme to solve 2nd order differential equations inside an inner iterational loop" << endl;
-        cout << "***** Poisson equation for the pressure solution in an outer iterational loop" << endl;
-        cout << "***** multi-layer and two-layer radiation model for the computation of the surface temperature" << endl;
-        cout << "***** temperature distribution given as a parabolic distribution from pole to pole, zonaly constant" << endl;
-        cout << "***** water vapour distribution given by Clausius-Claperon equation for the partial pressure" << endl;
-        cout << "***** water vapour is part of the Boussinesq approximation and the absorptivity in the radiation model" << endl;
-        cout << "***** two category ice scheme for cold clouds applying parameterization schemes provided by the COSMO code ( German Weather Forecast )" << endl;
-        cout << "***** rain and snow precipitation solved by column equilibrium applying the diagnostic equations" << endl;
-        cout << "***** co2 concentration appears in the absorptivity of the radiation models" << endl;
-        cout << "***** code developed by Roger Grundmann, Zum Marktsteig 1, D-01728 Bannewitz ( roger.grundmann@web.de )" << endl << endl;
-
-        cout << "***** original program name:  " << __FILE__ << endl;
-        cout << "***** compiled:  " << __DATE__  << "  at time:  " << __TIME__ << endl << endl;
+        get_output() << endl << endl << endl;
+        get_output() << "***** Atmosphere General Circulation Model ( AGCM ) applied to laminar flow" << endl;
+        get_output() << "***** program for the computation of geo-atmospherical circulating flows in a spherical shell" << endl;
+        get_output() << "***** finite difference scheme for the solution of the 3D Navier-Stokes equations" << endl;
+        get_output() << "***** with 4 additional transport equations to describe the water vapour, cloud water, cloud ice and co2 concentration" << endl;
+        get_output() << "***** 4th order Runge-Kutta scheme to solve 2nd order differential equations inside an inner iterational loop" << endl;
+        get_output() << "***** Poisson equation for the pressure solution in an outer iterational loop" << endl;
+        get_output() << "***** multi-layer and two-layer radiation model for the computation of the surface temperature" << endl;
+        get_output() << "***** temperature distribution given as a parabolic distribution from pole to pole, zonaly constant" << endl;
+        get_output() << "***** water vapour distribution given by Clausius-Claperon equation for the partial pressure" << endl;
+        get_output() << "***** water vapour is part of the Boussinesq approximation and the absorptivity in the radiation model" << endl;
+        get_output() << "***** two category ice scheme for cold clouds applying parameterization schemes provided by the COSMO code ( German Weather Forecast )" << endl;
+        get_output() << "***** rain and snow precipitation solved by column equilibrium applying the diagnostic equations" << endl;
+        get_output() << "***** co2 concentration appears in the absorptivity of the radiation models" << endl;
+        get_output() << "***** code developed by Roger Grundmann, Zum Marktsteig 1, D-01728 Bannewitz ( roger.grundmann@web.de )" << endl << endl;
+
+        get_output() << "***** original program name:  " << __FILE__ << endl;
+        get_output() << "***** compiled:  " << __DATE__  << "  at time:  " << __TIME__ << endl << endl;
     }
 
+    std::vector<int> slices;
     for(int i = time_start; i <= time_end; i+=time_step)
     {
-        RunTimeSlice(i);
+        slices.push_back(i);
+    }
+
+    //  a warm start needs the converged flow of the preceding time slice, the slices run one after the other
+    if ( slice_concurrency > 1 && warm_start ){
+        get_output() << " warm_start is set, the time slices are computed one after the other" << endl << endl;
+    }
+
+    if ( slice_concurrency > 1 && !warm_start && slices.size() > 1 ){
+        run_slice_farm ( slices );
+    }else{
+        for ( size_t s = 0; s < slices.size(); s++ )
+        {
+            RunTimeSlice ( slices[ s ] );
+        }
     }
 
     //  final remarks
-    cout << endl << "***** end of the Atmosphere General Circulation Modell ( AGCM ) *****" << endl << endl;
-    cout << "***** end of object oriented C++ program for the computation of 3D-atmospheric circulation *****";
-    cout << "\n\n\n\n";
+    get_output() << endl << "***** end of the Atmosphere General Circulation Modell ( AGCM ) *****" << endl << endl;
+    get_output() << "***** end of object oriented C++ program for the computation of 3D-atmospheric circulation *****";
+    get_output() << "\n\n\n\n";
+}
+
+
+bool cAtmosphereModel::depends_on_previous_slice ( int Ma ) const
+{
+    // the surface temperature and precipitation of a time slice are reconstructed from the results of
+    // the preceding slice, unless they are present from an earlier run
+    if ( Ma == 0 || !use_earthbyte_reconstruction )  return false;
+
+    struct stat info;
+    string prefix = output_path + "/" + std::to_string ( Ma );
+    return stat ( ( prefix + "Ma_Reconstructed_Temperature.xyz" ).c_str(), &info ) != 0 ||
+           stat ( ( prefix + "Ma_Reconstructed_Precipitation.xyz" ).c_str(), &info ) != 0;
+}
+
+
+void cAtmosphereModel::run_slice_farm ( const std::vector<int> &slices )
+{
+    //  the memory of a time slice as allocated by the models of the workers
+    std::size_t slice_memory;
+    {
+        cAtmosphereModel model;
+        model.CopyConfig ( *this );
+        model.allocate_fields();
+        slice_memory = model.slice_bytes();
+    }
+
+    SliceFarm farm ( slice_concurrency, memory_budget, slice_memory );
+
+    get_output() << " time slice farm: " << slices.size() << " time slices on " << farm.workers() << " workers of "
+        << farm.threads() << " threads, " << slice_memory / ( 1024 * 1024 ) << " MB per time slice" << endl << endl;
+
+    farm.run ( slices,
+        [ this ] ( int Ma ){ return depends_on_previous_slice ( Ma ); },
+        [ this ] ( int Ma, std::ostream &out ){
+            cAtmosphereModel model;
+            model.CopyConfig ( *this );
+            model.output_buffer.set_target ( out.rdbuf() );
+            model.log_file = log_file + "." + std::to_string ( Ma );
+
+            // the preceding time slice as seen by a sequential run, for the temperature differences of BC_Thermo
+            if ( Ma != time_start )  model.m_time_list.insert ( float ( Ma - time_step ) );
+
+            model.RunTimeSlice ( Ma );
+        } );
+}
+
+
+void cAtmosphereModel::save_warm_start ( int Ma )
+{
+    warm_arrays_3d.resize ( old_arrays_3d.size() );
+    for ( size_t n = 0; n < old_arrays_3d.size(); n++ ){
+        warm_arrays_3d[ n ] = *old_arrays_3d[ n ];
+    }
+    warm_h = h;
+    warm_Ma = Ma;
+}
+
+
+bool cAtmosphereModel::apply_warm_start ( int Ma )
+{
+    if ( warm_Ma < 0 || warm_Ma == Ma )  return false;
+
+    //  cells in the air in both time slices take the converged values of the previous time slice, cells which
+    //  have changed from land to air keep the analytic initial values, land cells are set by the boundary conditions
+    int changed = 0;
+    for ( int i = 0; i < im; i++ ){
+        for ( int j = 0; j < jm; j++ ){
+            for ( int k = 0; k < km; k++ ){
+                if ( is_land ( h, i, j, k ) )  continue;
+                if ( is_land ( warm_h, i, j, k ) ){
+                    changed++;
+                    continue;
+                }
+                for ( size_t n = 0; n < old_arrays_3d.size(); n++ ){
+                    old_arrays_3d[ n ]->x[ i ][ j ][ k ] = warm_arrays_3d[ n ].x[ i ][ j ][ k ];
+                }
+            }
+        }
+    }
+
+    get_output() << " warm start of Ma = " << Ma << " from Ma = " << warm_Ma << ", " << changed 
+        << " cells changed from land to air are initialized from the analytic profiles" << endl;
+    return true;
+}
+
+
+void cAtmosphereModel::allocate_fields()
+{
+    reset_arrays();
+
+    //  the fields which only feed the result files materialize when the output asks for them
+    if ( paraview_output || paraview_panorama_vts ){
+        diagnostic_fields.require ( "BuoyancyForce" );
+    }
+    if ( debug && !residuum_3d ){
+        residuum_3d.reset ( new Vector3D<> ( im, jm, km ) );
+    }
 }
 
 
@@ -457,7 +698,7 @@ void cAtmosphereModel::reset_arrays()
 
     Q_Latent.initArray(im, jm, km, 0.); // latent heat
     Q_Sensible.initArray(im, jm, km, 0.); // sensible heat
-    BuoyancyForce.initArray(im, jm, km, 0.); // buoyancy force, Boussinesque approximation
+    diagnostic_fields.add("BuoyancyForce", BuoyancyForce, im, jm, km, 0.); // buoyancy force, Boussinesque approximation
     epsilon_3D.initArray(im, jm, km, 0.); // emissivity/ absorptivity
     radiation_3D.initArray(im, jm, km, 0.); // radiation
 
@@ -473,191 +714,241 @@ void cAtmosphereModel::reset_arrays()
 
 
 
-void cAtmosphereModel::print_min_max_values()
+void cAtmosphereModel::add_diagnostics ( Diagnostics_Atm &diagnostics )
 {
-    MinMax_Atm min_max_3d( im, jm, km );
-
     //  searching of maximum and minimum values of temperature
-    min_max_3d.searchMinMax_3D( " max 3D temperature ", " min 3D temperature ", "°C", t, h, 273.15, 
-                                [](double i)->double{return i - 273.15;},
-                                true );
+    diagnostics.add_3D ( " max 3D temperature ", " min 3D temperature ", "°C", t, 273.15, 
+                         [](double i)->double{return i - 273.15;},
+                         true );
 
     //  searching of maximum and minimum values of u-component
-    min_max_3d.searchMinMax_3D ( " max 3D u-component ", " min 3D u-component ", "m/s", u, h, u_0);
+    diagnostics.add_3D ( " max 3D u-component ", " min 3D u-component ", "m/s", u, u_0 );
 
     //  searching of maximum and minimum values of v-component
-    min_max_3d.searchMinMax_3D ( " max 3D v-component ", " min 3D v-component ", "m/s", v, h, u_0 );
+    diagnostics.add_3D ( " max 3D v-component ", " min 3D v-component ", "m/s", v, u_0 );
 
     //  searching of maximum and minimum values of w-component
-    min_max_3d.searchMinMax_3D ( " max 3D w-component ", " min 3D w-component ", "m/s", w, h, u_0 );
+    diagnostics.add_3D ( " max 3D w-component ", " min 3D w-component ", "m/s", w, u_0 );
 
     //  searching of maximum and minimum values of dynamic pressure
-    min_max_3d.searchMinMax_3D ( " max 3D pressure dynamic ", " min 3D pressure dynamic ", "hPa", p_dyn, h, 0.768 ); // 0.768 = 0.01 * r_air *u_0*u_0 in hPa
+    diagnostics.add_3D ( " max 3D pressure dynamic ", " min 3D pressure dynamic ", "hPa", p_dyn, 0.768 ); // 0.768 = 0.01 * r_air *u_0*u_0 in hPa
 
     //  searching of maximum and minimum values of static pressure
-    min_max_3d.searchMinMax_3D ( " max 3D pressure static ", " min 3D pressure static ", "hPa", p_stat, h );
+    diagnostics.add_3D ( " max 3D pressure static ", " min 3D pressure static ", "hPa", p_stat );
 
-    cout << endl << " energies in the three dimensional space: " << endl << endl;
+    diagnostics.add_text ( "\n energies in the three dimensional space: \n\n" );
 
     //  searching of maximum and minimum values of radiation_3D
-    min_max_3d.searchMinMax_3D ( " max 3D radiation ",  " min 3D radiation ",  "W/m2", radiation_3D, h );
+    diagnostics.add_3D ( " max 3D radiation ",  " min 3D radiation ",  "W/m2", radiation_3D );
 
     //  searching of maximum and minimum values of sensible heat
-    min_max_3d.searchMinMax_3D ( " max 3D sensible heat ", " min 3D sensible heat ", "W/m2", Q_Sensible, h );
+    diagnostics.add_3D ( " max 3D sensible heat ", " min 3D sensible heat ", "W/m2", Q_Sensible );
 
     //  searching of maximum and minimum values of latency
-    min_max_3d.searchMinMax_3D ( " max 3D latent heat ", " min 3D latent heat ", "W/m2", Q_Latent, h );
+    diagnostics.add_3D ( " max 3D latent heat ", " min 3D latent heat ", "W/m2", Q_Latent );
 
-    cout << endl << " greenhouse gases: " << endl << endl;
+    diagnostics.add_text ( "\n greenhouse gases: \n\n" );
 
     //  searching of maximum and minimum values of water vapour
-    min_max_3d.searchMinMax_3D ( " max 3D water vapour ",  " min 3D water vapour ", "g/kg", c, h, 1000. );
+    diagnostics.add_3D ( " max 3D water vapour ",  " min 3D water vapour ", "g/kg", c, 1000. );
 
     //  searching of maximum and minimum values of cloud water
-    min_max_3d.searchMinMax_3D ( " max 3D cloud water ", " min 3D cloud water ", "g/kg", cloud, h, 1000. );
+    diagnostics.add_3D ( " max 3D cloud water ", " min 3D cloud water ", "g/kg", cloud, 1000. );
 
     //  searching of maximum and minimum values of cloud ice
-    min_max_3d.searchMinMax_3D ( " max 3D cloud ice ", " min 3D cloud ice ", "g/kg", ice, h, 1000. );
+    diagnostics.add_3D ( " max 3D cloud ice ", " min 3D cloud ice ", "g/kg", ice, 1000. );
 
     //  searching of maximum and minimum values of rain precipitation
-    min_max_3d.searchMinMax_3D ( " max 3D rain ", " min 3D rain ", "mm/d", P_rain, h, 8.46e4 );
+    diagnostics.add_3D ( " max 3D rain ", " min 3D rain ", "mm/d", P_rain, 8.46e4 );
 
     //  searching of maximum and minimum values of snow precipitation
-    min_max_3d.searchMinMax_3D (  " max 3D snow ", " min 3D snow ", "mm/d", P_snow, h, 8.46e4 );
+    diagnostics.add_3D ( " max 3D snow ", " min 3D snow ", "mm/d", P_snow, 8.46e4 );
 
     //  searching of maximum and minimum values of co2
-    min_max_3d.searchMinMax_3D ( " max 3D co2 ", " min 3D co2 ", "ppm", co2, h, 280. );
+    diagnostics.add_3D ( " max 3D co2 ", " min 3D co2 ", "ppm", co2, 280. );
 
     //  searching of maximum and minimum values of epsilon
-    min_max_3d.searchMinMax_3D ( " max 3D epsilon ",  " min 3D epsilon ", "%", epsilon_3D, h );
+    diagnostics.add_3D ( " max 3D epsilon ",  " min 3D epsilon ", "%", epsilon_3D );
 
     //  searching of maximum and minimum values of buoyancy force
-    min_max_3d.searchMinMax_3D (  " max 3D buoyancy force ", " min 3D buoyancy force ", "kN/m2", BuoyancyForce, h );
+    if ( BuoyancyForce.is_allocated() ){
+        diagnostics.add_3D ( " max 3D buoyancy force ", " min 3D buoyancy force ", "kN/m2", BuoyancyForce );
+    }
 
 
 
     // 2D-fields
 
-    cout << endl << " printout of maximum and minimum values of properties at their locations: latitude, longitude" << endl << 
-        " results based on two dimensional considerations of the problem" << endl;
+    diagnostics.add_text ( "\n printout of maximum and minimum values of properties at their locations: latitude, longitude\n"
+                           " results based on two dimensional considerations of the problem\n" );
 
-    cout << endl << " co2 distribution row-wise: " << endl << endl;
-
-    MinMax_Atm  min_max_2d ( jm, km );
+    diagnostics.add_text ( "\n co2 distribution row-wise: \n\n" );
 
     //  searching of maximum and minimum values of co2 total
-    min_max_2d.searchMinMax_2D ( " max co2_total ", " min co2_total ", " ppm ", co2_total, h, 280. );
+    diagnostics.add_2D ( " max co2_total ", " min co2_total ", " ppm ", co2_total, 280. );
 
-    cout << endl << " precipitation: " << endl << endl;
+    diagnostics.add_text ( "\n precipitation: \n\n" );
 
     //  searching of maximum and minimum values of precipitation
-    min_max_2d.searchMinMax_2D (  " max precipitation ", " min precipitation ", "mm/d", Precipitation, h, 1. );
-    max_Precipitation = min_max_2d.out_maxValue (  );
+    diagnostics.add_2D ( " max precipitation ", " min precipitation ", "mm/d", Precipitation, 1. );
 
     //  searching of maximum and minimum values of precipitable water
-    min_max_2d.searchMinMax_2D ( " max precipitable water ", " min precipitable water ", "mm", 
-                                 precipitable_water, h, 1. );
+    diagnostics.add_2D ( " max precipitable water ", " min precipitable water ", "mm", 
+                         precipitable_water, 1. );
 
-    cout << endl << " energies at see level without convection influence: " << endl << endl;
+    diagnostics.add_text ( "\n energies at see level without convection influence: \n\n" );
 
     //  searching of maximum and minimum values of radiation
-    min_max_2d.searchMinMax_2D ( " max 2D Q radiation ", " min 2D Q radiation ",  "W/m2", Q_radiation, h );
+    diagnostics.add_2D ( " max 2D Q radiation ", " min 2D Q radiation ",  "W/m2", Q_radiation );
 
     //  searching of maximum and minimum values of latent energy
-    min_max_2d.searchMinMax_2D ( " max 2D Q latent ", " min 2D Q latent ", "W/m2", Q_latent, h );
+    diagnostics.add_2D ( " max 2D Q latent ", " min 2D Q latent ", "W/m2", Q_latent );
 
     //  searching of maximum and minimum values of sensible energy
-    min_max_2d.searchMinMax_2D ( " max 2D Q sensible ", " min 2D Q sensible ", "W/m2", Q_sensible, h );
+    diagnostics.add_2D ( " max 2D Q sensible ", " min 2D Q sensible ", "W/m2", Q_sensible );
 
     //  searching of maximum and minimum values of bottom heat
-    min_max_2d.searchMinMax_2D ( " max 2D Q bottom ", " min 2D Q bottom heat ", "W/m2", Q_bottom, h );
+    diagnostics.add_2D ( " max 2D Q bottom ", " min 2D Q bottom heat ", "W/m2", Q_bottom );
 
-    cout << endl << " secondary data: " << endl << endl;
+    diagnostics.add_text ( "\n secondary data: \n\n" );
 
     //  searching of maximum and minimum values of Evaporation
-    min_max_2d.searchMinMax_2D ( " max heat Evaporation ", " min heat Evaporation ", " kJ/kg", Q_Evaporation, h );
+    diagnostics.add_2D ( " max heat Evaporation ", " min heat Evaporation ", " kJ/kg", Q_Evaporation );
 
     //  searching of maximum and minimum values of Evaporation by Dalton
-    min_max_2d.searchMinMax_2D ( " max Evaporation Dalton ", " min Evaporation Dalton ", "mm/d", Evaporation_Dalton, h );
+    diagnostics.add_2D ( " max Evaporation Dalton ", " min Evaporation Dalton ", "mm/d", Evaporation_Dalton );
 
     //  searching of maximum and minimum values of Evaporation by Penman
-    min_max_2d.searchMinMax_2D ( " max Evaporation Penman ", " min Evaporation Penman ", "mm/d", Evaporation_Penman, h );
+    diagnostics.add_2D ( " max Evaporation Penman ", " min Evaporation Penman ", "mm/d", Evaporation_Penman );
 
-    cout << endl << " properties of the atmosphere at the surface: " << endl << endl;
+    diagnostics.add_text ( "\n properties of the atmosphere at the surface: \n\n" );
 
     //  searching of maximum and minimum values of albedo
-    min_max_2d.searchMinMax_2D (  " max 2D albedo ", " min 2D albedo ", "%", albedo, h );
+    diagnostics.add_2D ( " max 2D albedo ", " min 2D albedo ", "%", albedo );
 
     //  searching of maximum and minimum values of epsilon
-    min_max_2d.searchMinMax_2D ( " max 2D epsilon ", " min 2D epsilon ", "%", epsilon, h );
+    diagnostics.add_2D ( " max 2D epsilon ", " min 2D epsilon ", "%", epsilon );
 
     //  searching of maximum and minimum values of topography
-    min_max_2d.searchMinMax_2D ( " max 2D topography ", " min 2D topography ", "m", Topography, h );
+    diagnostics.add_2D ( " max 2D topography ", " min 2D topography ", "m", Topography );
 }
 
 
 void cAtmosphereModel::write_file(std::string &bathymetry_name, std::string &output_path, bool is_final_result){
     int Ma = int(round(*get_current_time()));
+    int n = iter_cnt-1;
+
+    //  surface data for the hydrosphere in memory
+    surface_transfer.store ( bathymetry_name, jm, km, u_0, v, w, t, p_dyn, Evaporation_Dalton, Precipitation );
+
+    //  the output writer writes the files from copies of the fields while the computation continues
+    std::shared_ptr<OutputSnapshot> snapshot = std::make_shared<OutputSnapshot>();
+    if ( output_writer.get_depth() > 0 ){
+        std::vector<Array*> fields_3d;
+        std::vector<Array_2D*> fields_2d;
+        snapshot_fields ( fields_3d, fields_2d );
+        snapshot->take ( fields_3d, fields_2d );
+    }
+    output_writer.submit ( [ this, snapshot, bathymetry_name, output_path, Ma, n, is_final_result ] ( ){
+        write_results ( *snapshot, bathymetry_name, output_path, Ma, n, is_final_result );
+    } );
+
+    if(debug){
+        PostProcess_Atmosphere ppa ( im, jm, km, output_path );
+        ppa.save(output_path+"/residuum_"+std::to_string(n)+".dat", 
+                std::vector<std::string>{"residuum"},
+                std::vector<Vector3D<>* >{residuum_3d.get()},
+                1);
+    }
+}
+
+
+void cAtmosphereModel::snapshot_fields ( std::vector<Array*> &fields_3d, std::vector<Array_2D*> &fields_2d )
+{
+    //  only the fields of the files which are written, the PlotData and transfer files need a few
+    fields_3d = { &h, &p_dyn, &t, &v, &w, &c };
+    fields_2d = { &precipitable_water, &Evaporation_Dalton, &Precipitation };
+    if ( paraview_output || paraview_panorama_vts ){
+        fields_3d.insert ( fields_3d.end(), 
+            { &p_stat, &BuoyancyForce, &u, &co2, &cloud, &ice, &aux_u, &aux_v, &aux_w, &radiation_3D, 
+              &Q_Latent, &Q_Sensible, &epsilon_3D, &P_rain, &P_snow, &S_v, &S_c, &S_i, &S_r, &S_s, &S_c_c } );
+        fields_2d.insert ( fields_2d.end(), 
+            { &Q_bottom, &Q_radiation, &Q_latent, &Q_sensible, &Evaporation_Penman, &Q_Evaporation, 
+              &temperature_NASA, &precipitation_NASA, &Vegetation, &albedo, &epsilon, &Topography, &temp_NASA } );
+    }
+}
+
+
+void cAtmosphereModel::write_results ( const OutputSnapshot &f, std::string bathymetry_name, std::string output_path,
+                                       int Ma, int n, bool is_final_result ){
     //  Printout:
 
     //  printout in ParaView files and sequel files
 
     //  class PostProcess_Atmosphaere for the printing of results
-    PostProcess_Atmosphere write_File ( im, jm, km, output_path );
-
-    //  writing of data in ParaView files
-    //  radial data along constant hight above ground
-    int i_radial = 0;
-    //  int i_radial = 10;
-    write_File.paraview_vtk_radial ( bathymetry_name, Ma, i_radial, iter_cnt-1, u_0, t_0, p_0, r_air, c_0, co2_0, h, p_dyn, p_stat, 
-                                     BuoyancyForce, t, u, v, w, c, co2, cloud, ice, aux_u, aux_v, aux_w, radiation_3D, 
-                                     Q_Latent, Q_Sensible, epsilon_3D, P_rain, P_snow, precipitable_water, Q_bottom, 
-                                     Q_radiation, Q_latent, Q_sensible, Evaporation_Penman, Evaporation_Dalton, 
-                                     Q_Evaporation, temperature_NASA, precipitation_NASA, Vegetation, albedo, epsilon, 
-                                     Precipitation, Topography, temp_NASA );
-
-    //  londitudinal data along constant latitudes
-    int j_longal = 62;          // Mount Everest/Himalaya
-    write_File.paraview_vtk_longal ( bathymetry_name, j_longal, iter_cnt-1, u_0, t_0, p_0, r_air, c_0, co2_0, h, p_dyn, p_stat, 
-                                     BuoyancyForce, t, u, v, w, c, co2, cloud, ice, aux_u, aux_v, aux_w, Q_Latent, 
-                                     Q_Sensible, epsilon_3D, P_rain, P_snow );
-
-    int k_zonal = 87;           // Mount Everest/Himalaya
-    write_File.paraview_vtk_zonal ( bathymetry_name, k_zonal, iter_cnt-1, hp, ep, R_Air, g, L_atm, u_0, t_0, p_0, 
-                                    r_air, c_0, co2_0, 
-                                    h, p_dyn, p_stat, BuoyancyForce, t, u, v, w, c, co2, cloud, ice, aux_u, aux_v, aux_w, 
-                                    Q_Latent, Q_Sensible, radiation_3D, epsilon_3D, P_rain, P_snow, S_v, S_c, S_i, S_r, 
-                                    S_s, S_c_c );
+    PostProcess_Atmosphere write_File ( im, jm, km, output_path, vtk_format, vtk_float64 );
+
+    if ( paraview_output ){
+        //  writing of data in ParaView files
+        //  radial data along constant hight above ground
+        int i_radial = 0;
+        //  int i_radial = 10;
+        write_File.paraview_vtk_radial ( bathymetry_name, Ma, i_radial, n, u_0, t_0, p_0, r_air, c_0, co2_0, f ( h ),
+                                         f ( p_dyn ), f ( p_stat ), f ( BuoyancyForce ), f ( t ), f ( u ), f ( v ), f ( w ),
+                                         f ( c ), f ( co2 ), f ( cloud ), f ( ice ), f ( aux_u ), f ( aux_v ), f ( aux_w ),
+                                         f ( radiation_3D ), f ( Q_Latent ), f ( Q_Sensible ), f ( epsilon_3D ),
+                                         f ( P_rain ), f ( P_snow ), f ( precipitable_water ), f ( Q_bottom ),
+                                         f ( Q_radiation ), f ( Q_latent ), f ( Q_sensible ), f ( Evaporation_Penman ),
+                                         f ( Evaporation_Dalton ), f ( Q_Evaporation ), f ( temperature_NASA ),
+                                         f ( precipitation_NASA ), f ( Vegetation ), f ( albedo ), f ( epsilon ),
+                                         f ( Precipitation ), f ( Topography ), f ( temp_NASA ) );
+
+        //  londitudinal data along constant latitudes
+        int j_longal = 62;          // Mount Everest/Himalaya
+        write_File.paraview_vtk_longal ( bathymetry_name, j_longal, n, u_0, t_0, p_0, r_air, c_0, co2_0, f ( h ),
+                                         f ( p_dyn ), f ( p_stat ), f ( BuoyancyForce ), f ( t ), f ( u ), f ( v ), f ( w ),
+                                         f ( c ), f ( co2 ), f ( cloud ), f ( ice ), f ( aux_u ), f ( aux_v ), f ( aux_w ),
+                                         f ( Q_Latent ), f ( Q_Sensible ), f ( epsilon_3D ), f ( P_rain ), f ( P_snow ) );
+
+        int k_zonal = 87;           // Mount Everest/Himalaya
+        write_File.paraview_vtk_zonal ( bathymetry_name, k_zonal, n, hp, ep, R_Air, g, L_atm, u_0, t_0, p_0, r_air, c_0,
+                                        co2_0, f ( h ), f ( p_dyn ), f ( p_stat ), f ( BuoyancyForce ), f ( t ), f ( u ),
+                                        f ( v ), f ( w ), f ( c ), f ( co2 ), f ( cloud ), f ( ice ), f ( aux_u ),
+                                        f ( aux_v ), f ( aux_w ), f ( Q_Latent ), f ( Q_Sensible ), f ( radiation_3D ),
+                                        f ( epsilon_3D ), f ( P_rain ), f ( P_snow ), f ( S_v ), f ( S_c ), f ( S_i ),
+                                        f ( S_r ), f ( S_s ), f ( S_c_c ), saturation_table_exact );
+    }
 
     //  3-dimensional data in cartesian coordinate system for a streamline pattern in panorama view
     if(paraview_panorama_vts) //This function creates a large file. Use a flag to control if it is wanted.
     {
-        write_File.paraview_panorama_vts ( bathymetry_name, iter_cnt-1, u_0, t_0, p_0, r_air, c_0, co2_0, h, t, p_dyn, p_stat, 
-                                           BuoyancyForce, u, v, w, c, co2, cloud, ice, aux_u, aux_v, aux_w, Q_Latent, 
-                                           Q_Sensible, epsilon_3D, P_rain, P_snow );
+        write_File.paraview_panorama_vts ( bathymetry_name, n, u_0, t_0, p_0, r_air, c_0, co2_0, f ( h ), f ( t ),
+                                           f ( p_dyn ), f ( p_stat ), f ( BuoyancyForce ), f ( u ), f ( v ), f ( w ),
+                                           f ( c ), f ( co2 ), f ( cloud ), f ( ice ), f ( aux_u ), f ( aux_v ),
+                                           f ( aux_w ), f ( Q_Latent ), f ( Q_Sensible ), f ( epsilon_3D ),
+                                           f ( P_rain ), f ( P_snow ) );
     }
 
-    //  writing of v-w-data in the v_w_transfer file
+    //  surface data for the hydrosphere in the v_w_transfer file
     PostProcess_Atmosphere ppa ( im, jm, km, output_path );
-    ppa.Atmosphere_v_w_Transfer ( bathymetry_name, u_0, v, w, t, p_dyn, Evaporation_Dalton, Precipitation );
-    ppa.Atmosphere_PlotData ( bathymetry_name, (is_final_result ? -1 : iter_cnt-1), u_0, t_0, h, v, w, t, c, 
-                              Precipitation, precipitable_water );
-
-    if(debug){
-        ppa.save(output_path+"/residuum_"+std::to_string(iter_cnt-1)+".dat", 
-                std::vector<std::string>{"residuum"},
-                std::vector<Vector3D<>* >{&residuum_3d},
-                1);
+    if ( transfer_file ){
+        ppa.Atmosphere_v_w_Transfer ( bathymetry_name, u_0, f ( v ), f ( w ), f ( t ), f ( p_dyn ),
+                                      f ( Evaporation_Dalton ), f ( Precipitation ) );
     }
+    ppa.Atmosphere_PlotData ( bathymetry_name, (is_final_result ? -1 : n), u_0, t_0, f ( h ), f ( v ), f ( w ), f ( t ),
+                              f ( c ), f ( Precipitation ), f ( precipitable_water ) );
 }
 
-void cAtmosphereModel::run_2D_loop( BC_Atmosphere &boundary, RungeKutta_Atmosphere &result,
+int cAtmosphereModel::run_2D_loop( BC_Atmosphere &boundary, RungeKutta_Atmosphere &result,
                                     BC_Bathymetry_Atmosphere &LandArea, RHS_Atmosphere &prepare_2D, 
                                     Pressure_Atm &startPressure, BC_Thermo &circulation){
     int switch_2D = 0;    
     iter_cnt = 1;
     int Ma = int(round(*get_current_time())); 
 
+    ConvergenceControl convergence_2D ( "2D AGCM", pressure_iter_max_2D, velocity_iter_max_2D, nm, 
+                                        convergence_window, epsres, convergence_steady_eps );
+
     // ::::::::::: :::::::::::::::::::::::   begin of 2D loop for initial surface conditions: if ( switch_2D == 0 )   ::::
     if ( switch_2D != 1 )
     {
@@ -670,12 +961,12 @@ void cAtmosphereModel::run_2D_loop( BC_Atmosphere &boundary, RungeKutta_Atmosphe
             for ( int velocity_iter_2D = 1; velocity_iter_2D <= velocity_iter_max_2D; velocity_iter_2D++)
             {
 
-                cout << endl << endl;
-                cout << " >>>>>>>>>>>>>>>>>>>>>>>>>>>>>    2D    <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<" << endl;
-                cout << " 2D AGCM iterational process" << endl;
-                cout << " max total iteration number nm = " << nm << endl << endl;
+                get_output() << endl << endl;
+                get_output() << " >>>>>>>>>>>>>>>>>>>>>>>>>>>>>    2D    <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<" << endl;
+                get_output() << " 2D AGCM iterational process" << endl;
+                get_output() << " max total iteration number nm = " << nm << endl << endl;
 
-                cout << " present state of the 2D computation " << endl << "  current time slice, number of iterations, maximum "
+                get_output() << " present state of the 2D computation " << endl << "  current time slice, number of iterations, maximum "
                     << "and current number of velocity iterations, maximum and current number of pressure iterations " << endl 
                     << endl << " Ma = " << Ma << "     n = " << iter_cnt << "    velocity_iter_max_2D = " << velocity_iter_max_2D
                     << "     velocity_iter_2D = " << velocity_iter_2D << "    pressure_iter_max_2D = " << pressure_iter_max_2D << 
@@ -715,14 +1006,21 @@ void cAtmosphereModel::run_2D_loop( BC_Atmosphere &boundary, RungeKutta_Atmosphe
                 emin = fabs ( ( residuum - residuum_old ) / residuum_old );
                 
                 //  state of a steady solution resulting from the pressure equation ( min_p ) for pn from the actual solution step
-                min_Residuum_2D.steadyQuery_2D ( v, vn, w, wn, p_dyn, p_dynn );
+                double steady_change = min_Residuum_2D.steadyQuery_2D ( v, vn, w, wn, p_dyn, p_dynn );
+
+                convergence_2D.update ( emin, steady_change, residuum );
 
                 move_data_to_new_arrays(jm, km, 1., old_arrays_2d, new_arrays_2d);
 
                 iter_cnt++;
+
+                if ( convergence_2D.is_converged() )  break;
             }
             //  ::::::   end of velocity loop_2D: if ( velocity_iter_2D > velocity_iter_max_2D )   ::::::::::::::::::::::
 
+            //  steady solution reached, the remaining iterations are skipped
+            if ( convergence_2D.is_converged() )  break;
+
 
             //  pressure from the Euler equation ( 2. order derivatives of the pressure by adding the Poisson right hand sides )
             startPressure.computePressure_2D ( u_0, r_air, rad, the, p_dyn, p_dynn, h, aux_v, aux_w );
@@ -730,17 +1028,22 @@ void cAtmosphereModel::run_2D_loop( BC_Atmosphere &boundary, RungeKutta_Atmosphe
             // limit of the computation in the sense of time steps
             if ( iter_cnt > nm )
             {
-                cout << "       nm = " << nm << "     .....     maximum number of iterations   nm   reached!" << endl;
+                get_output() << "       nm = " << nm << "     .....     maximum number of iterations   nm   reached!" << endl;
                 break;
             }
         }
         // :::::::::::::::::::   end of pressure loop_2D: if ( pressure_iter_2D > pressure_iter_max_2D )   ::::::::::
+
+        get_output() << endl << convergence_2D.report() << endl;
+        logger() << convergence_2D.report() << std::endl;
     }
     // ::::::::   end of 2D loop for initial surface conditions: if ( switch_2D == 0 )   :::::::::::::::::::::::::::::
+
+    return convergence_2D.iterations();
 }
 
 
-void cAtmosphereModel::run_3D_loop( BC_Atmosphere &boundary, RungeKutta_Atmosphere &result,
+int cAtmosphereModel::run_3D_loop( BC_Atmosphere &boundary, RungeKutta_Atmosphere &result,
                                     BC_Bathymetry_Atmosphere &LandArea, RHS_Atmosphere &prepare,
                                     Pressure_Atm &startPressure, Results_MSL_Atm &calculate_MSL,                  
                                     BC_Thermo &circulation){
@@ -750,23 +1053,69 @@ void cAtmosphereModel::run_3D_loop( BC_Atmosphere &boundary, RungeKutta_Atmosphe
 
     int Ma = int(round(*get_current_time()));
 
+    ConvergenceControl convergence_3D ( "3D AGCM", pressure_iter_max, velocity_iter_max, nm, 
+                                        convergence_window, epsres, convergence_steady_eps );
+
+    //  the iterations of a resumed time slice continue after the last one of the restart file
+    int pressure_iter_start = 1, velocity_iter_start = 1;
+    if ( !restart_state.empty() ){
+        iter_cnt = int ( restart_state[ "iter_cnt" ] );
+        emin = restart_state[ "emin" ];
+        max_Precipitation = restart_state[ "max_Precipitation" ];
+        pressure_iter_start = int ( restart_state[ "pressure_iter" ] );
+        velocity_iter_start = int ( restart_state[ "velocity_iter" ] );
+        convergence_3D.restore ( restart_state );
+    }
+
     move_data_to_new_arrays(im, jm, km, 1., old_arrays_3d, new_arrays_3d);
 
+    //  extrema of the fields, searched in each iteration, printed every diagnostics_interval iterations
+    Diagnostics_Atm diagnostics ( im, jm, km );
+    add_diagnostics ( diagnostics );
+    std::ofstream diagnostics_stream;
+    if ( diagnostics_json ){
+        diagnostics_stream.open ( output_path + "/" + std::to_string ( Ma ) + "Ma_atm_diagnostics.jsonl",
+                                  restart_state.empty() ? std::ios::trunc : std::ios::app );
+    }
+
+    //  convergence of each iteration, a resumed time slice continues the records of the interrupted run
+    TelemetrySink telemetry_sink;
+    if ( telemetry ){
+        telemetry_sink.open ( output_path + "/" + std::to_string ( Ma ) + "Ma_atm_telemetry.jsonl", "atm", 
+                              !restart_state.empty() );
+    }
+
+    //  SIGINT and SIGTERM let the running iteration finish and write the restart file
+    CheckpointScope checkpoint_scope ( restart );
+
+    //  time spent in the phases of the iterations
+    phase_profile.reset();
+    phase_profile.count_hardware ( perf_counters );
+    IterationTimer iteration_timer ( phase_profile );
+
     /** ::::::::::::::   begin of 3D pressure loop : if ( pressure_iter > pressure_iter_max )   :::::::::::::::: **/
-    for ( int pressure_iter = 1; pressure_iter <= pressure_iter_max; pressure_iter++ )
+    for ( int pressure_iter = pressure_iter_start; 
+          pressure_iter <= pressure_iter_max && !convergence_3D.is_converged(); pressure_iter++ )
     {
+        TraceScope pressure_trace ( "pressure iteration", "iteration", "pressure_iter", pressure_iter );
+
         /** ::::::::::::   begin of 3D velocity loop : if ( velocity_iter > velocity_iter_max )   ::::::::::::::::::: **/
-        for ( int velocity_iter = 1; velocity_iter <= velocity_iter_max; velocity_iter++ )
+        for ( int velocity_iter = ( pressure_iter == pressure_iter_start ) ? velocity_iter_start : 1; 
+              velocity_iter <= velocity_iter_max; velocity_iter++ )
         {
-            Array tmp = (t-1)*t_0;
-            tmp.inspect();
+            TraceScope velocity_trace ( "velocity iteration", "iteration", "n", iter_cnt );
+            phase_profile.iteration();
+            if ( log_enabled ( LOG_DEBUG ) ){
+                Array tmp = (t-1)*t_0;
+                tmp.inspect();
+            }
             //  query to realize zero divergence of the continuity equation ( div c = 0 )
-            cout << endl << endl;
-            cout << " >>>>>>>>>>>>>>>>>>>>>>>>>>>>>    3D    <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<" << endl;
-            cout << " 3D AGCM iterational process" << endl;
-            cout << " max total iteration number nm = " << nm << endl << endl;
+            get_output() << endl << endl;
+            get_output() << " >>>>>>>>>>>>>>>>>>>>>>>>>>>>>    3D    <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<" << endl;
+            get_output() << " 3D AGCM iterational process" << endl;
+            get_output() << " max total iteration number nm = " << nm << endl << endl;
 
-            cout << " present state of the computation " << endl << " current time slice, number of iterations, maximum "
+            get_output() << " present state of the computation " << endl << " current time slice, number of iterations, maximum "
                 << "and current number of velocity iterations, maximum and current number of pressure iterations " << endl << 
                 endl << " Ma = " << Ma << "     n = " << iter_cnt << "    velocity_iter_max = " << velocity_iter_max << 
                 "     velocity_iter = " << velocity_iter << "    pressure_iter_max = " << pressure_iter_max << 
@@ -774,26 +1123,40 @@ void cAtmosphereModel::run_3D_loop( BC_Atmosphere &boundary, RungeKutta_Atmosphe
 
             //  old value of the residuum ( div c = 0 ) for the computation of the continuity equation ( min )
             Accuracy_Atm        min_Residuum ( im, jm, km, dr, dthe, dphi );
-            double residuum_old = std::get<0>(min_Residuum.residuumQuery_3D ( rad, the, u, v, w, residuum_3d ));
+            double residuum_old;
+            {
+                PhaseTimer timer ( phase_profile, "residuum/steady queries" );
+                residuum_old = std::get<0>(min_Residuum.residuumQuery_3D ( rad, the, u, v, w, residuum_3d.get() ));
+            }
             
             //logger() <<  residuum_3d(1, 30, 150) << " residuum_mchin" <<Ma<<std::endl;
             
             //  class BC_Atmosphaere for the geometry of a shell of a sphere
-            boundary.BC_radius ( t, u, v, w, p_dyn, c, cloud, ice, co2 );
-            boundary.BC_theta ( t, u, v, w, p_dyn, c, cloud, ice, co2 );
-            boundary.BC_phi ( t, u, v, w, p_dyn, c, cloud, ice, co2 );
+            {
+                PhaseTimer timer ( phase_profile, "boundary conditions" );
+                boundary.BC_radius ( t, u, v, w, p_dyn, c, cloud, ice, co2 );
+                boundary.BC_theta ( t, u, v, w, p_dyn, c, cloud, ice, co2 );
+                boundary.BC_phi ( t, u, v, w, p_dyn, c, cloud, ice, co2 );
+            }
 
             //Ice_Water_Saturation_Adjustment, distribution of cloud ice and cloud water dependent on water vapour amount and temperature
             if ( velocity_iter % 2 == 0 ){
+                PhaseTimer timer ( phase_profile, "Ice_Water_Saturation_Adjustment" );
                 circulation.Ice_Water_Saturation_Adjustment ( h, c, cn, cloud, cloudn, ice, icen, t, p_stat, S_c_c );
             }
 
-            circulation.Value_Limitation_Atm ( h, u, v, w, p_dyn, t, c, cloud, ice, co2 );
+            {
+                PhaseTimer timer ( phase_profile, "Value_Limitation_Atm" );
+                circulation.Value_Limitation_Atm ( h, u, v, w, p_dyn, t, c, cloud, ice, co2 );
+            }
 
-            LandArea.BC_SolidGround ( RadiationModel, Ma, g, hp, ep, r_air, R_Air, t_0, c_0, t_land, t_cretaceous, t_equator, 
-                                      t_pole, t_tropopause, c_land, c_tropopause, co2_0, co2_equator, co2_pole, 
-                                      co2_tropopause, pa, gam, sigma, h, u, v, w, t, p_dyn, c, cloud, 
-                                      ice, co2, radiation_3D, Vegetation );
+            {
+                PhaseTimer timer ( phase_profile, "BC_SolidGround" );
+                LandArea.BC_SolidGround ( RadiationModel, Ma, g, hp, ep, r_air, R_Air, t_0, c_0, t_land, t_cretaceous, 
+                                          t_equator, t_pole, t_tropopause, c_land, c_tropopause, co2_0, co2_equator, 
+                                          co2_pole, co2_tropopause, pa, gam, sigma, h, u, v, w, t, p_dyn, c, cloud, 
+                                          ice, co2, radiation_3D, Vegetation );
+            }
 /*
         logger() << "§§§§§§§§§§§§§§§§§§§§§§§§§§§§§§§§   global iteration n = " << iter_cnt << "   §§§§§§§§§§§§§§§§§§§§§§§§§§§§§§§§§§§§§§§" << std::endl << std::endl;
 
@@ -806,13 +1169,16 @@ void cAtmosphereModel::run_3D_loop( BC_Atmosphere &boundary, RungeKutta_Atmosphe
         logger() << "enter cAtmosphereModel solveRungeKutta_3D_Atmosphere: ice max: " << ice.max() * 1000. << std::endl << std::endl;
 */
             // class RungeKutta for the solution of the differential equations describing the flow properties
-            result.solveRungeKutta_3D_Atmosphere ( prepare, iter_cnt, lv, ls, ep, hp, u_0, t_0, c_0, co2_0, p_0, r_air, 
-                                                   r_water_vapour, r_co2, L_atm, cp_l, R_Air, R_WaterVapour, R_co2, rad, 
-                                                   the, phi, rhs_t, rhs_u, rhs_v, rhs_w, rhs_c, rhs_cloud, rhs_ice, rhs_co2, 
-                                                   h, t, u, v, w, p_dyn, p_stat, c, cloud, ice, co2, tn, un, vn, wn, p_dynn, 
-                                                   cn, cloudn, icen, co2n, aux_u, aux_v, aux_w, Q_Latent, BuoyancyForce, 
-                                                   Q_Sensible, P_rain, P_snow, S_v, S_c, S_i, S_r, S_s, S_c_c, Topography, 
-                                                   Evaporation_Dalton, Precipitation );
+            {
+                PhaseTimer timer ( phase_profile, "solveRungeKutta_3D_Atmosphere" );
+                result.solveRungeKutta_3D_Atmosphere ( prepare, iter_cnt, lv, ls, ep, hp, u_0, t_0, c_0, co2_0, p_0, r_air, 
+                                                       r_water_vapour, r_co2, L_atm, cp_l, R_Air, R_WaterVapour, R_co2, rad, 
+                                                       the, phi, rhs_t, rhs_u, rhs_v, rhs_w, rhs_c, rhs_cloud, rhs_ice, rhs_co2, 
+                                                       h, t, u, v, w, p_dyn, p_stat, c, cloud, ice, co2, tn, un, vn, wn, p_dynn, 
+                                                       cn, cloudn, icen, co2n, aux_u, aux_v, aux_w, Q_Latent, BuoyancyForce, 
+                                                       Q_Sensible, P_rain, P_snow, S_v, S_c, S_i, S_r, S_s, S_c_c, Topography, 
+                                                       Evaporation_Dalton, Precipitation );
+            }
 /*
         logger() << "end cAtmosphereModel solveRungeKutta_3D_Atmosphere: t max: " << (t.max() - 1)*t_0 << std::endl;
         logger() << "end cAtmosphereModel solveRungeKutta_3D_Atmosphere: p_dyn max: " << p_dyn.max() << std::endl;
@@ -822,56 +1188,110 @@ void cAtmosphereModel::run_3D_loop( BC_Atmosphere &boundary, RungeKutta_Atmosphe
         logger() << "end cAtmosphereModel solveRungeKutta_3D_Atmosphere: cloud water max: " << cloud.max() * 1000. << std::endl;
         logger() << "end cAtmosphereModel solveRungeKutta_3D_Atmosphere: ice max: " << ice.max() * 1000. << std::endl << std::endl;
 */
-            circulation.Value_Limitation_Atm ( h, u, v, w, p_dyn, t, c, cloud, ice, co2 );
+            {
+                PhaseTimer timer ( phase_profile, "Value_Limitation_Atm" );
+                circulation.Value_Limitation_Atm ( h, u, v, w, p_dyn, t, c, cloud, ice, co2 );
+            }
 
             // class element for the surface temperature computation by radiation flux density
             if ( RadiationModel == 1 ){
-                 circulation.BC_Radiation_multi_layer ( albedo, epsilon, radiation_surface, 
-                                                        p_stat, t, c, h, epsilon_3D, radiation_3D, cloud, ice, co2 );
+                PhaseTimer timer ( phase_profile, "BC_Radiation_multi_layer" );
+                circulation.BC_Radiation_multi_layer ( albedo, epsilon, radiation_surface, 
+                                                       p_stat, t, c, h, epsilon_3D, radiation_3D, cloud, ice, co2 );
             }
             //  new value of the residuum ( div c = 0 ) for the computation of the continuity equation ( min )
-            double residuum = std::get<0>(min_Residuum.residuumQuery_3D ( rad, the, u, v, w, residuum_3d ));
+            double residuum, steady_change;
+            {
+                PhaseTimer timer ( phase_profile, "residuum/steady queries" );
+                residuum = std::get<0>(min_Residuum.residuumQuery_3D ( rad, the, u, v, w, residuum_3d.get() ));
 
-            emin = fabs ( ( residuum - residuum_old ) / residuum_old );
+                emin = fabs ( ( residuum - residuum_old ) / residuum_old );
+
+                //  statements on the convergence und iterational process
+                steady_change = min_Residuum.steadyQuery_3D ( u, un, v, vn, w, wn, t, tn, c, cn, cloud, cloudn, 
+                                                              ice, icen, co2, co2n, p_dyn, p_dynn, L_atm);
+            }
 
-            //  statements on the convergence und iterational process
-            min_Residuum.steadyQuery_3D ( u, un, v, vn, w, wn, t, tn, c, cn, cloud, cloudn, ice, icen, co2, co2n, p_dyn, 
-                                          p_dynn, L_atm);
+            convergence_3D.update ( emin, steady_change, residuum );
 
             // 3D_fields
 
             //  class element for the initial conditions the latent heat
-            circulation.Latent_Heat ( rad, the, phi, h, t, tn, u, v, w, p_dyn, p_stat, c, ice, Q_Latent, Q_Sensible, 
-                                      radiation_3D, Q_radiation, Q_latent, Q_sensible, Q_bottom );
+            {
+                PhaseTimer timer ( phase_profile, "Latent_Heat" );
+                circulation.Latent_Heat ( rad, the, phi, h, t, tn, u, v, w, p_dyn, p_stat, c, ice, Q_Latent, Q_Sensible, 
+                                          radiation_3D, Q_radiation, Q_latent, Q_sensible, Q_bottom );
+            }
 
-            print_min_max_values();
+            {
+                PhaseTimer timer ( phase_profile, "diagnostics" );
+                diagnostics.search();
+                max_Precipitation = diagnostics.out_maxValue ( " max precipitation " );
+                if ( diagnostics_interval > 0 && iter_cnt % diagnostics_interval == 0 ){
+                    diagnostics.print();
+                }
+                if ( diagnostics_stream.is_open() ){
+                    diagnostics.write_json ( diagnostics_stream, Ma, iter_cnt );
+                }
+            }
 
             //  computation of vegetation areas
             LandArea.vegetationDistribution ( max_Precipitation, Precipitation, Vegetation, t, h );
 
 
             //  composition of results
-            calculate_MSL.run_MSL_data ( iter_cnt, velocity_iter_max, RadiationModel, t_cretaceous, rad, the, phi, h, c, cn, 
-                                         co2, co2n, t, tn, p_dyn, p_stat, BuoyancyForce, u, v, w, Q_Latent, Q_Sensible, 
-                                         radiation_3D, cloud, cloudn, ice, icen, P_rain, P_snow, aux_u, aux_v, aux_w, 
-                                         temperature_NASA, precipitation_NASA, precipitable_water, Q_radiation, Q_Evaporation, 
-                                         Q_latent, Q_sensible, Q_bottom, Evaporation_Penman, Evaporation_Dalton, Vegetation, 
-                                         albedo, co2_total, Precipitation, S_v, S_c, S_i, S_r, S_s, S_c_c );
+            {
+                PhaseTimer timer ( phase_profile, "run_MSL_data" );
+                calculate_MSL.run_MSL_data ( iter_cnt, velocity_iter_max, RadiationModel, t_cretaceous, rad, the, phi, h, c, cn, 
+                                             co2, co2n, t, tn, p_dyn, p_stat, BuoyancyForce, u, v, w, Q_Latent, Q_Sensible, 
+                                             radiation_3D, cloud, cloudn, ice, icen, P_rain, P_snow, aux_u, aux_v, aux_w, 
+                                             temperature_NASA, precipitation_NASA, precipitable_water, Q_radiation, 
+                                             Q_Evaporation, Q_latent, Q_sensible, Q_bottom, Evaporation_Penman, 
+                                             Evaporation_Dalton, Vegetation, albedo, co2_total, Precipitation, 
+                                             S_v, S_c, S_i, S_r, S_s, S_c_c, math_accuracy, saturation_table_exact );
+            }
 
             //  Two-Category-Ice-Scheme, COSMO-module from the German Weather Forecast, 
             //  resulting the precipitation distribution formed of rain and snow
             if ( velocity_iter % 2 == 0){
+                PhaseTimer timer ( phase_profile, "Two_Category_Ice_Scheme" );
                 circulation.Two_Category_Ice_Scheme ( h, c, t, p_stat, 
                                                       cloud, ice, P_rain, P_snow, S_v, S_c, S_i, S_r, S_s, S_c_c );
             }
 
-            move_data_to_new_arrays(im, jm, km, 1., old_arrays_3d, new_arrays_3d);
+            {
+                PhaseTimer timer ( phase_profile, "move_data_to_new_arrays" );
+                move_data_to_new_arrays(im, jm, km, 1., old_arrays_3d, new_arrays_3d);
+            }
+
+            if ( telemetry_sink.is_open() ){
+                TelemetrySink::Iteration iteration = { Ma, iter_cnt, pressure_iter, velocity_iter, dt, residuum, emin, 
+                                                       steady_change };
+                telemetry_sink.record ( iteration, min_Residuum.out_changes(), phase_profile );
+            }
             iter_cnt++;
+
+            if ( restart && ( Checkpoint::stop_requested() || 
+                              ( restart_interval > 0 && ( iter_cnt - 1 ) % restart_interval == 0 ) ) ){
+                write_restart ( Ma, pressure_iter, velocity_iter + 1, convergence_3D );
+                if ( Checkpoint::stop_requested() ){
+                    output_writer.wait();
+                    Checkpoint::stop();
+                }
+            }
+
+            if ( convergence_3D.is_converged() )  break;
         }
         /**  ::::::::::::   end of velocity loop_3D: if ( velocity_iter > velocity_iter_max )   :::::::::::::::::::::::::::: **/
+
+        //  steady solution reached, the remaining iterations are skipped
+        if ( convergence_3D.is_converged() )  break;
         
         //  pressure from the Euler equation ( 2. order derivatives of the pressure by adding the Poisson right hand sides )
-        startPressure.computePressure_3D ( u_0, r_air, rad, the, p_dyn, p_dynn, h, aux_u, aux_v, aux_w );
+        {
+            PhaseTimer timer ( phase_profile, "computePressure_3D" );
+            startPressure.computePressure_3D ( u_0, r_air, rad, the, p_dyn, p_dynn, h, aux_u, aux_v, aux_w );
+        }
 /*
         //  Two-Category-Ice-Scheme, COSMO-module from the German Weather Forecast, 
         //  resulting the precipitation formed of rain and snow
@@ -884,17 +1304,162 @@ void cAtmosphereModel::run_3D_loop( BC_Atmosphere &boundary, RungeKutta_Atmosphe
         //logger() << std::get<0>(max_diff( im, jm, km, p_dyn, p_dynn)) << " pressure_max_diff" <<Ma<<std::endl;
 
         if( pressure_iter % checkpoint == 0 ){
+            PhaseTimer timer ( phase_profile, "write_file" );
             write_file(bathymetry_name, output_path);
         }
 
+        //  the pressure step is not part of an iteration of the velocity loop
+        if ( telemetry_sink.is_open() ){
+            telemetry_sink.record_pressure_step ( Ma, iter_cnt - 1, pressure_iter, phase_profile );
+        }
+
         //  limit of the computation in the sense of time steps
         if ( iter_cnt > nm )
         {
-            cout << "       nm = " << nm << "     .....     maximum number of iterations   nm   reached!" << endl;
+            get_output() << "       nm = " << nm << "     .....     maximum number of iterations   nm   reached!" << endl;
             break;
         }
     }
     /**  :::::   end of pressure loop_3D: if ( pressure_iter > pressure_iter_max )   ::::::::::::::::::::::::::::: **/
+
+    get_output() << endl << convergence_3D.report() << endl;
+    logger() << convergence_3D.report() << std::endl;
+
+    return convergence_3D.iterations();
+}
+
+
+AtomUtils::Checkpoint cAtmosphereModel::restart_checkpoint()
+{
+    Checkpoint checkpoint ( "atm", im, jm, km );
+    checkpoint.add ( "h", h );
+    checkpoint.add ( "t", t );
+    checkpoint.add ( "u", u );
+    checkpoint.add ( "v", v );
+    checkpoint.add ( "w", w );
+    checkpoint.add ( "c", c );
+    checkpoint.add ( "cloud", cloud );
+    checkpoint.add ( "ice", ice );
+    checkpoint.add ( "co2", co2 );
+    checkpoint.add ( "tn", tn );
+    checkpoint.add ( "un", un );
+    checkpoint.add ( "vn", vn );
+    checkpoint.add ( "wn", wn );
+    checkpoint.add ( "cn", cn );
+    checkpoint.add ( "cloudn", cloudn );
+    checkpoint.add ( "icen", icen );
+    checkpoint.add ( "co2n", co2n );
+    checkpoint.add ( "p_dyn", p_dyn );
+    checkpoint.add ( "p_dynn", p_dynn );
+    checkpoint.add ( "p_stat", p_stat );
+    checkpoint.add ( "rhs_t", rhs_t );
+    checkpoint.add ( "rhs_u", rhs_u );
+    checkpoint.add ( "rhs_v", rhs_v );
+    checkpoint.add ( "rhs_w", rhs_w );
+    checkpoint.add ( "rhs_c", rhs_c );
+    checkpoint.add ( "rhs_cloud", rhs_cloud );
+    checkpoint.add ( "rhs_ice", rhs_ice );
+    checkpoint.add ( "rhs_co2", rhs_co2 );
+    checkpoint.add ( "aux_u", aux_u );
+    checkpoint.add ( "aux_v", aux_v );
+    checkpoint.add ( "aux_w", aux_w );
+    checkpoint.add ( "Q_Latent", Q_Latent );
+    checkpoint.add ( "Q_Sensible", Q_Sensible );
+    if ( BuoyancyForce.is_allocated() ){
+        checkpoint.add ( "BuoyancyForce", BuoyancyForce );
+    }
+    checkpoint.add ( "epsilon_3D", epsilon_3D );
+    checkpoint.add ( "radiation_3D", radiation_3D );
+    checkpoint.add ( "P_rain", P_rain );
+    checkpoint.add ( "P_snow", P_snow );
+    checkpoint.add ( "S_v", S_v );
+    checkpoint.add ( "S_c", S_c );
+    checkpoint.add ( "S_i", S_i );
+    checkpoint.add ( "S_r", S_r );
+    checkpoint.add ( "S_s", S_s );
+    checkpoint.add ( "S_c_c", S_c_c );
+    checkpoint.add ( "Topography", Topography );
+    checkpoint.add ( "Vegetation", Vegetation );
+    checkpoint.add ( "Precipitation", Precipitation );
+    checkpoint.add ( "precipitable_water", precipitable_water );
+    checkpoint.add ( "precipitation_NASA", precipitation_NASA );
+    checkpoint.add ( "radiation_surface", radiation_surface );
+    checkpoint.add ( "temperature_NASA", temperature_NASA );
+    checkpoint.add ( "temp_NASA", temp_NASA );
+    checkpoint.add ( "albedo", albedo );
+    checkpoint.add ( "epsilon", epsilon );
+    checkpoint.add ( "Q_radiation", Q_radiation );
+    checkpoint.add ( "Q_Evaporation", Q_Evaporation );
+    checkpoint.add ( "Q_latent", Q_latent );
+    checkpoint.add ( "Q_sensible", Q_sensible );
+    checkpoint.add ( "Q_bottom", Q_bottom );
+    checkpoint.add ( "Evaporation_Dalton", Evaporation_Dalton );
+    checkpoint.add ( "Evaporation_Penman", Evaporation_Penman );
+    checkpoint.add ( "co2_total", co2_total );
+    return checkpoint;
+}
+
+
+std::vector<std::pair<std::string, std::size_t> > cAtmosphereModel::memory_fields()
+{
+    std::vector<std::pair<std::string, std::size_t> > fields = restart_checkpoint().field_bytes();
+    fields.push_back ( std::make_pair ( "residuum_2d", residuum_2d.bytes() ) );
+    if ( residuum_3d ){
+        fields.push_back ( std::make_pair ( "residuum_3d", residuum_3d->bytes() ) );
+    }
+    if ( !warm_arrays_3d.empty() ){
+        std::size_t bytes = warm_h.bytes();
+        for ( size_t n = 0; n < warm_arrays_3d.size(); n++ )  bytes += warm_arrays_3d[ n ].bytes();
+        fields.push_back ( std::make_pair ( "warm start", bytes ) );
+    }
+    return fields;
+}
+
+
+std::size_t cAtmosphereModel::slice_bytes()
+{
+    std::vector<std::pair<std::string, std::size_t> > fields = memory_fields();
+    std::size_t bytes = 0;
+    for ( size_t n = 0; n < fields.size(); n++ )  bytes += fields[ n ].second;
+
+    //  each queued snapshot of the output writer holds a copy of its fields
+    std::vector<Array*> fields_3d;
+    std::vector<Array_2D*> fields_2d;
+    snapshot_fields ( fields_3d, fields_2d );
+    std::size_t snapshot = 0;
+    for ( size_t n = 0; n < fields_3d.size(); n++ )  snapshot += fields_3d[ n ]->bytes();
+    for ( size_t n = 0; n < fields_2d.size(); n++ )  snapshot += fields_2d[ n ]->bytes();
+    return bytes + std::size_t ( std::max ( output_queue_depth, 0 ) ) * snapshot;
+}
+
+
+void cAtmosphereModel::report_memory ( const std::string &title )
+{
+    string report = MemoryAccount::report ( title, memory_fields() );
+    get_output() << endl << report << endl;
+    logger() << report << std::endl;
+}
+
+
+std::string cAtmosphereModel::restart_file ( int Ma ) const
+{
+    return output_path + "/" + std::to_string ( Ma ) + "Ma_atm.restart";
+}
+
+
+
+void cAtmosphereModel::write_restart ( int Ma, int pressure_iter, int velocity_iter, const ConvergenceControl &convergence )
+{
+    std::map<std::string, double> state;
+    state[ "iter_cnt" ] = iter_cnt;
+    state[ "emin" ] = emin;
+    state[ "max_Precipitation" ] = max_Precipitation;
+    state[ "pressure_iter" ] = pressure_iter;
+    state[ "velocity_iter" ] = velocity_iter;
+    convergence.save ( state );
+
+    restart_checkpoint().write ( restart_file ( Ma ), Ma, state );
+    logger() << "restart file " << restart_file ( Ma ) << " written at n = " << iter_cnt << std::endl;
 }
 
 
@@ -903,18 +1468,25 @@ void cAtmosphereModel::run_3D_loop( BC_Atmosphere &boundary, RungeKutta_Atmosphe
 */
 void cAtmosphereModel::load_temperature_curve()
 {
-    std::string line;
-    std::ifstream f(temperature_curve_file);
-    
-    if (!f.is_open()){
-        std::cout << "error while opening file: "<< temperature_curve_file << std::endl;
-    }
+    // the pairs of time and temperature are shared with the other models of the process
+    DatasetCache::Handle curve = DatasetCache::get ( temperature_curve_file, "curve", [this] ( DatasetCache::Data &pairs ){
+        std::string line;
+        std::ifstream f(temperature_curve_file);
+
+        if (!f.is_open()){
+            get_output() << "error while opening file: "<< temperature_curve_file << std::endl;
+        }
+
+        float time=0.,temperature=0;
+        while(getline(f, line)) {
+            std::stringstream(line) >> time >> temperature;
+            pairs.push_back ( time );
+            pairs.push_back ( temperature );
+        }
+    } );
 
-    float time=0.,temperature=0;
-    while(getline(f, line)) {
-        std::stringstream(line) >> time >> temperature;
-        m_temperature_curve.insert(std::pair<float,float>(time, temperature));
-        //std::cout << time <<"  " <<temperature<< std::endl;
+    for ( std::size_t n = 0; n + 1 < curve->size ( ); n += 2 ){
+        m_temperature_curve.insert(std::pair<float,float>(( *curve )[ n ], ( *curve )[ n + 1 ]));
     }
 }
 
@@ -924,11 +1496,11 @@ void cAtmosphereModel::load_temperature_curve()
 float cAtmosphereModel::get_mean_temperature_from_curve(float time) const
 {
     if(time<m_temperature_curve.begin()->first || time>(--m_temperature_curve.end())->first){
-        std::cout << "Input time out of range: " <<time<< std::endl;    
+        get_output() << "Input time out of range: " <<time<< std::endl;    
         return NAN;
     }
     if(m_temperature_curve.size()<2){
-        std::cout << "No enough data in m_temperature_curve  map" << std::endl;
+        get_output() << "No enough data in m_temperature_curve  map" << std::endl;
         return NAN;
     }
     map<float, float >::const_iterator upper=m_temperature_curve.begin(), bottom=++m_temperature_curve.begin(); 
@@ -942,7 +1514,7 @@ float cAtmosphereModel::get_mean_temperature_from_curve(float time) const
             upper = it;
         }
     }
-    //std::cout << upper->first << " " << bottom->first << std::endl;
+    //get_output() << upper->first << " " << bottom->first << std::endl;
     return upper->second + (time - upper->first) / (bottom->first - upper->first) * (bottom->second - upper->second);
 }
 
@@ -958,7 +1530,7 @@ float cAtmosphereModel::calculate_mean_temperature(const Array& temp)
     double ret=0., weight=0.;
     for(int j=0; j<jm; j++){
         for(int k=0; k<km; k++){
-            //std::cout << (t.x[0][j][k]-1)*t_0 << "  " << m_node_weights[j][k] << std::endl;
+            //get_output() << (t.x[0][j][k]-1)*t_0 << "  " << m_node_weights[j][k] << std::endl;
             ret += temp.x[0][j][k] * m_node_weights[j][k];
             weight += m_node_weights[j][k];
         }
@@ -5,6 +5,7 @@
 #include <set>
 #include <map>
 #include <vector>
+#include <memory>
 #include <fstream>
 
 #include "Array.h"
@@ -12,6 +13,12 @@
 #include "Array_1D.h"
 #include "tinyxml2.h"
 #include "PythonStream.h"
+#include "SurfaceTransfer.h"
+#include "OutputWriter.h"
+#include "Checkpoint.h"
+#include "PhaseTimer.h"
+#include "Logger.h"
+#include "FieldRegistry.h"
 
 class BC_Atmosphere;
 class RungeKutta_Atmosphere;
@@ -20,6 +27,11 @@ class RHS_Atmosphere;
 class Pressure_Atm;
 class Results_MSL_Atm;
 class BC_Thermo;
+class Diagnostics_Atm;
+
+namespace AtomUtils{
+    class ConvergenceControl;
+}
 
 using namespace std;
 using namespace tinyxml2;
@@ -33,17 +45,15 @@ public:
     cAtmosphereModel(const cAtmosphereModel&) =delete;
     cAtmosphereModel& operator=(const cAtmosphereModel&) =delete;
 
-    static cAtmosphereModel* get_model(){
-        if(!m_model){
-            m_model = new cAtmosphereModel();
-        }
-        return m_model;
-    }
-
     void LoadConfig(const char *filename);
     void Run();
     void RunTimeSlice(int time_slice);
 
+    // surface fields of the last written results for a hydrosphere in the same process
+    const AtomUtils::SurfaceTransfer& GetSurfaceTransfer() const{
+        return surface_transfer;
+    }
+
     std::set<float>::const_iterator get_current_time() const{
         if(m_time_list.empty()){
             throw("The time list is empty. It is likely the model has not started yet.");
@@ -88,15 +98,23 @@ public:
 
 private:
     void SetDefaultConfig();
+    void CopyConfig(const cAtmosphereModel &model);
     void reset_arrays();
-    void print_min_max_values();
+    void allocate_fields();
+    void add_diagnostics( Diagnostics_Atm &diagnostics );
     void write_file( std::string &bathymetry_name, string& filepath, bool is_final_result = false);
+    void snapshot_fields( std::vector<Array*> &fields_3d, std::vector<Array_2D*> &fields_2d );
+    void write_results( const AtomUtils::OutputSnapshot &f, std::string bathymetry_name, std::string output_path,
+                        int Ma, int n, bool is_final_result );
 
-    void run_2D_loop( BC_Atmosphere &boundary, RungeKutta_Atmosphere &result,
+    int run_2D_loop( BC_Atmosphere &boundary, RungeKutta_Atmosphere &result,
                       BC_Bathymetry_Atmosphere &LandArea, RHS_Atmosphere &prepare_2D,
                       Pressure_Atm &startPressure, BC_Thermo &circulation);
 
-    void run_3D_loop( BC_Atmosphere &boundary, RungeKutta_Atmosphere &result,
+    bool depends_on_previous_slice( int Ma ) const;
+    void run_slice_farm( const std::vector<int> &slices );
+
+    int run_3D_loop( BC_Atmosphere &boundary, RungeKutta_Atmosphere &result,
                       BC_Bathymetry_Atmosphere &LandArea, RHS_Atmosphere &prepare,
                       Pressure_Atm &startPressure, Results_MSL_Atm &calculate_MSL, 
                       BC_Thermo &circulation);
@@ -111,10 +129,21 @@ private:
 
     void restrain_temperature();
 
-    static cAtmosphereModel* m_model;
+    void save_warm_start( int Ma );
+    bool apply_warm_start( int Ma );
 
-    PythonStream ps;
-    std::streambuf *backup;
+    AtomUtils::Checkpoint restart_checkpoint();
+    std::string restart_file( int Ma ) const;
+    void write_restart( int Ma, int pressure_iter, int velocity_iter, const AtomUtils::ConvergenceControl &convergence );
+
+    // the allocated fields with their bytes, and the bytes of a time slice with the snapshots of the output writer
+    std::vector<std::pair<std::string, std::size_t> > memory_fields();
+    std::size_t slice_bytes();
+    void report_memory( const std::string &title );
+
+    // opens log_file if it changed and applies log_flush_interval to the stream buffers
+    std::ostream& log_stream();
+    AtomUtils::LogLevel log_level() const;
 
     //time slices list
     std::set<float> m_time_list;
@@ -227,7 +256,39 @@ private:
     Array S_s; // snow mass rate due to category two ice scheme
     Array S_c_c; // cloud water mass rate due to condensation and evaporation in the saturation adjustment technique
 
-    Vector3D<> residuum_2d, residuum_3d; 
+    Vector3D<> residuum_2d;
+    std::unique_ptr<Vector3D<> > residuum_3d; // only allocated for the residuum files of the debug mode
+
+    // fields only written to the result files, allocated when the output asks for them
+    AtomUtils::FieldRegistry diagnostic_fields;
+
+    // converged u, v, w, t, p_dyn, c, cloud, ice, co2 and the bathymetry of the previous time slice for the warm start
+    std::vector<Array> warm_arrays_3d;
+    Array warm_h;
+    int warm_Ma; // time slice of the stored state, -1 if none
+    int cold_start_Ma; // last time slice started from the analytic profiles, -1 if none
+    int cold_start_iterations; // 3D iterations of the time slice cold_start_Ma
+
+    // iteration counters, emin and convergence state read from the restart file of the running time slice, empty if none
+    std::map<std::string, double> restart_state;
+
+    AtomUtils::SurfaceTransfer surface_transfer;
+
+    // time spent in the phases of the 3D iterations of the running time slice
+    AtomUtils::PhaseProfile phase_profile;
+
+    // output and log file of this model instance, bound to the running thread by the public entry points
+    // through buffers which pass the text on every log_flush_interval seconds and at the end of each call
+    PythonStream ps;
+    AtomUtils::BufferedStreambuf output_buffer;
+    std::ostream output_stream;
+    std::ofstream log_file_stream;
+    AtomUtils::BufferedStreambuf log_buffer;
+    std::ostream log_output;
+    std::string log_file_name;
+
+    // writes the result files in the background, declared last to finish before the fields are destroyed
+    AtomUtils::OutputWriter output_writer;
 
 };
 
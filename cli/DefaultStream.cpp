@@ -6,8 +6,6 @@ bool PythonStream::is_enable(){
     return false;
 }
 
-void PythonStream::OverrideCout() { }
-
 int PythonStream::sync() {
     return 0;
 }
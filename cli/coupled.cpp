@@ -0,0 +1,54 @@
+#include <iostream>
+#include <stdlib.h>
+
+#include "cAtmosphereModel.h"
+#include "cHydrosphereModel.h"
+#include "SlicePipeline.h"
+
+int main(int argc, char **argv) 
+{
+    cAtmosphereModel atm;
+    cHydrosphereModel hyd;
+
+    if ( argc != 3 )
+    {
+        std::cout << std::endl << "ATOM Coupled Atmosphere and Hydrosphere Model" << std::endl;
+        std::cout << std::endl;
+        std::cout << "Invalid Command Line Parameter" << std::endl;
+        std::cout << std::endl;
+        std::cout << "Usage:" << std::endl;
+        std::cout << "\t" << "./coupled <<atmosphere XML configuration file path>> <<hydrosphere XML configuration file path>>" << std::endl;
+        std::cout << "\t" << "For example: ./coupled config_atm.xml config_hyd.xml" << std::endl;
+        std::cout << "\t" << "The time slices come from time_start, time_end and time_step of the atmosphere configuration," << std::endl;
+        std::cout << "\t" << "those of the hydrosphere configuration are ignored." << std::endl;
+        std::cout << std::endl;
+        exit ( 1 );
+    }
+    try{
+        atm.LoadConfig(argv[1]);
+        hyd.LoadConfig(argv[2]);
+
+        // the time slices of the atmosphere configuration are computed by both models
+        std::vector<int> slices;
+        for(int i = atm.time_start; i <= atm.time_end; i+=atm.time_step)
+        {
+            slices.push_back(i);
+        }
+
+        AtomUtils::SlicePipeline pipeline ( atm.pipeline_depth );
+        pipeline.run ( slices,
+            [ & ] ( int Ma ){
+                atm.RunTimeSlice ( Ma );
+                return atm.GetSurfaceTransfer();
+            },
+            [ & ] ( int Ma, const AtomUtils::SurfaceTransfer &transfer ){
+                hyd.SetSurfaceTransfer ( transfer );
+                hyd.RunTimeSlice ( Ma );
+            } );
+
+        std::cout << std::endl << pipeline.report() << std::endl << std::endl;
+    }catch(const std::exception &exc){
+        std::cerr << exc.what() << std::endl;
+        return 1;
+    }
+}
@@ -0,0 +1,26 @@
+#include <iostream>
+#include <stdlib.h>
+
+#include "GridArchive.h"
+
+int main(int argc, char **argv) 
+{
+    if ( argc < 2 )
+    {
+        std::cout << std::endl << "ATOM Paleotopography/Bathymetry Grid Archive" << std::endl;
+        std::cout << std::endl;
+        std::cout << "Invalid Command Line Parameter" << std::endl;
+        std::cout << std::endl;
+        std::cout << "Usage:" << std::endl;
+        std::cout << "\t" << "./grids <<directory of .xyz files>> [<<further directories>>]" << std::endl;
+        std::cout << "\t" << "For example: ./grids ../data/Paleotopography_bathymetry/Golonka_rev210" << std::endl;
+        std::cout << "\t" << "The archive stores the z values as float32, the models read the .xyz files with the same rounding." << std::endl;
+        std::cout << std::endl;
+        exit ( 1 );
+    }
+    for ( int a = 1; a < argc; a++ )
+    {
+        int n = AtomUtils::GridArchive::build ( argv[a] );
+        std::cout << argv[a] << "/" << AtomUtils::GridArchive::file_name << ": " << n << " grids" << std::endl;
+    }
+}
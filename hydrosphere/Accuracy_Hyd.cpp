@@ -14,6 +14,7 @@
 #include <cmath>
 #include <iomanip>
 #include <cstring>
+#include <algorithm>
 #include <Utils.h>
 
 #include "Accuracy_Hyd.h"
@@ -184,27 +185,27 @@ double Accuracy_Hyd::steadyQuery_3D ( Array &u, Array &un, Array &v, Array &vn,
     }
 
 // statements on the convergence und iterational process
-    cout.precision ( 6 );
-    cout.setf ( ios::fixed );
-
-    cout << endl << endl;
-    cout << "      >>>>>>>>>>>>>>>>>>>>>>>>>>>>>    3D    <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<" << endl;
-    cout << "      3D OGCM iterational process" << endl;
-    cout << "      max total iteration number nm = " << nm << endl;
-    cout << "      outer pressure loop:  max iteration number pressure_iter_max = "
+    get_output().precision ( 6 );
+    get_output().setf ( ios::fixed );
+
+    get_output() << endl << endl;
+    get_output() << "      >>>>>>>>>>>>>>>>>>>>>>>>>>>>>    3D    <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<" << endl;
+    get_output() << "      3D OGCM iterational process" << endl;
+    get_output() << "      max total iteration number nm = " << nm << endl;
+    get_output() << "      outer pressure loop:  max iteration number pressure_iter_max = "
         << pressure_iter_max << endl;
-    cout << "      inner velocity loop:  max iteration number velocity_iter_max = "
+    get_output() << "      inner velocity loop:  max iteration number velocity_iter_max = "
         << velocity_iter_max << endl << endl;
 
-    cout << "      n = " << n << "     " << "velocity_iter = " << velocity_iter
+    get_output() << "      n = " << n << "     " << "velocity_iter = " << velocity_iter
         << "     " << "pressure_iter = " << pressure_iter<< "     " << "Ma = " << Ma << endl;
-    cout << endl;
+    get_output() << endl;
 
 
 // printout of maximum and minimum absolute and relative errors of the computed values at their locations while iterating
     heading = " printout of maximum and minimum absolute and relative errors of the computed values at their locations: level, latitude, longitude";
 
-    cout << endl << endl << heading << endl << endl;
+    get_output() << endl << endl << heading << endl << endl;
 
     level = "m";
     deg_north = "°N";
@@ -267,7 +268,7 @@ double Accuracy_Hyd::steadyQuery_3D ( Array &u, Array &un, Array &v, Array &vn,
                         k_loc = k_c;
                         break;
 
-        default :     cout << choice << "error in iterationPrintout_3D member function in class Accuracy" << endl;
+        default :     get_output() << choice << "error in iterationPrintout_3D member function in class Accuracy" << endl;
     }
     i_loc_level = - i_loc * int ( L_hyd ) / ( im - 1 );
 
@@ -291,7 +292,7 @@ double Accuracy_Hyd::steadyQuery_3D ( Array &u, Array &un, Array &v, Array &vn,
         deg_lon = deg_east;
     }
 
-    cout << setiosflags ( ios::left ) << setw ( 36 ) << setfill ( '.' ) << name_Value
+    get_output() << setiosflags ( ios::left ) << setw ( 36 ) << setfill ( '.' ) << name_Value
         << " = " << resetiosflags ( ios::left ) << setw ( 12 ) << fixed << setfill ( ' ' )
         << Value << setw ( 5 ) << j_loc_deg << setw ( 3 ) << deg_lat << setw ( 4 )
         << k_loc_deg << setw ( 3 ) << deg_lon << setw ( 6 ) << i_loc_level
@@ -300,9 +301,12 @@ double Accuracy_Hyd::steadyQuery_3D ( Array &u, Array &un, Array &v, Array &vn,
     choice++;
     if ( choice <= 7 ) goto preparation;
 
-    cout << endl << endl;
+    get_output() << endl << endl;
 
-    return 0;
+    changes = { { "p_dyn", min_p, i_p, j_p, k_p }, { "u", min_u, i_u, j_u, k_u }, { "v", min_v, i_v, j_v, k_v }, 
+                { "w", min_w, i_w, j_w, k_w }, { "t", min_t, i_t, j_t, k_t }, { "c", min_c, i_c, j_c, k_c } };
+
+    return std::max ( { min_u, min_v, min_w, min_t, min_c, min_p } );
 }
 
 
@@ -377,28 +381,28 @@ double Accuracy_Hyd::steadyQuery_2D ( Array &h, Array &v, Array &vn, Array &w,
     }
 
 // statements on the convergence und iterational process
-    cout.precision ( 6 );
-    cout.setf ( ios::fixed );
-
-    cout << endl << endl;
-    cout << "      >>>>>>>>>>>>>>>>>>>>>>>>>>>>>    2D    <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<" << endl;
-    cout << "      2D OGCM iterational process" << endl;
-    cout << "      max total iteration number nm = " << nm << endl;
-    cout << "      outer pressure loop:  max iteration number pressure_iter_max_2D = "
+    get_output().precision ( 6 );
+    get_output().setf ( ios::fixed );
+
+    get_output() << endl << endl;
+    get_output() << "      >>>>>>>>>>>>>>>>>>>>>>>>>>>>>    2D    <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<" << endl;
+    get_output() << "      2D OGCM iterational process" << endl;
+    get_output() << "      max total iteration number nm = " << nm << endl;
+    get_output() << "      outer pressure loop:  max iteration number pressure_iter_max_2D = "
         << pressure_iter_max_2D << endl;
-    cout << "      inner velocity loop:  max iteration number velocity_iter_max_2D = "
+    get_output() << "      inner velocity loop:  max iteration number velocity_iter_max_2D = "
         << velocity_iter_max_2D << endl << endl;
 
-    cout << "      n = " << n << "     " << "velocity_iter_2D = " << velocity_iter_2D
+    get_output() << "      n = " << n << "     " << "velocity_iter_2D = " << velocity_iter_2D
         << "     " << "pressure_iter_2D = " << pressure_iter_2D << "     " << "Ma = "
         << Ma << endl;
-    cout << endl;
+    get_output() << endl;
 
 
 // printout of maximum and minimum absolute and relative errors of the computed values at their locations while iterating
     heading = " 2D iterational process for the surface boundary conditions\n printout of maximum and minimum absolute and relative errors of the computed values at their locations: level, latitude, longitude";
 
-    cout << endl << endl << heading << endl << endl;
+    get_output() << endl << endl << heading << endl << endl;
 
     deg_north = "°N";
     deg_south = "°S";
@@ -434,7 +438,7 @@ double Accuracy_Hyd::steadyQuery_2D ( Array &h, Array &v, Array &vn, Array &w,
                         k_loc = k_w;
                         break;
 
-        default :     cout << choice << "error in iterationPrintout_3D member function in class Accuracy" << endl;
+        default :     get_output() << choice << "error in iterationPrintout_3D member function in class Accuracy" << endl;
     }
     if ( j_loc <= 90 )
     {
@@ -461,7 +465,7 @@ double Accuracy_Hyd::steadyQuery_2D ( Array &h, Array &v, Array &vn, Array &w,
         deg_lon = deg_west;
     }
 
-    cout << setiosflags ( ios::left ) << setw ( 36 ) << setfill ( '.' ) << name_Value << " = "
+    get_output() << setiosflags ( ios::left ) << setw ( 36 ) << setfill ( '.' ) << name_Value << " = "
         << resetiosflags ( ios::left ) << setw ( 12 ) << fixed << setfill ( ' ' ) << Value
          << setw ( 5 ) << j_loc_deg << setw ( 3 ) << deg_lat << setw ( 4 )
          << k_loc_deg << setw ( 3 ) << deg_lon << endl;
@@ -469,9 +473,9 @@ double Accuracy_Hyd::steadyQuery_2D ( Array &h, Array &v, Array &vn, Array &w,
     choice++;
     if ( choice <= 4 ) goto preparation;
 
-    cout << endl << endl;
+    get_output() << endl << endl;
 
-    return 0;
+    return std::max ( { min_v, min_w, min_p } );
 }
 
 
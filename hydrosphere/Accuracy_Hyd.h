@@ -9,9 +9,11 @@
 */
 
 #include <iostream>
+#include <vector>
 
 #include "Array.h"
 #include "Array_1D.h"
+#include "Telemetry.h"
 
 #ifndef _ACCURACY_
 #define _ACCURACY_
@@ -33,6 +35,8 @@ class Accuracy_Hyd{
         double Value, L_hyd;
         double min, min_u, min_v, min_w, min_t, min_c, min_p;
 
+        std::vector<AtomUtils::FieldChange> changes;
+
         string name_Value;
         string level, deg_north, deg_south, deg_west, deg_east, deg_lat, deg_lon, heading;
 
@@ -47,11 +51,14 @@ class Accuracy_Hyd{
         double residuumQuery_2D ( Array_1D &, Array_1D &, Array &, Array & );
         double residuumQuery_3D ( Array_1D &, Array_1D &, Array &, Array &, Array & );
 
+        // largest change of the flow properties between two iterations
         double steadyQuery_2D ( Array &, Array &, Array &, Array &, Array &, Array &, Array & );
         double steadyQuery_3D ( Array &, Array &, Array &, Array &, Array &, Array &, Array &,
             Array &, Array &, Array &, Array &, Array & );
 
         double out_min () const;
+        // largest change of each field and its location found by steadyQuery_3D
+        const std::vector<AtomUtils::FieldChange>& out_changes () const{ return changes; }
         int out_i_res () const;
         int out_j_res () const;
         int out_k_res () const;
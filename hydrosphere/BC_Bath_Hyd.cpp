@@ -15,6 +15,7 @@
 #include <algorithm> 
 
 #include "BC_Bath_Hyd.h"
+#include "DatasetCache.h"
 #include "Utils.h"
 
 using namespace std;
@@ -33,19 +34,13 @@ void BC_Bathymetry_Hydrosphere::BC_SeaGround(const string &bathymetry_file,
     // default adjustment, h must be 0 everywhere
     h.initArray(im, jm, km, 0.);
 
-    ifstream ifile(bathymetry_file);
+    // reading data through the dataset cache from the grid archive of the data set or from the bathymetry file
+    DatasetCache::Handle depths = DatasetCache::grid ( bathymetry_file, jm, km, "bathymetry" );
 
-    if (!ifile.is_open()){
-        cerr << "ERROR: could not open bathymetry file " << bathymetry_file << "\n";
-        abort();
-    }
-
-    double lon, lat, depth;
-    int j, k;
-    for (j = 0; j < jm && !ifile.eof(); j++) {
-        for (k = 0; k < km && !ifile.eof(); k++) {
-            depth = 999; // in case the height is NaN
-            ifile >> lon >> lat >> depth;
+    for (int j = 0; j < jm; j++) {
+        for (int k = 0; k < km; k++) {
+            double depth = ( *depths )[ j * km + k ];
+            if ( std::isnan ( depth ) )  depth = 999; // in case the height is NaN
 
             if ( depth > 0. )
             {
@@ -57,23 +52,9 @@ void BC_Bathymetry_Hydrosphere::BC_SeaGround(const string &bathymetry_file,
             for ( int i = 0; i <= i_boden; i++ ){
                 h.x[ i ][ j ][ k ] = 1.;
             }
-
-            if(ifile.fail())
-            {
-                ifile.clear();
-                std::string tmp;
-                std::getline(ifile, tmp);
-                logger() << "bad data in topography at: " << lon << " " << lat << " " << tmp << std::endl;
-            }
-            //logger() << lon << " " << lat << " " << h.x[ 0 ][ j ][ k ] << std::endl;            
         }
     }
 
-    if(j != jm || k != km ){
-        std::cerr << "wrong topography file size! aborting..."<<std::endl;
-        abort();
-    }
-
     // rewrite bathymetric data from -180° - 0° - +180° to 0°- 360°
     for ( int j = 0; j < jm; j++ )
     {
@@ -18,6 +18,7 @@
 
 #include "BC_Thermohalin.h"
 #include "Array.h"
+#include "DatasetCache.h"
 
 using namespace std;
 using namespace AtomUtils;
@@ -389,13 +390,13 @@ void BC_Thermohalin::BC_Temperature_Salinity ( Array &h, Array &t, Array &c, Arr
 
     t_cretaceous = 0.;
 
-    cout.precision ( 3 );
+    get_output().precision ( 3 );
 
     time_slice_comment = "      time slice of Cretaceous-AGCM:";
     time_slice_number = " Ma = ";
     time_slice_unit = " million years";
 
-    cout << endl << setiosflags ( ios::left ) << setw ( 50 ) << setfill ( '.' )
+    get_output() << endl << setiosflags ( ios::left ) << setw ( 50 ) << setfill ( '.' )
         << time_slice_comment << setw ( 6 ) << std::fixed << setfill ( ' ' )
         << time_slice_number << setw ( 3 ) << Ma << setw ( 12 ) << time_slice_unit 
         << endl << endl;
@@ -408,7 +409,7 @@ void BC_Thermohalin::BC_Temperature_Salinity ( Array &h, Array &t, Array &c, Arr
     temperature_average_cret = " t cretaceous";
     temperature_unit =  "°C ";
 
-    cout << endl << setiosflags ( ios::left ) << setw ( 50 ) << setfill ( '.' ) << temperature_comment << 
+    get_output() << endl << setiosflags ( ios::left ) << setw ( 50 ) << setfill ( '.' ) << temperature_comment << 
         resetiosflags ( ios::left ) << setw ( 12 ) << temperature_gain << " = " << setw ( 7 ) << setfill ( ' ' ) << 
         t_cretaceous << setw ( 5 ) << temperature_unit << endl << setw ( 50 ) << setfill ( '.' )  << 
         setiosflags ( ios::left ) << temperature_modern << resetiosflags ( ios::left ) << setw ( 13 ) << 
@@ -431,7 +432,7 @@ void BC_Thermohalin::BC_Temperature_Salinity ( Array &h, Array &t, Array &c, Arr
     salinity_average_cret = " c cretaceous";
     salinity_unit =  "psu ";
 
-    cout << endl << setiosflags ( ios::left ) << setw ( 50 ) << setfill ( '.' ) << salinity_comment << 
+    get_output() << endl << setiosflags ( ios::left ) << setw ( 50 ) << setfill ( '.' ) << salinity_comment << 
         resetiosflags ( ios::left ) << setw ( 12 ) << salinity_gain << " = " << setw ( 7 ) << setfill ( ' ' ) << 
         c_cretaceous << setw ( 5 ) << salinity_unit << endl << setw ( 50 ) << setfill ( '.' )  << setiosflags ( ios::left ) 
         << salinity_modern << resetiosflags ( ios::left ) << setw ( 13 ) << salinity_average  << " = "  << setw ( 7 )  << 
@@ -439,7 +440,7 @@ void BC_Thermohalin::BC_Temperature_Salinity ( Array &h, Array &t, Array &c, Arr
         setiosflags ( ios::left ) << salinity_cretaceous << resetiosflags ( ios::left ) << setw ( 13 ) << 
         salinity_average_cret  << " = "  << setw ( 7 )  << setfill ( ' ' ) << c_average + c_cretaceous << setw ( 5 ) << 
         salinity_unit << endl;
-    cout << endl;
+    get_output() << endl;
 
     for ( int k = 0; k < km; k++ )
     {
@@ -591,36 +592,20 @@ void BC_Thermohalin::BC_Surface_Temperature_NASA
                                     ( const string &Name_SurfaceTemperature_File, Array &t ){
     // initial conditions for the temperature and salinity at the sea surface
 
-    cout.precision ( 3 );
-    cout.setf ( ios::fixed );
+    get_output().precision ( 3 );
+    get_output().setf ( ios::fixed );
 
-    ifstream Name_SurfaceTemperature_File_Read;
-    Name_SurfaceTemperature_File_Read.open(Name_SurfaceTemperature_File);
+    // the lines run along the latitudes, bad lines are taken as 0°C
+    DatasetCache::Handle temperature = DatasetCache::grid ( Name_SurfaceTemperature_File, km, jm, "SurfaceTemperature_File" );
 
-    if (!Name_SurfaceTemperature_File_Read.is_open()) {
-        cerr << "ERROR: could not open SurfaceTemperature_File file at " << Name_SurfaceTemperature_File << "\n";
-        abort();
-    }
-
-    j = 0;
-    k = 0;
-
-    while ( ( k < km ) && ( !Name_SurfaceTemperature_File_Read.eof() ) ){
-        while ( j < jm ){
-            Name_SurfaceTemperature_File_Read >> dummy_1;
-            Name_SurfaceTemperature_File_Read >> dummy_2;
-            Name_SurfaceTemperature_File_Read >> dummy_3;
-
-            t.x[ im-1 ][ j ][ k ] = ( dummy_3 + 273.15 ) / 273.15;
-
-            j++;
+    for ( int k = 0; k < km; k++ ){
+        for ( int j = 0; j < jm; j++ ){
+            double value = ( *temperature )[ k * jm + j ];
+            if ( std::isnan ( value ) )  value = 0.;
+            t.x[ im-1 ][ j ][ k ] = ( value + 273.15 ) / 273.15;
         }
-        j = 0;
-        k++;
     }
 
-    Name_SurfaceTemperature_File_Read.close();
-
     for ( int j = 0; j < jm; j++ ){
         for ( int k = 1; k < km-1; k++ ){
             if ( k == 180 ) t.x[ im-1 ][ j ][ k ] = ( t.x[ im-1 ][ j ][ k + 1 ] + t.x[ im-1 ][ j ][ k - 1 ] ) * .5;
@@ -637,36 +622,21 @@ void BC_Thermohalin::BC_Surface_Salinity_NASA ( const string &Name_SurfaceSalini
     // initial conditions for the salinity at the sea surface
     streampos anfangpos_1, endpos_1, anfangpos_2, endpos_2, anfangpos_3, endpos_3, anfangpos_4, endpos_4;
 
-    cout.precision ( 3 );
-    cout.setf ( ios::fixed );
-
-    ifstream Name_SurfaceSalinity_File_Read;
-    Name_SurfaceSalinity_File_Read.open(Name_SurfaceSalinity_File);
-
-    if (!Name_SurfaceSalinity_File_Read.is_open()){
-        cerr << "ERROR: could not open SurfaceSalinity_File file at " << Name_SurfaceSalinity_File << "\n";
-        abort();
-    }
+    get_output().precision ( 3 );
+    get_output().setf ( ios::fixed );
 
-    j = 0;
-    k = 0;
+    // the lines run along the latitudes, bad lines are taken as missing values like the negative ones
+    DatasetCache::Handle salinity = DatasetCache::grid ( Name_SurfaceSalinity_File, km, jm, "SurfaceSalinity_File" );
 
-    while ( ( k < km ) && ( !Name_SurfaceSalinity_File_Read.eof() ) ){
-        while ( j < jm ){
-            Name_SurfaceSalinity_File_Read >> dummy_1;
-            Name_SurfaceSalinity_File_Read >> dummy_2;
-            Name_SurfaceSalinity_File_Read >> dummy_3;
+    for ( int k = 0; k < km; k++ ){
+        for ( int j = 0; j < jm; j++ ){
+            dummy_3 = ( *salinity )[ k * jm + j ];
 
-            if ( dummy_3 < 0. ) dummy_3 = ca;
+            if ( std::isnan ( dummy_3 ) || ( dummy_3 < 0. ) ) dummy_3 = ca;
 
             else        c.x[ im-1 ][ j ][ k ] = dummy_3 / c_0;
-            j++;
         }
-        j = 0;
-        k++;
     }
-
-    Name_SurfaceSalinity_File_Read.close();
 }
 
 
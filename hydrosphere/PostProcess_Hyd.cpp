@@ -15,6 +15,7 @@
 #include <sstream>
 #include <iomanip>
 #include <Utils.h>
+#include <VtkWriter.h>
 
 #include "PostProcess_Hyd.h"
 
@@ -22,88 +23,87 @@ using namespace std;
 using namespace AtomUtils;
 
 PostProcess_Hydrosphere::PostProcess_Hydrosphere(int im, int jm, int km,
-                                            const string &output_path){
+                                            const string &output_path, int vtk_format, bool vtk_float64){
     this->im = im;
     this->jm = jm;
     this->km = km;
     this->output_path = output_path;
+    this->vtk_format = vtk_format;
+    this->vtk_float64 = vtk_float64;
 }
 
 PostProcess_Hydrosphere::~PostProcess_Hydrosphere() {}
 
 
 void PostProcess_Hydrosphere::dump_array(const string &name, Array &a,
-                                                    double multiplier, ofstream &f){
-    f <<  "    <DataArray type=\"Float32\" Name=\"" << name << "\" format=\"ascii\">\n";
+                                                    double multiplier, VtsWriter &vts){
+    vts.begin_array ( name );
 
     for (int k = 0; k < km; k++){
         for (int j = 0; j < jm; j++){
             for (int i = 0; i < im; i++){
-                f << (a.x[i][j][k] * multiplier) << endl;
+                vts.value ( a.x[i][j][k] * multiplier );
             }
-            f << "\n";
         }
-        f << "\n";
     }
-    f << "\n";
-    f << "    </DataArray>\n";
+    vts.end_array ( );
 }
 
 
 
 void PostProcess_Hydrosphere::dump_radial(const string &desc, Array &a,
-                                                    double multiplier, int i, ofstream &f){
-    f << "SCALARS " << desc << " float " << 1 << endl;
-    f << "LOOKUP_TABLE default" << endl;
+                                                    double multiplier, int i, VtkLegacyWriter &vtk){
+    vtk.scalars ( desc );
 
     for (int j = 0; j < jm; j++){
         for (int k = 0; k < km; k++){
-            f << (a.x[i][j][k] * multiplier) << endl;
+            vtk.value ( a.x[i][j][k] * multiplier );
         }
     }
+    vtk.end_values ( );
 }
 
 
 
 void PostProcess_Hydrosphere::dump_radial_2d(const string &desc, Array_2D &a,
-                                                    double multiplier, ofstream &f){
-    f << "SCALARS " << desc << " float " << 1 << endl;
-    f << "LOOKUP_TABLE default" << endl;
+                                                    double multiplier, VtkLegacyWriter &vtk){
+    vtk.scalars ( desc );
 
     for (int j = 0; j < jm; j++){
         for (int k = 0; k < km; k++){
-            f << (a.y[j][k] * multiplier) << endl;
+            vtk.value ( a.y[j][k] * multiplier );
         }
     }
+    vtk.end_values ( );
 }
 
 
 
 void PostProcess_Hydrosphere::dump_zonal(const string &desc, Array &a,
-                                                    double multiplier, int k, ofstream &f){
-    f <<  "SCALARS " << desc << " float " << 1 << endl;
-    f <<  "LOOKUP_TABLE default" << endl;
+                                                    double multiplier, int k, VtkLegacyWriter &vtk){
+    vtk.scalars ( desc );
 
     for ( int i = 0; i < im; i++ ){
         for ( int j = 0; j < jm; j++ ){
-            f << (a.x[ i ][ j ][ k ] * multiplier) << endl;
+            vtk.value ( a.x[ i ][ j ][ k ] * multiplier );
         }
     }
+    vtk.end_values ( );
 }
 
 
 
 void PostProcess_Hydrosphere::dump_longal(const string &desc, Array &a,
-                                                    double multiplier, int j, ofstream &f)
+                                                    double multiplier, int j, VtkLegacyWriter &vtk)
 {
-    f << "SCALARS " << desc << " float " << 1 << endl;
-    f << "LOOKUP_TABLE default" << endl;
+    vtk.scalars ( desc );
 
     for (int i = 0; i < im; i++){
         for (int k = 0; k < km; k++){
-            f << (a.x[i][j][k] * multiplier) << endl;
+            vtk.value ( a.x[i][j][k] * multiplier );
         }
     }
+    vtk.end_values ( );
 }
 
 
@@ -137,8 +137,10 @@ void PostProcess_Hydrosphere::paraview_vts ( const string &Name_Bathymetry_File,
         abort();
     }
 
+    VtsWriter vts ( Hydrosphere_vts_File, vtk_format, vtk_float64 );
+
     Hydrosphere_vts_File <<  "<?xml version=\"1.0\"?>\n"  << endl;
-    Hydrosphere_vts_File <<  "<VTKFile type=\"StructuredGrid\" version=\"0.1\" byte_order=\"LittleEndian\">\n"  << endl;
+    Hydrosphere_vts_File <<  "<VTKFile type=\"StructuredGrid\" version=\"0.1\"" << vts.file_attributes ( ) << ">\n"  << endl;
     Hydrosphere_vts_File <<  " <StructuredGrid WholeExtent=\"" << 1 << " "<< im << " "<< 1 << " " << jm << " "<< 1 << " " << km << "\">\n"  << endl;
     Hydrosphere_vts_File <<  "  <Piece Extent=\"" << 1 << " "<< im << " "<< 1 << " " << jm << " "<< 1 << " " << km << "\">\n"  << endl;
 
@@ -146,7 +148,7 @@ void PostProcess_Hydrosphere::paraview_vts ( const string &Name_Bathymetry_File,
     Hydrosphere_vts_File <<  "   <PointData Vectors=\"Velocity\" Scalars=\"Topography Temperature Pressure Salinity\">\n"  << endl;
 
 // writing u, v und w velocity components in cartesian coordinates
-    Hydrosphere_vts_File <<  "    <DataArray type=\"Float32\" NumberOfComponents=\"3\" Name=\"Velocity\" format=\"ascii\">\n"  << endl;
+    vts.begin_array ( "Velocity", 3 );
 
 
     for ( int k = 0; k < km; k++ ){
@@ -163,79 +165,19 @@ void PostProcess_Hydrosphere::paraview_vts ( const string &Name_Bathymetry_File,
                     v.x[ i ][ j ][ k ] + cosphi * w.x[ i ][ j ][ k ];
                 fwp.x[ i ][ j ][ k ] = costhe * u.x[ i ][ j ][ k ] - sinthe * v.x[ i ][ j ][ k ];
 
-                Hydrosphere_vts_File << fup.x[ i ][ j ][ k ] << " " << fvp.x[ i ][ j ][ k ]
-                    << " " << fwp.x[ i ][ j ][ k ]  << endl;
-            }
-            Hydrosphere_vts_File <<  "\n"  << endl;
-        }
-        Hydrosphere_vts_File <<  "\n"  << endl;
-    }
-    Hydrosphere_vts_File <<  "\n"  << endl;
-    Hydrosphere_vts_File <<  "    </DataArray>\n" << endl;
-
-
-// writing of sea ground
-    Hydrosphere_vts_File <<  "    <DataArray type=\"Float32\" Name=\"Topography\" format=\"ascii\">\n"  << endl;
-
-    for ( int k = 0; k < km; k++ ){
-        for ( int j = 0; j < jm; j++ ){
-            for ( int i = 0; i < im; i++ ){
-                Hydrosphere_vts_File << h.x[ i ][ j ][ k ]  << endl;
-            }
-            Hydrosphere_vts_File <<  "\n"  << endl;
-        }
-        Hydrosphere_vts_File <<  "\n"  << endl;
-    }
-    Hydrosphere_vts_File <<  "\n"  << endl;
-    Hydrosphere_vts_File <<  "    </DataArray>\n" << endl;
-
-// writing of temperature
-    Hydrosphere_vts_File <<  "    <DataArray type=\"Float32\" Name=\"Temperature\" format=\"ascii\">\n"  << endl;
-
-    for ( int k = 0; k < km; k++ ){
-        for ( int j = 0; j < jm; j++ ){
-            for ( int i = 0; i < im; i++ ){
-                Hydrosphere_vts_File << t.x[ i ][ j ][ k ]  << endl;
+                vts.value ( fup.x[ i ][ j ][ k ], fvp.x[ i ][ j ][ k ], fwp.x[ i ][ j ][ k ] );
             }
-            Hydrosphere_vts_File <<  "\n"  << endl;
         }
-        Hydrosphere_vts_File <<  "\n"  << endl;
     }
-    Hydrosphere_vts_File <<  "\n"  << endl;
-    Hydrosphere_vts_File <<  "    </DataArray>\n" << endl;
-
-// writing temperature
-    Hydrosphere_vts_File <<  "    <DataArray type=\"Float32\" Name=\"Pressure\" format=\"ascii\">\n"  << endl;
+    vts.end_array ( );
 
-    for ( int k = 0; k < km; k++ ){
-        for ( int j = 0; j < jm; j++ ){
-            for ( int i = 0; i < im; i++ ){
-                Hydrosphere_vts_File << p.x[ i ][ j ][ k ]  << endl;
-            }
-            Hydrosphere_vts_File <<  "\n"  << endl;
-        }
-        Hydrosphere_vts_File <<  "\n"  << endl;
-    }
-    Hydrosphere_vts_File <<  "\n"  << endl;
-    Hydrosphere_vts_File <<  "    </DataArray>\n" << endl;
-
-// writing scalar function c
-    Hydrosphere_vts_File <<  "    <DataArray type=\"Float32\" Name=\"Salinity\" format=\"ascii\">\n"  << endl;
-
-    for ( int k = 0; k < km; k++ ){
-        for ( int j = 0; j < jm; j++ ){
-            for ( int i = 0; i < im; i++ ){
-                Hydrosphere_vts_File << c.x[ i ][ j ][ k ]  << endl;
-            }
-            Hydrosphere_vts_File <<  "\n"  << endl;
-        }
-        Hydrosphere_vts_File <<  "\n"  << endl;
-    }
-    Hydrosphere_vts_File <<  "\n"  << endl;
-    Hydrosphere_vts_File <<  "    </DataArray>\n" << endl;
+    dump_array("Topography", h, 1.0, vts);
+    dump_array("Temperature", t, 1.0, vts);
+    dump_array("Pressure", p, 1.0, vts);
+    dump_array("Salinity", c, 1.0, vts);
     Hydrosphere_vts_File <<  "   </PointData>\n" << endl;
     Hydrosphere_vts_File <<  "   <Points>\n"  << endl;
-    Hydrosphere_vts_File <<  "    <DataArray type=\"Float32\" NumberOfComponents=\"3\" format=\"ascii\">\n"  << endl;
+    vts.begin_array ( "", 3 );
 
 // transformation from spherical to cartesian coordinates
     for ( int k = 0; k < km; k++ ){
@@ -245,18 +187,17 @@ void PostProcess_Hydrosphere::paraview_vts ( const string &Name_Bathymetry_File,
                 y = rad.z[ i ] * sin( the.z[ j ] ) * sin ( phi.z[ k ] );
                 z = rad.z[ i ] * cos( the.z[ j ] );
 
-                Hydrosphere_vts_File << x << " " << y << " " << z  << endl;
+                vts.value ( x, y, z );
             }
-            Hydrosphere_vts_File <<  "\n"  << endl;
         }
-        Hydrosphere_vts_File <<  "\n"  << endl;
     }
 
-    Hydrosphere_vts_File <<  "    </DataArray>\n"  << endl;
+    vts.end_array ( );
     Hydrosphere_vts_File <<  "   </Points>\n"  << endl;
     Hydrosphere_vts_File <<  "  </Piece>\n"  << endl;
 
     Hydrosphere_vts_File <<  " </StructuredGrid>\n"  << endl;
+    vts.append_data ( );
     Hydrosphere_vts_File <<  "</VTKFile>\n"  << endl;
     Hydrosphere_vts_File.close();
 }
@@ -286,8 +227,10 @@ void PostProcess_Hydrosphere::paraview_panorama_vts ( const string &Name_Bathyme
         abort();
     }
 
+    VtsWriter vts ( Hydrosphere_panorama_vts_File, vtk_format, vtk_float64 );
+
     Hydrosphere_panorama_vts_File <<  "<?xml version=\"1.0\"?>\n"  << endl;
-    Hydrosphere_panorama_vts_File <<  "<VTKFile type=\"StructuredGrid\" version=\"0.1\" byte_order=\"LittleEndian\">\n"  << endl;
+    Hydrosphere_panorama_vts_File <<  "<VTKFile type=\"StructuredGrid\" version=\"0.1\"" << vts.file_attributes ( ) << ">\n"  << endl;
     Hydrosphere_panorama_vts_File <<  " <StructuredGrid WholeExtent=\"" << 1 << " "<< im << " "<< 1 << " " << jm << " "<< 1 << " " << km << "\">\n"  << endl;
     Hydrosphere_panorama_vts_File <<  "  <Piece Extent=\"" << 1 << " "<< im << " "<< 1 << " " << jm << " "<< 1 << " " << km << "\">\n"  << endl;
 
@@ -295,40 +238,37 @@ void PostProcess_Hydrosphere::paraview_panorama_vts ( const string &Name_Bathyme
     Hydrosphere_panorama_vts_File <<  "   <PointData Vectors=\"Velocity\" Scalars=\"Topography Temperature PressureDynamic PressureStatic Salinity\">\n"  << endl;
 
 // writing u, v und w velocity components in cartesian coordinates
-    Hydrosphere_panorama_vts_File <<  "    <DataArray type=\"Float32\" NumberOfComponents=\"3\" Name=\"Velocity\" format=\"ascii\">\n"  << endl;
+    vts.begin_array ( "Velocity", 3 );
 
     for ( int k = 0; k < km; k++ ){
         for ( int j = 0; j < jm; j++ ){
             for ( int i = 0; i < im; i++ ){
 // transformtion from spherical to cartesian coordinates for representation in ParaView
-                Hydrosphere_panorama_vts_File << u.x[ i ][ j ][ k ] << " " << v.x[ i ][ j ][ k ] << " " << w.x[ i ][ j ][ k ]  << endl;
+                vts.value ( u.x[ i ][ j ][ k ], v.x[ i ][ j ][ k ], w.x[ i ][ j ][ k ] );
             }
-            Hydrosphere_panorama_vts_File <<  "\n"  << endl;
         }
-        Hydrosphere_panorama_vts_File <<  "\n"  << endl;
     }
-    Hydrosphere_panorama_vts_File <<  "\n"  << endl;
-    Hydrosphere_panorama_vts_File <<  "    </DataArray>\n" << endl;
-
-    dump_array("Topography", h, 1.0, Hydrosphere_panorama_vts_File);
-    dump_array("u-velocity", u, 1000.0, Hydrosphere_panorama_vts_File);
-    dump_array("v-velocity", v, 1.0, Hydrosphere_panorama_vts_File);
-    dump_array("w-velocity", w, 1.0, Hydrosphere_panorama_vts_File);
-    dump_array("Temperature", t, 1.0, Hydrosphere_panorama_vts_File);
-    dump_array("PressureDynamic", p_dyn, u_0 * u_0 * r_0_water * 1e-3, Hydrosphere_panorama_vts_File);
-    dump_array("PressureStatic", p_stat, 1.0, Hydrosphere_panorama_vts_File);
-    dump_array("Salinity", c, 1.0, Hydrosphere_panorama_vts_File);
-    dump_array("DensityWater", r_water, 1.0, Hydrosphere_panorama_vts_File);
-    dump_array("DensitySaltWater", r_salt_water, 1.0, Hydrosphere_panorama_vts_File);
-    dump_array("Salt_Finger", Salt_Finger, 1.0, Hydrosphere_panorama_vts_File);
-    dump_array("SaltDiffusion", Salt_Diffusion, 1.0, Hydrosphere_panorama_vts_File);
-    dump_array("SaltBalance", Salt_Balance, 1.0, Hydrosphere_panorama_vts_File);
-    dump_array("BuoyancyForce", Buoyancy_Force, 1.0, Hydrosphere_panorama_vts_File);
+    vts.end_array ( );
+
+    dump_array("Topography", h, 1.0, vts);
+    dump_array("u-velocity", u, 1000.0, vts);
+    dump_array("v-velocity", v, 1.0, vts);
+    dump_array("w-velocity", w, 1.0, vts);
+    dump_array("Temperature", t, 1.0, vts);
+    dump_array("PressureDynamic", p_dyn, u_0 * u_0 * r_0_water * 1e-3, vts);
+    dump_array("PressureStatic", p_stat, 1.0, vts);
+    dump_array("Salinity", c, 1.0, vts);
+    dump_array("DensityWater", r_water, 1.0, vts);
+    dump_array("DensitySaltWater", r_salt_water, 1.0, vts);
+    dump_array("Salt_Finger", Salt_Finger, 1.0, vts);
+    dump_array("SaltDiffusion", Salt_Diffusion, 1.0, vts);
+    dump_array("SaltBalance", Salt_Balance, 1.0, vts);
+    dump_array("BuoyancyForce", Buoyancy_Force, 1.0, vts);
 
 
     Hydrosphere_panorama_vts_File <<  "   </PointData>\n" << endl;
     Hydrosphere_panorama_vts_File <<  "   <Points>\n"  << endl;
-    Hydrosphere_panorama_vts_File <<  "    <DataArray type=\"Float32\" NumberOfComponents=\"3\" format=\"ascii\">\n"  << endl;
+    vts.begin_array ( "", 3 );
 
 
 // writing cartesian coordinates
@@ -345,22 +285,21 @@ void PostProcess_Hydrosphere::paraview_panorama_vts ( const string &Name_Bathyme
             for ( int i = 0; i < im; i++ ){
                 if ( k == 0 || j == 0 ) x = 0.;
                 else x = x + dx;
-                Hydrosphere_panorama_vts_File << x << " " << y << " " << z  << endl;
+                vts.value ( x, y, z );
             }
             x = 0;
             y = y + dy;
-            Hydrosphere_panorama_vts_File <<  "\n"  << endl;
         }
         y = 0;
         z = z + dz;
-        Hydrosphere_panorama_vts_File <<  "\n"  << endl;
     }
 
-    Hydrosphere_panorama_vts_File <<  "    </DataArray>\n"  << endl;
+    vts.end_array ( );
     Hydrosphere_panorama_vts_File <<  "   </Points>\n"  << endl;
     Hydrosphere_panorama_vts_File <<  "  </Piece>\n"  << endl;
 
     Hydrosphere_panorama_vts_File <<  " </StructuredGrid>\n"  << endl;
+    vts.append_data ( );
     Hydrosphere_panorama_vts_File <<  "</VTKFile>\n"  << endl;
     Hydrosphere_panorama_vts_File.close();
 }
@@ -393,12 +332,14 @@ void PostProcess_Hydrosphere::paraview_vtk_longal ( const string &Name_Bathymetr
         abort();
     }
 
+    VtkLegacyWriter vtk ( Hydrosphere_vtk_longal_File, vtk_format, vtk_float64 );
+
     Hydrosphere_vtk_longal_File <<  "# vtk DataFile Version 3.0" << endl;
     Hydrosphere_vtk_longal_File <<  "Longitudinal_Data_Hydrosphere_Circulation\n";
-    Hydrosphere_vtk_longal_File <<  "ASCII" << endl;
+    Hydrosphere_vtk_longal_File <<  vtk.file_format ( ) << endl;
     Hydrosphere_vtk_longal_File <<  "DATASET STRUCTURED_GRID" << endl;
     Hydrosphere_vtk_longal_File <<  "DIMENSIONS " << k_max << " "<< i_max << " " << 1 << endl;
-    Hydrosphere_vtk_longal_File <<  "POINTS " << i_max * k_max << " float" << endl;
+    vtk.points ( i_max * k_max );
 
 // transformation from spherical to cartesian coordinates
     x = 0.;
@@ -413,38 +354,40 @@ void PostProcess_Hydrosphere::paraview_vtk_longal ( const string &Name_Bathymetr
             if ( k == 0 ) z = 0.;
             else z = z + dz;
 
-            Hydrosphere_vtk_longal_File << x << " " << y << " "<< z << endl;
+            vtk.value ( x, y, z );
         }
         z = 0.;
         x = x + dx;
     }
+    vtk.end_values ( );
 
     Hydrosphere_vtk_longal_File <<  "POINT_DATA " << i_max * k_max << endl;
 
-    dump_longal("Topography", h, 1., j_longal, Hydrosphere_vtk_longal_File);
-    dump_longal("u-Component", u, 1000., j_longal, Hydrosphere_vtk_longal_File);
-    dump_longal("v-Component", v, 1., j_longal, Hydrosphere_vtk_longal_File);
-    dump_longal("w-Component", w, 1., j_longal, Hydrosphere_vtk_longal_File);
-    dump_longal("Temperature", t, 1., j_longal, Hydrosphere_vtk_longal_File);
-    dump_longal("PressureDynamic", p_dyn, u_0 * u_0 * r_0_water * 1e-3, j_longal, Hydrosphere_vtk_longal_File);
-    dump_longal("PressureStatic", p_stat, 1., j_longal, Hydrosphere_vtk_longal_File);
-    dump_longal("Salinity", c, 1., j_longal, Hydrosphere_vtk_longal_File);
-    dump_longal("DensityWater", r_water, 1., j_longal, Hydrosphere_vtk_longal_File);
-    dump_longal("DensitySaltWater", r_salt_water, 1., j_longal, Hydrosphere_vtk_longal_File);
-    dump_longal("SaltFinger", Salt_Finger, 1., j_longal, Hydrosphere_vtk_longal_File);
-    dump_longal("SaltDiffusion", Salt_Diffusion, 1., j_longal, Hydrosphere_vtk_longal_File);
-    dump_longal("SaltBalance", Salt_Balance, 1., j_longal, Hydrosphere_vtk_longal_File);
-    dump_longal("BuoyancyForce", Buoyancy_Force, 1., j_longal, Hydrosphere_vtk_longal_File);
+    dump_longal("Topography", h, 1., j_longal, vtk);
+    dump_longal("u-Component", u, 1000., j_longal, vtk);
+    dump_longal("v-Component", v, 1., j_longal, vtk);
+    dump_longal("w-Component", w, 1., j_longal, vtk);
+    dump_longal("Temperature", t, 1., j_longal, vtk);
+    dump_longal("PressureDynamic", p_dyn, u_0 * u_0 * r_0_water * 1e-3, j_longal, vtk);
+    dump_longal("PressureStatic", p_stat, 1., j_longal, vtk);
+    dump_longal("Salinity", c, 1., j_longal, vtk);
+    dump_longal("DensityWater", r_water, 1., j_longal, vtk);
+    dump_longal("DensitySaltWater", r_salt_water, 1., j_longal, vtk);
+    dump_longal("SaltFinger", Salt_Finger, 1., j_longal, vtk);
+    dump_longal("SaltDiffusion", Salt_Diffusion, 1., j_longal, vtk);
+    dump_longal("SaltBalance", Salt_Balance, 1., j_longal, vtk);
+    dump_longal("BuoyancyForce", Buoyancy_Force, 1., j_longal, vtk);
 
 
 // writing longitudinal u-w-cell structure
-    Hydrosphere_vtk_longal_File <<  "VECTORS u-w-Cell float" << endl;
+    vtk.vectors ( "u-w-Cell" );
 
     for ( int i = 0; i < im; i++ ){
         for ( int k = 0; k < km; k++ ){
-            Hydrosphere_vtk_longal_File << u.x[ i ][ j_longal ][ k ] << " " << y << " " << w.x[ i ][ j_longal ][ k ] << endl;
+            vtk.value ( u.x[ i ][ j_longal ][ k ], y, w.x[ i ][ j_longal ][ k ] );
         }
     }
+    vtk.end_values ( );
     Hydrosphere_vtk_longal_File.close();
 }
 
@@ -480,12 +423,14 @@ void PostProcess_Hydrosphere::paraview_vtk_radial ( const string &Name_Bathymetr
         abort();
     }
 
+    VtkLegacyWriter vtk ( Hydrosphere_vtk_radial_File, vtk_format, vtk_float64 );
+
     Hydrosphere_vtk_radial_File <<  "# vtk DataFile Version 3.0" << endl;
     Hydrosphere_vtk_radial_File <<  "Radial_Data_Hydrosphere_Circulation\n";
-    Hydrosphere_vtk_radial_File <<  "ASCII" << endl;
+    Hydrosphere_vtk_radial_File <<  vtk.file_format ( ) << endl;
     Hydrosphere_vtk_radial_File <<  "DATASET STRUCTURED_GRID" << endl;
     Hydrosphere_vtk_radial_File <<  "DIMENSIONS " << k_max << " "<< j_max << " " << 1 << endl;
-    Hydrosphere_vtk_radial_File <<  "POINTS " << j_max * k_max << " float" << endl;
+    vtk.points ( j_max * k_max );
 
 // transformation from spherical to cartesian coordinates
     x = 0.;
@@ -500,54 +445,56 @@ void PostProcess_Hydrosphere::paraview_vtk_radial ( const string &Name_Bathymetr
             if ( k == 0 ) y = 0.;
             else y = y + dy;
 
-            Hydrosphere_vtk_radial_File << x << " " << y << " "<< z << endl;
+            vtk.value ( x, y, z );
         }
         y = 0.;
         x = x + dx;
     }
+    vtk.end_values ( );
 
     Hydrosphere_vtk_radial_File <<  "POINT_DATA " << j_max * k_max << endl;
 
 // writing temperature
-    Hydrosphere_vtk_radial_File <<  "SCALARS Temperature float " << 1 << endl;
-    Hydrosphere_vtk_radial_File <<  "LOOKUP_TABLE default"  <<endl;
+    vtk.scalars ( "Temperature" );
     for ( int j = 0; j < jm; j++ ){
         for ( int k = 0; k < km; k++ ){
-            Hydrosphere_vtk_radial_File << t.x[ i_radial ][ j ][ k ] * t_0 - t_0 << endl;
+            vtk.value ( t.x[ i_radial ][ j ][ k ] * t_0 - t_0 );
             aux_v.x[ i_radial ][ j ][ k ] = Evaporation_Dalton.y[ j ][ k ] - Precipitation.y[ j ][ k ];
             if ( is_land( h, 0, j, k ) )                        aux_v.x[ i_radial ][ j ][ k ] = 0.;
         }
     }
-
-    dump_radial("Topography", h, 1., i_radial, Hydrosphere_vtk_radial_File);
-    dump_radial_2d("Bathymetry_m", Bathymetry, 1., Hydrosphere_vtk_radial_File);
-
-    dump_radial("u-Component", u, 1000., i_radial, Hydrosphere_vtk_radial_File);
-    dump_radial("v-Component", v, 1., i_radial, Hydrosphere_vtk_radial_File);
-    dump_radial("w-Component", w, 1., i_radial, Hydrosphere_vtk_radial_File);
-    dump_radial("PressureDynamic", p_dyn, u_0 * u_0 * r_0_water * 1e-3, i_radial, Hydrosphere_vtk_radial_File);
-    dump_radial("PressureStatic", p_stat, 1., i_radial, Hydrosphere_vtk_radial_File);
-    dump_radial("Salinity", c, 1., i_radial, Hydrosphere_vtk_radial_File);
-    dump_radial("DensityWater", r_water, 1., i_radial, Hydrosphere_vtk_radial_File);
-    dump_radial("DensitySaltWater", r_salt_water, 1., i_radial, Hydrosphere_vtk_radial_File);
-    dump_radial("SaltFinger", Salt_Finger, 1., i_radial, Hydrosphere_vtk_radial_File);
-    dump_radial("SaltDiffusion", Salt_Diffusion, 1., i_radial, Hydrosphere_vtk_radial_File);
-    dump_radial("SaltBalance", Salt_Balance, 1., i_radial, Hydrosphere_vtk_radial_File);
-    dump_radial("BuoyancyForce", Buoyancy_Force, 1., i_radial, Hydrosphere_vtk_radial_File);
-    dump_radial_2d("Upwelling", Upwelling, 1., Hydrosphere_vtk_radial_File);
-    dump_radial_2d("Downwelling", Downwelling, 1., Hydrosphere_vtk_radial_File);
-    dump_radial_2d("BottomWater", BottomWater, 1., Hydrosphere_vtk_radial_File);
-    dump_radial_2d("Evaporation_Dalton", Evaporation_Dalton, 1., Hydrosphere_vtk_radial_File);
-    dump_radial_2d("Precipitation", Precipitation, 1., Hydrosphere_vtk_radial_File);
-    dump_radial("Evap-Precip", aux_v, 1., i_radial, Hydrosphere_vtk_radial_File);
-
-    Hydrosphere_vtk_radial_File <<  "VECTORS v-w-Cell float" << endl;
+    vtk.end_values ( );
+
+    dump_radial("Topography", h, 1., i_radial, vtk);
+    dump_radial_2d("Bathymetry_m", Bathymetry, 1., vtk);
+
+    dump_radial("u-Component", u, 1000., i_radial, vtk);
+    dump_radial("v-Component", v, 1., i_radial, vtk);
+    dump_radial("w-Component", w, 1., i_radial, vtk);
+    dump_radial("PressureDynamic", p_dyn, u_0 * u_0 * r_0_water * 1e-3, i_radial, vtk);
+    dump_radial("PressureStatic", p_stat, 1., i_radial, vtk);
+    dump_radial("Salinity", c, 1., i_radial, vtk);
+    dump_radial("DensityWater", r_water, 1., i_radial, vtk);
+    dump_radial("DensitySaltWater", r_salt_water, 1., i_radial, vtk);
+    dump_radial("SaltFinger", Salt_Finger, 1., i_radial, vtk);
+    dump_radial("SaltDiffusion", Salt_Diffusion, 1., i_radial, vtk);
+    dump_radial("SaltBalance", Salt_Balance, 1., i_radial, vtk);
+    dump_radial("BuoyancyForce", Buoyancy_Force, 1., i_radial, vtk);
+    dump_radial_2d("Upwelling", Upwelling, 1., vtk);
+    dump_radial_2d("Downwelling", Downwelling, 1., vtk);
+    dump_radial_2d("BottomWater", BottomWater, 1., vtk);
+    dump_radial_2d("Evaporation_Dalton", Evaporation_Dalton, 1., vtk);
+    dump_radial_2d("Precipitation", Precipitation, 1., vtk);
+    dump_radial("Evap-Precip", aux_v, 1., i_radial, vtk);
+
+    vtk.vectors ( "v-w-Cell" );
 
     for ( int j = 0; j < jm; j++ ){
         for ( int k = 0; k < km; k++ ){
-            Hydrosphere_vtk_radial_File << v.x[ i_radial ][ j ][ k ] << " " << w.x[ i_radial ][ j ][ k ] << " " << z << endl;
+            vtk.value ( v.x[ i_radial ][ j ][ k ], w.x[ i_radial ][ j ][ k ], z );
         }
     }
+    vtk.end_values ( );
     Hydrosphere_vtk_radial_File.close();
 }
 
@@ -580,12 +527,14 @@ void PostProcess_Hydrosphere::paraview_vtk_zonal ( const string &Name_Bathymetry
         abort();
     }
 
+    VtkLegacyWriter vtk ( Hydrosphere_vtk_zonal_File, vtk_format, vtk_float64 );
+
     Hydrosphere_vtk_zonal_File <<  "# vtk DataFile Version 3.0" << endl;
     Hydrosphere_vtk_zonal_File <<  "Zonal_Data_Hydrosphere_Circulation\n";
-    Hydrosphere_vtk_zonal_File <<  "ASCII" << endl;
+    Hydrosphere_vtk_zonal_File <<  vtk.file_format ( ) << endl;
     Hydrosphere_vtk_zonal_File <<  "DATASET STRUCTURED_GRID" << endl;
     Hydrosphere_vtk_zonal_File <<  "DIMENSIONS " << j_max << " "<< i_max << " " << 1 << endl;
-    Hydrosphere_vtk_zonal_File <<  "POINTS " << i_max * j_max << " float" << endl;
+    vtk.points ( i_max * j_max );
 
 // transformation from spherical to cartesian coordinates
     x = 0.;
@@ -600,38 +549,40 @@ void PostProcess_Hydrosphere::paraview_vtk_zonal ( const string &Name_Bathymetry
             if ( j == 0 ) y = 0.;
             else y = y + dy;
 
-            Hydrosphere_vtk_zonal_File << x << " " << y << " "<< z << endl;
+            vtk.value ( x, y, z );
         }
         y = 0.;
         x = x + dx;
     }
+    vtk.end_values ( );
 
     Hydrosphere_vtk_zonal_File <<  "POINT_DATA " << i_max * j_max << endl;
 
-    dump_zonal("Topography", h, 1., k_zonal, Hydrosphere_vtk_zonal_File);
+    dump_zonal("Topography", h, 1., k_zonal, vtk);
 
-    dump_zonal("u-Component", u, 1000., k_zonal, Hydrosphere_vtk_zonal_File);
-    dump_zonal("v-Component", v, 1., k_zonal, Hydrosphere_vtk_zonal_File);
-    dump_zonal("w-Component", w, 1., k_zonal, Hydrosphere_vtk_zonal_File);
-    dump_zonal("Temperature", t, 1., k_zonal, Hydrosphere_vtk_zonal_File);
-    dump_zonal("PressureDynamic", p_dyn, u_0 * u_0 * r_0_water * 1e-3, k_zonal, Hydrosphere_vtk_zonal_File);
-    dump_zonal("PressureStatic", p_stat, 1., k_zonal, Hydrosphere_vtk_zonal_File);
-    dump_zonal("Salinity", c, 1., k_zonal, Hydrosphere_vtk_zonal_File);
-    dump_zonal("DensityWater", r_water, 1., k_zonal, Hydrosphere_vtk_zonal_File);
-    dump_zonal("DensitySaltWater", r_salt_water, 1., k_zonal, Hydrosphere_vtk_zonal_File);
-    dump_zonal("SaltFinger", Salt_Finger, 1., k_zonal, Hydrosphere_vtk_zonal_File);
-    dump_zonal("SaltDiffusion", Salt_Diffusion, 1., k_zonal, Hydrosphere_vtk_zonal_File);
-    dump_zonal("SaltBalance", Salt_Balance, 1., k_zonal, Hydrosphere_vtk_zonal_File);
-    dump_zonal("BuoyancyForce", Buoyancy_Force, 1., k_zonal, Hydrosphere_vtk_zonal_File);
+    dump_zonal("u-Component", u, 1000., k_zonal, vtk);
+    dump_zonal("v-Component", v, 1., k_zonal, vtk);
+    dump_zonal("w-Component", w, 1., k_zonal, vtk);
+    dump_zonal("Temperature", t, 1., k_zonal, vtk);
+    dump_zonal("PressureDynamic", p_dyn, u_0 * u_0 * r_0_water * 1e-3, k_zonal, vtk);
+    dump_zonal("PressureStatic", p_stat, 1., k_zonal, vtk);
+    dump_zonal("Salinity", c, 1., k_zonal, vtk);
+    dump_zonal("DensityWater", r_water, 1., k_zonal, vtk);
+    dump_zonal("DensitySaltWater", r_salt_water, 1., k_zonal, vtk);
+    dump_zonal("SaltFinger", Salt_Finger, 1., k_zonal, vtk);
+    dump_zonal("SaltDiffusion", Salt_Diffusion, 1., k_zonal, vtk);
+    dump_zonal("SaltBalance", Salt_Balance, 1., k_zonal, vtk);
+    dump_zonal("BuoyancyForce", Buoyancy_Force, 1., k_zonal, vtk);
 
 
-    Hydrosphere_vtk_zonal_File <<  "VECTORS u-v-Cell float" << endl;
+    vtk.vectors ( "u-v-Cell" );
 
     for ( int i = 0; i < im; i++ ){
         for ( int j = 0; j < jm; j++ ){
-            Hydrosphere_vtk_zonal_File << u.x[ i ][ j ][ k_zonal ] << " " << v.x[ i ][ j ][ k_zonal ] << " " << z << endl;
+            vtk.value ( u.x[ i ][ j ][ k_zonal ], v.x[ i ][ j ][ k_zonal ], z );
         }
     }
+    vtk.end_values ( );
     Hydrosphere_vtk_zonal_File.close();
 }
 
@@ -649,7 +600,7 @@ void PostProcess_Hydrosphere::Atmosphere_TransferFile_read ( const string &Name_
     v_w_Transfer_File.open(Name_v_w_Transfer_File);
 
     if (!v_w_Transfer_File.is_open()){
-        cout << "ERROR: transfer file name in hydrosphere: " << Name_v_w_Transfer_File << "\n";
+        get_output() << "ERROR: transfer file name in hydrosphere: " << Name_v_w_Transfer_File << "\n";
         cerr << "ERROR: could not open transfer file " << __FILE__ << " at line " << __LINE__ << "\n";
         abort();
     }
@@ -13,6 +13,7 @@
 #include "Array.h"
 #include "Array_2D.h"
 #include "Array_1D.h"
+#include "VtkWriter.h"
 
 #ifndef _POSTPROCESS_HYDROSPHERE_
 #define _POSTPROCESS_HYDROSPHERE_
@@ -28,14 +29,19 @@ class PostProcess_Hydrosphere{
 
         string output_path;
 
-        void dump_radial(const string &desc, Array &a, double multiplier, int i, ofstream &f);
-        void dump_longal(const string &desc, Array &a, double multiplier, int j, ofstream &f);
-        void dump_radial_2d(const string &desc, Array_2D &a, double multiplier, ofstream &f);
-        void dump_zonal(const string &desc, Array &a, double multiplier, int k, ofstream &f);
-        void dump_array(const string &name, Array &a, double multiplier, ofstream &f);
+        int vtk_format;
+        bool vtk_float64;
+
+        void dump_radial(const string &desc, Array &a, double multiplier, int i, AtomUtils::VtkLegacyWriter &vtk);
+        void dump_longal(const string &desc, Array &a, double multiplier, int j, AtomUtils::VtkLegacyWriter &vtk);
+        void dump_radial_2d(const string &desc, Array_2D &a, double multiplier, AtomUtils::VtkLegacyWriter &vtk);
+        void dump_zonal(const string &desc, Array &a, double multiplier, int k, AtomUtils::VtkLegacyWriter &vtk);
+        void dump_array(const string &name, Array &a, double multiplier, AtomUtils::VtsWriter &vts);
 
     public:
-        PostProcess_Hydrosphere (int im, int jm, int km, const string &output_path);
+        // vtk_format and vtk_float64 select ascii or binary paraview files, see AtomUtils::VtkWriter
+        PostProcess_Hydrosphere (int im, int jm, int km, const string &output_path, int vtk_format = 0,
+                                 bool vtk_float64 = false);
         ~PostProcess_Hydrosphere();
 
         void Hydrosphere_SequelFile_write ( const string &, int, int, double &, Array_1D &,
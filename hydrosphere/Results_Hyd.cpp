@@ -155,7 +155,7 @@ void Results_Hyd::run_data ( int i_beg, double dr, double dthe, double L_hyd, do
 //                aux_v[ j ][ k ] = rectangular ( i_diff, dr, aux_grad_v );
 //                aux_w[ j ][ k ] = rectangular ( i_diff, dr, aux_grad_w );
             }
-            else cout << "       i_diff = i_max - i_Ekman    must be an even number to use the Simpson integration method" << endl;
+            else get_output() << "       i_diff = i_max - i_Ekman    must be an even number to use the Simpson integration method" << endl;
         }
     }
 
@@ -319,7 +319,7 @@ void Results_Hyd::run_data ( int i_beg, double dr, double dthe, double L_hyd, do
         }
     }
 
-    cout.precision ( 4 );
+    get_output().precision ( 4 );
 
 // printout of surface data at one predefinded location
     level = "m";
@@ -372,9 +372,9 @@ void Results_Hyd::run_data ( int i_beg, double dr, double dthe, double L_hyd, do
     Value_5 = BuoyancyForce_2D.y[ j_loc ][ k_loc ];
     Value_6 = Salt_total.y[ j_loc ][ k_loc ];
 
-    cout << endl << endl << heading << endl << endl;
+    get_output() << endl << endl << heading << endl << endl;
 
-    cout << setw ( 6 ) << i_loc_level << setw ( 2 ) << level << setw ( 5 )
+    get_output() << setw ( 6 ) << i_loc_level << setw ( 2 ) << level << setw ( 5 )
         << j_loc_deg << setw ( 3 ) << deg_lat << setw ( 4 ) << k_loc_deg
         << setw ( 3 ) << deg_lon<< "  " << setiosflags ( ios::left ) << setw ( 20 )
         << setfill ( '.' ) << name_Value_1 << " = " << resetiosflags ( ios::left )
@@ -414,10 +414,10 @@ void Results_Hyd::land_oceanFraction ( Array &h ){
 
     ozean_land = ( double ) h_ocean / ( double ) h_land;
 
-    cout.precision ( 3 );
+    get_output().precision ( 3 );
 
-    cout << endl;
-    cout << setiosflags ( ios::left ) << setw ( 50 ) << setfill ( '.' )
+    get_output() << endl;
+    get_output() << setiosflags ( ios::left ) << setw ( 50 ) << setfill ( '.' )
         << "      total number of points at constant hight " << " = " << resetiosflags ( ios::left )
         << setw ( 7 ) << fixed << setfill ( ' ' ) << h_point_max << endl << setiosflags ( ios::left )
         << setw ( 50 ) << setfill ( '.' ) << "      number of points on the ocean surface " << " = "
@@ -427,7 +427,7 @@ void Results_Hyd::land_oceanFraction ( Array &h ){
         << endl << setiosflags ( ios::left ) << setw ( 50 ) << setfill ( '.' ) << "      ocean/land ratio "
         << " = " << resetiosflags ( ios::left ) << setw ( 7 ) << fixed << setfill ( ' ' )
         << ozean_land << endl << endl;
-    cout << endl;
+    get_output() << endl;
 }
 
 
@@ -11,6 +11,7 @@
 #include <cmath>
 #include "RungeKutta_Hyd.h"
 #include "RHS_Hyd.h"
+#include "Utils.h"
 
 using namespace std;
 
@@ -135,8 +136,8 @@ void RungeKutta_Hydrosphere::solveRungeKutta_2D_Hydrosphere ( RHS_Hydrosphere &p
 //  2D surface iterations
 // Runge-Kutta 4. order for u, v and w component, temperature and salt concentration
 
-    cout.precision ( 9 );
-    cout.setf ( ios::fixed );
+    AtomUtils::get_output().precision ( 9 );
+    AtomUtils::get_output().setf ( ios::fixed );
 
     for ( int j = 1; j < jm-1; j++ )
     {
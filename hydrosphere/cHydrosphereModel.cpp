@@ -10,7 +10,9 @@
 */
 #include "cHydrosphereModel.h"
 
+#include <algorithm>
 #include <fstream>
+#include <memory>
 #include <iostream>
 #include <iomanip>
 #include <sstream>
@@ -37,12 +39,17 @@
 #include "MinMax_Hyd.h"
 #include "Results_Hyd.h"
 #include "Utils.h"
+#include "Convergence.h"
+#include "SliceFarm.h"
+#include "Checkpoint.h"
+#include "TraceRecorder.h"
+#include "MemoryAccount.h"
+#include "Telemetry.h"
 
 #include "Config.h"
 #include "tinyxml2.h"
 #include "PythonStream.h"
 
-#include "HydParameters.h"
 
 using namespace std;
 using namespace tinyxml2;
@@ -76,24 +83,49 @@ cHydrosphereModel::cHydrosphereModel() :
     old_arrays_3d {&t,  &u,  &v,  &w,  &c,  &p_dyn },
     new_arrays_3d {&tn, &un, &vn, &wn, &cn, &p_dynn},
     old_arrays_2d {&v,  &w,  &p_dyn },
-    new_arrays_2d {&vn, &wn, &p_dynn}
+    new_arrays_2d {&vn, &wn, &p_dynn},
+    // Python and Notebooks can't capture stdout from this module, the output of this model
+    // goes through a streambuf which redirects it to Python
+    output_buffer(PythonStream::is_enable() ? &ps : std::cout.rdbuf()),
+    output_stream(&output_buffer),
+    log_buffer(log_file_stream.rdbuf()),
+    log_output(&log_buffer)
 {
-    // Python and Notebooks can't capture stdout from this module. We override
-    // cout's streambuf with a class that redirects stdout out to Python.
-    PythonStream::OverrideCout();
-
-    // If Ctrl-C is pressed, quit
-    signal(SIGINT, exit);
+    // If Ctrl-C is pressed, quit, iterations which write restart files stop after writing them
+    Checkpoint::catch_signals();
+    Checkpoint::set_drain ( drain_streams );
 
     // set default configuration
     SetDefaultConfig();
 }
 
-cHydrosphereModel::~cHydrosphereModel() { }
+cHydrosphereModel::~cHydrosphereModel() {
+    output_buffer.drain();
+    log_buffer.drain();
+}
+
+std::ostream& cHydrosphereModel::log_stream(){
+    output_buffer.set_interval ( log_flush_interval );
+    log_buffer.set_interval ( log_flush_interval );
+    if ( !log_file_stream.is_open() || log_file_name != log_file ){
+        log_buffer.drain();
+        log_file_stream.close();
+        log_file_stream.clear();
+        log_file_stream.open ( log_file.c_str(), std::ofstream::out );
+        log_file_name = log_file;
+    }
+    return log_output;
+}
+
+AtomUtils::LogLevel cHydrosphereModel::log_level() const{
+    return AtomUtils::log_level ( log_levels, "hyd" );
+}
 
 #include "cHydrosphereDefaults.cpp.inc"
 
 void cHydrosphereModel::LoadConfig(const char *filename) {
+    StreamScope stream_scope ( output_stream, std::clog );
+
     XMLDocument doc;
     XMLError err = doc.LoadFile(filename);
     try{
@@ -128,6 +160,15 @@ void cHydrosphereModel::LoadConfig(const char *filename) {
 
 void cHydrosphereModel::RunTimeSlice(int Ma)
 {
+    StreamScope stream_scope ( output_stream, log_stream(), log_level() );
+
+    if ( !trace_file.empty() ){
+        TraceRecorder::open ( trace_file );
+    }
+    TraceRecorder::name_thread ( "hyd" );
+    TraceScope slice_trace ( "hyd time slice", "slice", "Ma", Ma );
+    TraceScope setup_trace ( "initial and boundary conditions", "slice" );
+
     // maximum numbers of grid points in r-, theta- and phi-direction ( im, jm, km ), 
     // maximum number of overall iterations ( n ),
     // maximum number of inner velocity loop iterations ( velocity_iter_max ),
@@ -135,6 +176,12 @@ void cHydrosphereModel::RunTimeSlice(int Ma)
 
     reset_arrays();
 
+    if ( memory_report ){
+        report_memory ( "memory of the hydrosphere at the start of time slice " + std::to_string ( Ma ) + " Ma" );
+    }
+
+    output_writer.set_depth ( output_queue_depth );
+
     mkdir(output_path.c_str(), 0777);
 
     int j_res = 0.0, k_res = 0.0;
@@ -155,8 +202,8 @@ void cHydrosphereModel::RunTimeSlice(int Ma)
     const double phi0 = 0.; // zero meridian in Greenwich
     const double r0 = 1.;// earth's radius is r_earth = 6731 km, here it is assumed to be infinity, circumference of the earth 40074 km
 
-    cout.precision ( 6 );
-    cout.setf ( ios::fixed );
+    get_output().precision ( 6 );
+    get_output().setf ( ios::fixed );
 
     //  Coordinate system in form of a spherical shell
     //  rad for r-direction normal to the surface of the earth, the for lateral and phi for longitudinal direction
@@ -165,12 +212,12 @@ void cHydrosphereModel::RunTimeSlice(int Ma)
     phi.Coordinates ( km, phi0, dphi );
 
 
-    //  cout << endl << " ***** printout of 3D-field temperature ***** " << endl << endl;
+    //  get_output() << endl << " ***** printout of 3D-field temperature ***** " << endl << endl;
     //  t.printArray( im, jm, km );
-    //  cout << endl << " ***** printout of 2D-field vegetation ***** " << endl << endl;
+    //  get_output() << endl << " ***** printout of 2D-field vegetation ***** " << endl << endl;
     //  Vegetation.printArray_2D( jm, km );
 
-    //  cout << endl << " ***** printout of 1D-field radius ***** " << endl << endl;
+    //  get_output() << endl << " ***** printout of 1D-field radius ***** " << endl << endl;
     //  rad.printArray_1D( im );
 
     //  initial values for the number of computed steps and the time
@@ -197,47 +244,53 @@ void cHydrosphereModel::RunTimeSlice(int Ma)
         std::string cmd_str = "python " + reconstruction_script_path + " " + std::to_string(Ma - time_step) + " " +
                 std::to_string(Ma) + " " + output_path + " " + BathymetrySuffix +" hyd";
         int ret = system(cmd_str.c_str());
-        std::cout << " reconstruction script returned: " << ret << std::endl;
+        get_output() << " reconstruction script returned: " << ret << std::endl;
     }
 
     string bathymetry_name = std::to_string(Ma) + BathymetrySuffix;
     string bathymetry_filepath = bathymetry_path + "/" + bathymetry_name;
     string input_path = output_path;
 
-    cout << "\n   Input is being read from " << input_path << "\n";
-    cout << "\n   Output is being written to " << output_path << "\n";
-    cout << "   Ma = " << Ma << "\n";
-    cout << "   bathymetry_path = " << bathymetry_path << "\n";
-    cout << "   bathymetry_filepath = " << bathymetry_filepath << "\n\n";
+    get_output() << "\n   Input is being read from " << input_path << "\n";
+    get_output() << "\n   Output is being written to " << output_path << "\n";
+    get_output() << "   Ma = " << Ma << "\n";
+    get_output() << "   bathymetry_path = " << bathymetry_path << "\n";
+    get_output() << "   bathymetry_filepath = " << bathymetry_filepath << "\n\n";
 
 
     if (verbose) {
-        cout << endl << endl << endl;
-        cout << "***** Hydrosphere General Circulation Model ( OGCM ) applied to laminar flow" << endl;
-        cout << "***** program for the computation of geo-atmospherical circulating flows in a spherical shell" << endl;
-        cout << "***** finite difference scheme for the solution of the 3D Navier-Stokes equations" << endl;
-        cout << "***** with 1 additional transport equations to describe the salinity" << endl;
-        cout << "***** 4th order Runge-Kutta scheme to solve 2nd order differential equations inside an inner iterational loop" << endl;
-        cout << "***** Poisson equation for the pressure solution in an outer iterational loop" << endl;
-        cout << "***** multi-layer and two-layer radiation model for the computation of the surface temperature" << endl;
-        cout << "***** temperature distribution given as a parabolic distribution from pole to pole, zonaly constant" << endl;
-        cout << "***** salinity is part of the Boussinesq approximation" << endl;
-        cout << "***** code developed by Roger Grundmann, Zum Marktsteig 1, D-01728 Bannewitz ( roger.grundmann@web.de )" << endl << endl;
-
-        cout << "***** original program name:  " << __FILE__ << endl;
-        cout << "***** compiled:  " << __DATE__  << "  at time:  " << __TIME__ << endl << endl;
+        get_output() << endl << endl << endl;
+        get_output() << "***** Hydrosphere General Circulation Model ( OGCM ) applied to laminar flow" << endl;
+        get_output() << "***** program for the computation of geo-atmospherical circulating flows in a spherical shell" << endl;
+        get_output() << "***** finite difference scheme for the solution of the 3D Navier-Stokes equations" << endl;
+        get_output() << "***** with 1 additional transport equations to describe the salinity" << endl;
+        get_output() << "***** 4th order Runge-Kutta scheme to solve 2nd order differential equations inside an inner iterational loop" << endl;
+        get_output() << "***** Poisson equation for the pressure solution in an outer iterational loop" << endl;
+        get_output() << "***** multi-layer and two-layer radiation model for the computation of the surface temperature" << endl;
+        get_output() << "***** temperature distribution given as a parabolic distribution from pole to pole, zonaly constant" << endl;
+        get_output() << "***** salinity is part of the Boussinesq approximation" << endl;
+        get_output() << "***** code developed by Roger Grundmann, Zum Marktsteig 1, D-01728 Bannewitz ( roger.grundmann@web.de )" << endl << endl;
+
+        get_output() << "***** original program name:  " << __FILE__ << endl;
+        get_output() << "***** compiled:  " << __DATE__  << "  at time:  " << __TIME__ << endl << endl;
     }
 
 
 
-    //  class PostProcess for data transport, read and write
-    PostProcess_Hydrosphere     read_Transfer ( im, jm, km, output_path );
-    read_Transfer.Atmosphere_TransferFile_read ( bathymetry_name, v, w, t, p_dyn, Evaporation_Dalton, Precipitation );
+    //  surface data of the atmosphere, handed over in memory or read from the v_w_transfer file
+    if ( surface_transfer.is_available ( bathymetry_name ) ){
+        surface_transfer.load ( im, v, w, t, p_dyn, Evaporation_Dalton, Precipitation );
+        get_output() << "***** surface data taken over from the atmosphere in memory" << endl << endl;
+    }else{
+        //  class PostProcess for data transport, read and write
+        PostProcess_Hydrosphere     read_Transfer ( im, jm, km, output_path );
+        read_Transfer.Atmosphere_TransferFile_read ( bathymetry_name, v, w, t, p_dyn, Evaporation_Dalton, Precipitation );
+    }
 
 
-    cout << "***** time slice for the Oceanic Global Circulation Modell ( OGCM ) is:    Ma = " << Ma << " million years" 
+    get_output() << "***** time slice for the Oceanic Global Circulation Modell ( OGCM ) is:    Ma = " << Ma << " million years" 
         << endl << endl;
-    cout << "***** bathymetry/topography given y the x-y-z data set:    " << bathymetry_name.c_str() << endl << endl;
+    get_output() << "***** bathymetry/topography given y the x-y-z data set:    " << bathymetry_name.c_str() << endl << endl;
 
 
     // class BC_Bathymetry_Hydrosphere for the geometrical boundary condition of the computational area
@@ -304,10 +357,34 @@ void cHydrosphereModel::RunTimeSlice(int Ma)
 
     double emin = epsres * 100.;
     iter_cnt = 1;
+
+    ConvergenceControl convergence_2D ( "2D OGCM", pressure_iter_max_2D, velocity_iter_max_2D, nm, 
+                                        convergence_window, epsres, convergence_steady_eps );
+    ConvergenceControl convergence_3D ( "3D OGCM", pressure_iter_max, velocity_iter_max, nm, 
+                                        convergence_window, epsres, convergence_steady_eps );
+
+    //  an interrupted time slice continues the 3D iterations after the last one of its restart file, 
+    //  the 2D iterations are done already
+    std::map<std::string, double> restart_state;
+    int pressure_iter_start = 1, velocity_iter_start = 1;
+    if ( restart && restart_checkpoint().read ( restart_file ( Ma ), Ma, restart_state ) ){
+        switch_2D = 1;
+        iter_cnt = int ( restart_state[ "iter_cnt" ] );
+        emin = restart_state[ "emin" ];
+        pressure_iter_start = int ( restart_state[ "pressure_iter" ] );
+        velocity_iter_start = int ( restart_state[ "velocity_iter" ] );
+        convergence_3D.restore ( restart_state );
+
+        get_output() << " restart file " << restart_file ( Ma ) << " read, continuing at n = " << iter_cnt << endl;
+        logger() << "time slice " << Ma << " resumed from " << restart_file ( Ma ) << " at n = " << iter_cnt << std::endl;
+    }
     
     // ::::::::::::::::::::::::::::::::::::::   begin of 2D loop for initial surface conditions: if ( switch_2D == 0 )   ::::::
+    setup_trace.end();
     if ( switch_2D != 1 )
     {
+        TraceScope loop_trace ( "2D iterations", "slice" );
+
         // ******   iteration of initial conditions on the surface for the correction of flows close to coasts   ************
         // ******   start of pressure and velocity iterations for the 2D iterational process   *********************************
         //:::::::::::::   begin of pressure loop_2D : if ( pressure_iter_2D > pressure_iter_max_2D )   ::::::::::::::::
@@ -316,12 +393,12 @@ void cHydrosphereModel::RunTimeSlice(int Ma)
             // :::::  begin of velocity loop_2D: if ( velocity_iter_2D > velocity_iter_max_2D )   ::::::::::
             for( int velocity_iter_2D = 1; velocity_iter_2D <= velocity_iter_max_2D; velocity_iter_2D++)
             {
-                cout << endl << endl;
-                cout << " >>>>>>>>>>>>>>>>>>>>>>>>>>>>>    2D    <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<" << endl;
-                cout << " 2D OGCM iterational process" << endl;
-                cout << " max total iteration number nm = " << nm << endl << endl;
+                get_output() << endl << endl;
+                get_output() << " >>>>>>>>>>>>>>>>>>>>>>>>>>>>>    2D    <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<" << endl;
+                get_output() << " 2D OGCM iterational process" << endl;
+                get_output() << " max total iteration number nm = " << nm << endl << endl;
 
-                cout << " present state of the 2D computation " << endl << "  current time slice, number of iterations, \
+                get_output() << " present state of the 2D computation " << endl << "  current time slice, number of iterations, \
                     maximum and current number of velocity iterations, maximum and current number of pressure iterations " 
                     << endl << endl << " Ma = " << Ma << "     n = " << iter_cnt << "    velocity_iter_max_2D = " << 
                     velocity_iter_max_2D << "     velocity_iter_2D = " << velocity_iter_2D << "    pressure_iter_max_2D = " 
@@ -340,16 +417,16 @@ void cHydrosphereModel::RunTimeSlice(int Ma)
 
                 oceanflow.Value_Limitation_Hyd ( h, u, v, w, p_dyn, t, c );
 /*
-      cout << endl << " ***** vor RK  printout of 3D-field v-component ***** " << endl << endl;
+      get_output() << endl << " ***** vor RK  printout of 3D-field v-component ***** " << endl << endl;
       v.printArray( im, jm, km );
 
-      cout << endl << " ***** vor RK  printout of 3D-field w-component ***** " << endl << endl;
+      get_output() << endl << " ***** vor RK  printout of 3D-field w-component ***** " << endl << endl;
       w.printArray( im, jm, km );
 
-      cout << endl << " ***** vor RK  printout of 3D-field vn-component ***** " << endl << endl;
+      get_output() << endl << " ***** vor RK  printout of 3D-field vn-component ***** " << endl << endl;
       v.printArray( im, jm, km );
 
-      cout << endl << " ***** vor RK  printout of 3D-field wn-component ***** " << endl << endl;
+      get_output() << endl << " ***** vor RK  printout of 3D-field wn-component ***** " << endl << endl;
       w.printArray( im, jm, km );
 */
         logger() << "enter cHydrosphereModel solveRungeKutta_2D_Hydrosphere: p_dyn max: " << p_dyn.max() << std::endl;
@@ -364,16 +441,16 @@ void cHydrosphereModel::RunTimeSlice(int Ma)
         logger() << "end cHydrosphereModel solveRungeKutta_2D_Hydrosphere: v-velocity max: " << v.max() << std::endl;
         logger() << "end cHydrosphereModel solveRungeKutta_2D_Hydrosphere: w-velocity max: " << w.max() << std::endl << std::endl;
 /*
-      cout << endl << " ***** nach RK  printout of 3D-field v-component ***** " << endl << endl;
+      get_output() << endl << " ***** nach RK  printout of 3D-field v-component ***** " << endl << endl;
       v.printArray( im, jm, km );
 
-      cout << endl << " ***** nach RK  printout of 3D-field w-component ***** " << endl << endl;
+      get_output() << endl << " ***** nach RK  printout of 3D-field w-component ***** " << endl << endl;
       w.printArray( im, jm, km );
 
-      cout << endl << " ***** nach RK  printout of 3D-field vn-component ***** " << endl << endl;
+      get_output() << endl << " ***** nach RK  printout of 3D-field vn-component ***** " << endl << endl;
       v.printArray( im, jm, km );
 
-      cout << endl << " ***** nach RK  printout of 3D-field wn-component ***** " << endl << endl;
+      get_output() << endl << " ***** nach RK  printout of 3D-field wn-component ***** " << endl << endl;
       w.printArray( im, jm, km );
 */
                 // new value of the residuum ( div c = 0 ) for the computation of the continuity equation ( emin )
@@ -389,14 +466,20 @@ void cHydrosphereModel::RunTimeSlice(int Ma)
                 //state of a steady solution resulting from the pressure equation ( min_p ) for pn from the actual solution step
                 Accuracy_Hyd        min_Stationary_2D ( iter_cnt, nm, Ma, im, jm, km, emin, j_res, k_res, velocity_iter_2D, 
                                         pressure_iter_2D, velocity_iter_max_2D, pressure_iter_max_2D );
-                min_Stationary_2D.steadyQuery_2D ( h, v, vn, w, wn, p_dyn, p_dynn );
+                double steady_change = min_Stationary_2D.steadyQuery_2D ( h, v, vn, w, wn, p_dyn, p_dynn );
+
+                convergence_2D.update ( emin, steady_change, residuum );
 
                 move_data_to_new_arrays(jm, km, 1., old_arrays_2d, new_arrays_2d, im-1);
 
                 iter_cnt++;
+
+                if ( convergence_2D.is_converged() )  break;
             }
             //  :::::::::::::   end of velocity loop_2D: if ( velocity_iter_2D > velocity_iter_max_2D )   ::::::::::::::
 
+            //  steady solution reached, the remaining iterations are skipped
+            if ( convergence_2D.is_converged() )  break;
 
             //  pressure from the Euler equation ( 2. order derivatives of the pressure by adding the Poisson right hand sides )
             startPressure.computePressure_2D ( u_0, r_0_water, rad, the, p_dyn, p_dynn, h, aux_v, aux_w );
@@ -404,29 +487,56 @@ void cHydrosphereModel::RunTimeSlice(int Ma)
             // limit of the computation in the sense of time steps
             if ( iter_cnt > nm )
             {
-                cout << "       nm = " << nm << "     .....     maximum number of iterations   nm   reached!" << endl;
+                get_output() << "       nm = " << nm << "     .....     maximum number of iterations   nm   reached!" << endl;
                 break;
             }
         } //end of pressure loop_2D: if ( pressure_iter_2D > pressure_iter_max_2D ) 
+
+        get_output() << endl << convergence_2D.report() << endl;
+        logger() << convergence_2D.report() << std::endl;
+
         iter_cnt = 1;
         switch_2D = 1;                      // 2D calculations finished
         emin = epsres * 100.;
     }// end of 2D loop for initial surface conditions: if ( switch_2D == 0 )   ::::::::::
 
-    cout << endl << endl;
+    get_output() << endl << endl;
+
+
+    //  SIGINT and SIGTERM let the running iteration finish and write the restart file
+    CheckpointScope checkpoint_scope ( restart );
 
+    //  time spent in the phases of the iterations
+    phase_profile.reset();
+    phase_profile.count_hardware ( perf_counters );
+    IterationTimer iteration_timer ( phase_profile );
+    TraceScope loop_trace ( "3D iterations", "slice" );
+
+    //  convergence of each iteration, a resumed time slice continues the records of the interrupted run
+    TelemetrySink telemetry_sink;
+    if ( telemetry ){
+        telemetry_sink.open ( output_path + "/" + std::to_string ( Ma ) + "Ma_hyd_telemetry.jsonl", "hyd", 
+                              !restart_state.empty() );
+    }
 
     // ::::   begin of 3D pressure loop : if ( pressure_iter > pressure_iter_max )   ::::::::::::::::::::::::
-    for ( int pressure_iter = 1; pressure_iter <= pressure_iter_max; pressure_iter++ )
+    for ( int pressure_iter = pressure_iter_start; 
+          pressure_iter <= pressure_iter_max && !convergence_3D.is_converged(); pressure_iter++ )
     {
+        TraceScope pressure_trace ( "pressure iteration", "iteration", "pressure_iter", pressure_iter );
+
         //   begin of 3D velocity loop : if ( velocity_iter > velocity_iter_max )   :::::::::::
-        for( int velocity_iter = 1; velocity_iter <= velocity_iter_max; velocity_iter++ )
+        for( int velocity_iter = ( pressure_iter == pressure_iter_start ) ? velocity_iter_start : 1; 
+             velocity_iter <= velocity_iter_max; velocity_iter++ )
         {
-            cout << endl << endl;
-            cout << " >>>>>>>>>>>>>>>>>>>>>>>>>>>>>    3D    <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<" << endl;
-            cout << " 3D OGCM iterational process" << endl;
-            cout << " max total iteration number nm = " << nm << endl << endl;
-            cout << " present state of the computation " << endl << " current time slice, number of iterations, maximum \
+            TraceScope velocity_trace ( "velocity iteration", "iteration", "n", iter_cnt );
+            phase_profile.iteration();
+
+            get_output() << endl << endl;
+            get_output() << " >>>>>>>>>>>>>>>>>>>>>>>>>>>>>    3D    <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<" << endl;
+            get_output() << " 3D OGCM iterational process" << endl;
+            get_output() << " max total iteration number nm = " << nm << endl << endl;
+            get_output() << " present state of the computation " << endl << " current time slice, number of iterations, maximum \
                 and current number of velocity iterations, maximum and current number of pressure iterations " << endl 
                 << endl << " Ma = " << Ma << "     n = " << iter_cnt << "    velocity_iter_max = " << velocity_iter_max << 
                 "     velocity_iter = " << velocity_iter << "    pressure_iter_max = " << pressure_iter_max << 
@@ -434,21 +544,33 @@ void cHydrosphereModel::RunTimeSlice(int Ma)
 
             //old value of the residuum ( div c = 0 ) for the computation of the continuity equation ( emin )
             Accuracy_Hyd        min_Residuum_old ( im, jm, km, dr, dthe, dphi );
-            min_Residuum_old.residuumQuery_3D ( rad, the, u, v, w );
+            {
+                PhaseTimer timer ( phase_profile, "residuum/steady queries" );
+                min_Residuum_old.residuumQuery_3D ( rad, the, u, v, w );
+            }
             emin = min_Residuum_old.out_min (  );
 
             residuum_old = emin;
 
             // class RB_Hydrosphaere for the geometry of a shell of a sphere
-            boundary.RB_radius ( ca, ta, pa, dr, rad, t, u, v, w, p_dyn, c );
-            boundary.RB_theta ( ca, ta, pa, t, u, v, w, p_dyn, c );
-            boundary.RB_phi ( t, u, v, w, p_dyn, c );
+            {
+                PhaseTimer timer ( phase_profile, "boundary conditions" );
+                boundary.RB_radius ( ca, ta, pa, dr, rad, t, u, v, w, p_dyn, c );
+                boundary.RB_theta ( ca, ta, pa, t, u, v, w, p_dyn, c );
+                boundary.RB_phi ( t, u, v, w, p_dyn, c );
+            }
 
             // surface pressure computed by surface temperature with gas equation
-            oceanflow.BC_Pressure_Density ( p_stat, r_water, r_salt_water, t, c, h );
+            {
+                PhaseTimer timer ( phase_profile, "BC_Pressure_Density" );
+                oceanflow.BC_Pressure_Density ( p_stat, r_water, r_salt_water, t, c, h );
+            }
 
             // limiting the increase of flow properties around geometrical peaks and corners
-            oceanflow.Value_Limitation_Hyd ( h, u, v, w, p_dyn, t, c );
+            {
+                PhaseTimer timer ( phase_profile, "Value_Limitation_Hyd" );
+                oceanflow.Value_Limitation_Hyd ( h, u, v, w, p_dyn, t, c );
+            }
 
         logger() << "enter cHydrosphereModel solveRungeKutta_3D_Hydrosphere: t max: " << (t.max() - 1)*t_0 << std::endl;
 
@@ -458,10 +580,13 @@ void cHydrosphereModel::RunTimeSlice(int Ma)
 
 
             // class RungeKutta for the solution of the differential equations describing the flow properties
-            result.solveRungeKutta_3D_Hydrosphere ( prepare, iter_cnt, L_hyd, g, cp_w, u_0, t_0, c_0, r_0_water, ta, pa, ca, 
-                rad, the, phi, Evaporation_Dalton, Precipitation, h, rhs_t, rhs_u, rhs_v, rhs_w, rhs_c, t, u, v, w, 
-                p_dyn, c, tn, un, vn, wn, p_dynn, cn, aux_u, aux_v, aux_w, Salt_Finger, Salt_Diffusion, BuoyancyForce_3D, 
-                Salt_Balance, p_stat, r_water, r_salt_water, Bathymetry );
+            {
+                PhaseTimer timer ( phase_profile, "solveRungeKutta_3D_Hydrosphere" );
+                result.solveRungeKutta_3D_Hydrosphere ( prepare, iter_cnt, L_hyd, g, cp_w, u_0, t_0, c_0, r_0_water, ta, pa, 
+                    ca, rad, the, phi, Evaporation_Dalton, Precipitation, h, rhs_t, rhs_u, rhs_v, rhs_w, rhs_c, t, u, v, w, 
+                    p_dyn, c, tn, un, vn, wn, p_dynn, cn, aux_u, aux_v, aux_w, Salt_Finger, Salt_Diffusion, BuoyancyForce_3D, 
+                    Salt_Balance, p_stat, r_water, r_salt_water, Bathymetry );
+            }
 
         logger() << "end cHydrosphereModel solveRungeKutta_3D_Hydrosphere: t max: " << (t.max() - 1)*t_0 << std::endl;
 
@@ -471,11 +596,17 @@ void cHydrosphereModel::RunTimeSlice(int Ma)
 
             // class RB_Bathymetrie for the topography and bathymetry as boundary conditions for the structures of 
             // the continents and the ocean ground
-            depth.BC_SolidGround ( ca, ta, pa, h, t, u, v, w, p_dyn, c, tn, un, vn, wn, p_dynn, cn );
+            {
+                PhaseTimer timer ( phase_profile, "BC_SolidGround" );
+                depth.BC_SolidGround ( ca, ta, pa, h, t, u, v, w, p_dyn, c, tn, un, vn, wn, p_dynn, cn );
+            }
 
             // new value of the residuum ( div c = 0 ) for the computation of the continuity equation ( emin )
             Accuracy_Hyd        min_Residuum ( im, jm, km, dr, dthe, dphi );
-            min_Residuum.residuumQuery_3D ( rad, the, u, v, w );
+            {
+                PhaseTimer timer ( phase_profile, "residuum/steady queries" );
+                min_Residuum.residuumQuery_3D ( rad, the, u, v, w );
+            }
             emin = min_Residuum.out_min (  );
             int i_res = min_Residuum.out_i_res (  );
             j_res = min_Residuum.out_j_res (  );
@@ -487,148 +618,357 @@ void cHydrosphereModel::RunTimeSlice(int Ma)
             // statements on the convergence und iterational process
             Accuracy_Hyd        min_Stationary ( iter_cnt, nm, Ma, im, jm, km, emin, i_res, j_res, k_res, velocity_iter, 
                                     pressure_iter, velocity_iter_max, pressure_iter_max, L_hyd );
-            min_Stationary.steadyQuery_3D ( u, un, v, vn, w, wn, t, tn, c, cn, p_dyn, p_dynn );
-
-            // 3D_fields
-
-            //      searching of maximum and minimum values of temperature
-            string str_max_temperature = " max temperature ", str_min_temperature = " min temperature ", str_unit_temperature = "C";
-            MinMax_Hyd      minmaxTemperature ( im, jm, km, u_0, c_0, L_hyd );
-            minmaxTemperature.searchMinMax_3D ( str_max_temperature, str_min_temperature, str_unit_temperature, t, h );
-
-            //  searching of maximum and minimum values of u-component
-            string str_max_u = " max 3D u-component ", str_min_u = " min 3D u-component ", str_unit_u = "mm/s";
-            MinMax_Hyd      minmax_u ( im, jm, km, u_0, c_0, L_hyd );
-            minmax_u.searchMinMax_3D ( str_max_u, str_min_u, str_unit_u, u, h );
-
-            //  searching of maximum and minimum values of v-component
-            string str_max_v = " max 3D v-component ", str_min_v = " min 3D v-component ", str_unit_v = "m/s";
-            MinMax_Hyd      minmax_v ( im, jm, km, u_0, c_0, L_hyd );
-            minmax_v.searchMinMax_3D ( str_max_v, str_min_v, str_unit_v, v, h );
-
-            //  searching of maximum and minimum values of w-component
-            string str_max_w = " max 3D w-component ", str_min_w = " min 3D w-component ", str_unit_w = "m/s";
-            MinMax_Hyd      minmax_w ( im, jm, km, u_0, c_0, L_hyd );
-            minmax_w.searchMinMax_3D ( str_max_w, str_min_w, str_unit_w, w, h );
-
-            //      searching of maximum and minimum values of pressure
-            string str_max_pressure = " max pressure dynamic ", str_min_pressure = " min pressure dynamic ", str_unit_pressure = "hPa";
-            MinMax_Hyd      minmaxPressure ( im, jm, km, u_0, c_0, L_hyd );
-            minmaxPressure.searchMinMax_3D ( str_max_pressure, str_min_pressure, str_unit_pressure, p_dyn, h );
-
-            //      searching of maximum and minimum values of static pressure
-            string str_max_pressure_stat = " max pressure static ", str_min_pressure_stat = " min pressure static ", str_unit_pressure_stat = "bar";
-            MinMax_Hyd      minmaxPressure_stat ( im, jm, km, u_0, c_0, L_hyd );
-            minmaxPressure_stat.searchMinMax_3D ( str_max_pressure_stat, str_min_pressure_stat, str_unit_pressure_stat, p_stat, h );
-
-            cout << endl << " salinity based results in the three dimensional space: " << endl << endl;
-
-            //  searching of maximum and minimum values of salt concentration
-            string str_max_salt_concentration = " max salt concentration ", str_min_salt_concentration = " min salt concentration ", str_unit_salt_concentration = "psu";
-            MinMax_Hyd      minmaxSalt ( im, jm, km, u_0, c_0, L_hyd );
-            minmaxSalt.searchMinMax_3D ( str_max_salt_concentration, str_min_salt_concentration, str_unit_salt_concentration, c, h );
-
-            //  searching of maximum and minimum values of salt balance
-            string str_max_salt_balance = " max salt balance ", str_min_salt_balance = " min salt balance ", str_unit_salt_balance = "psu";
-            MinMax_Hyd      minmaxSaltBalance ( im, jm, km, u_0, c_0, L_hyd );
-            minmaxSaltBalance.searchMinMax_3D ( str_max_salt_balance, str_min_salt_balance, str_unit_salt_balance, Salt_Balance, h );
-
-            //  searching of maximum and minimum values of salt finger
-            string str_max_salt_finger = " max salt finger ", str_min_salt_finger = " min salt finger ", str_unit_salt_finger = "psu";
-            MinMax_Hyd      minmaxSaltFinger ( im, jm, km, u_0, c_0, L_hyd );
-            minmaxSaltFinger.searchMinMax_3D ( str_max_salt_finger, str_min_salt_finger, str_unit_salt_finger, Salt_Finger, h );
-
-            //  searching of maximum and minimum values of salt diffusion
-            string str_max_salt_diffusion = " max salt diffusion ", str_min_salt_diffusion = " min salt diffusion ", str_unit_salt_diffusion = "psu";
-            MinMax_Hyd      minmaxSaltDiffusion ( im, jm, km, u_0, c_0, L_hyd );
-            minmaxSaltDiffusion.searchMinMax_3D ( str_max_salt_diffusion, str_min_salt_diffusion, str_unit_salt_diffusion, Salt_Diffusion, h );
-
-            //  searching of maximum and minimum values of buoyancy force
-            string str_max_BuoyancyForce_3D = " max buoyancy force ", str_min_BuoyancyForce_3D = " min buoyancy force ", str_unit_BuoyancyForce_3D = "kN/m2";
-            MinMax_Hyd      minmaxBuoyancyForce_3D ( im, jm, km, u_0, c_0, L_hyd );
-            minmaxBuoyancyForce_3D.searchMinMax_3D ( str_max_BuoyancyForce_3D, str_min_BuoyancyForce_3D, str_unit_BuoyancyForce_3D, BuoyancyForce_3D, h );
-
-            // 2D_fields
-
-            //  searching of maximum and minimum values of total salt volume in a column
-            string str_max_salt_total = " max salt total ", str_min_salt_total = " min salt total ", str_unit_salt_total = "psu";
-            MinMax_Hyd      minmaxSalt_total ( jm, km, c_0 );
-            minmaxSalt_total.searchMinMax_2D ( str_max_salt_total, str_min_salt_total, str_unit_salt_total, Salt_total, h );
-
-            //  searching of maximum and minimum values of salt finger volume in a column
-            string str_max_Salt_Finger = " max Salt_Finger ", str_min_Salt_Finger = " min Salt_Finger ", str_unit_Salt_Finger = "psu";
-            MinMax_Hyd      minmaxSalt_finger ( jm, km, c_0 );
-            minmaxSalt_finger.searchMinMax_2D ( str_max_Salt_Finger, str_min_Salt_Finger, str_unit_Salt_Finger, SaltFinger, h );
-
-            //  searching of maximum and minimum values of salt diffusion volume in a column
-            string str_max_Salt_Diffusion = " max Salt_Diffusion ", str_min_Salt_Diffusion = " min Salt_Diffusion ", str_unit_Salt_Diffusion = "psu";
-            MinMax_Hyd      minmaxSalt_diffusion ( jm, km, c_0 );
-            minmaxSalt_diffusion.searchMinMax_2D ( str_max_Salt_Diffusion, str_min_Salt_Diffusion, str_unit_Salt_Diffusion, SaltDiffusion, h );
-
-            //  searching of maximum and minimum values of salt diffusion volume in a column
-            string str_max_BuoyancyForce_2D = " max BuoyancyForce_2D ", str_min_BuoyancyForce_2D = " min BuoyancyForce_2D ", str_unit_BuoyancyForce_2D = "N";
-            MinMax_Hyd      minmaxBuoyancyForce_2D ( jm, km, c_0 );
-            minmaxBuoyancyForce_2D.searchMinMax_2D ( str_max_BuoyancyForce_2D, str_min_BuoyancyForce_2D, str_unit_BuoyancyForce_2D, BuoyancyForce_2D, h );
-
-            cout << endl << " deep currents averaged for a two dimensional plane: " << endl << endl;
-
-            //  searching of maximum and minimum values of upwelling volume in a column
-            string str_max_upwelling = " max upwelling ", str_min_upwelling = " min upwelling ", str_unit_upwelling = "m/s";
-            MinMax_Hyd      minmaxUpwelling ( jm, km, c_0 );
-            minmaxUpwelling.searchMinMax_2D ( str_max_upwelling, str_min_upwelling, str_unit_upwelling, Upwelling, h );
-
-            //  searching of maximum and minimum values of downwelling volume in a column
-            string str_max_downwelling = " max downwelling ", str_min_downwelling = " min downwelling ", str_unit_downwelling = "m/s";
-            MinMax_Hyd      minmaxDownwelling ( jm, km, c_0 );
-            minmaxDownwelling.searchMinMax_2D ( str_max_downwelling, str_min_downwelling, str_unit_downwelling, Downwelling, h );
-
-            //  searching of maximum and minimum values of bottom water volume in a column
-            string str_max_bottom_water = " max bottom water ", str_min_bottom_water = " min bottom water ", str_unit_bottom_water = "m/s";
-            MinMax_Hyd      minmaxBottom_water ( jm, km, c_0 );
-            minmaxBottom_water.searchMinMax_2D ( str_max_bottom_water, str_min_bottom_water, str_unit_bottom_water, BottomWater, h );
-
-            //  searching of maximum and minimum values of the bathymetry
-            string str_max_bathymetry = " max bathymetry ", str_min_bathymetry = " min bathymetry ", str_unit_bathymetry = "m";
-            MinMax_Hyd      minmaxBathymetry ( jm, km, c_0 );
-            minmaxBathymetry.searchMinMax_2D ( str_max_bathymetry, str_min_bathymetry, str_unit_bathymetry, Bathymetry, h );
+            double steady_change;
+            {
+                PhaseTimer timer ( phase_profile, "residuum/steady queries" );
+                steady_change = min_Stationary.steadyQuery_3D ( u, un, v, vn, w, wn, t, tn, c, cn, p_dyn, p_dynn );
+            }
+
+            convergence_3D.update ( emin, steady_change, residuum );
+
+            {
+                PhaseTimer timer ( phase_profile, "searchMinMax" );
+
+                // 3D_fields
+
+                //      searching of maximum and minimum values of temperature
+                string str_max_temperature = " max temperature ", str_min_temperature = " min temperature ", str_unit_temperature = "C";
+                MinMax_Hyd      minmaxTemperature ( im, jm, km, u_0, c_0, L_hyd );
+                minmaxTemperature.searchMinMax_3D ( str_max_temperature, str_min_temperature, str_unit_temperature, t, h );
+
+                //  searching of maximum and minimum values of u-component
+                string str_max_u = " max 3D u-component ", str_min_u = " min 3D u-component ", str_unit_u = "mm/s";
+                MinMax_Hyd      minmax_u ( im, jm, km, u_0, c_0, L_hyd );
+                minmax_u.searchMinMax_3D ( str_max_u, str_min_u, str_unit_u, u, h );
+
+                //  searching of maximum and minimum values of v-component
+                string str_max_v = " max 3D v-component ", str_min_v = " min 3D v-component ", str_unit_v = "m/s";
+                MinMax_Hyd      minmax_v ( im, jm, km, u_0, c_0, L_hyd );
+                minmax_v.searchMinMax_3D ( str_max_v, str_min_v, str_unit_v, v, h );
+
+                //  searching of maximum and minimum values of w-component
+                string str_max_w = " max 3D w-component ", str_min_w = " min 3D w-component ", str_unit_w = "m/s";
+                MinMax_Hyd      minmax_w ( im, jm, km, u_0, c_0, L_hyd );
+                minmax_w.searchMinMax_3D ( str_max_w, str_min_w, str_unit_w, w, h );
+
+                //      searching of maximum and minimum values of pressure
+                string str_max_pressure = " max pressure dynamic ", str_min_pressure = " min pressure dynamic ", str_unit_pressure = "hPa";
+                MinMax_Hyd      minmaxPressure ( im, jm, km, u_0, c_0, L_hyd );
+                minmaxPressure.searchMinMax_3D ( str_max_pressure, str_min_pressure, str_unit_pressure, p_dyn, h );
+
+                //      searching of maximum and minimum values of static pressure
+                string str_max_pressure_stat = " max pressure static ", str_min_pressure_stat = " min pressure static ", str_unit_pressure_stat = "bar";
+                MinMax_Hyd      minmaxPressure_stat ( im, jm, km, u_0, c_0, L_hyd );
+                minmaxPressure_stat.searchMinMax_3D ( str_max_pressure_stat, str_min_pressure_stat, str_unit_pressure_stat, p_stat, h );
+
+                get_output() << endl << " salinity based results in the three dimensional space: " << endl << endl;
+
+                //  searching of maximum and minimum values of salt concentration
+                string str_max_salt_concentration = " max salt concentration ", str_min_salt_concentration = " min salt concentration ", str_unit_salt_concentration = "psu";
+                MinMax_Hyd      minmaxSalt ( im, jm, km, u_0, c_0, L_hyd );
+                minmaxSalt.searchMinMax_3D ( str_max_salt_concentration, str_min_salt_concentration, str_unit_salt_concentration, c, h );
+
+                //  searching of maximum and minimum values of salt balance
+                string str_max_salt_balance = " max salt balance ", str_min_salt_balance = " min salt balance ", str_unit_salt_balance = "psu";
+                MinMax_Hyd      minmaxSaltBalance ( im, jm, km, u_0, c_0, L_hyd );
+                minmaxSaltBalance.searchMinMax_3D ( str_max_salt_balance, str_min_salt_balance, str_unit_salt_balance, Salt_Balance, h );
+
+                //  searching of maximum and minimum values of salt finger
+                string str_max_salt_finger = " max salt finger ", str_min_salt_finger = " min salt finger ", str_unit_salt_finger = "psu";
+                MinMax_Hyd      minmaxSaltFinger ( im, jm, km, u_0, c_0, L_hyd );
+                minmaxSaltFinger.searchMinMax_3D ( str_max_salt_finger, str_min_salt_finger, str_unit_salt_finger, Salt_Finger, h );
+
+                //  searching of maximum and minimum values of salt diffusion
+                string str_max_salt_diffusion = " max salt diffusion ", str_min_salt_diffusion = " min salt diffusion ", str_unit_salt_diffusion = "psu";
+                MinMax_Hyd      minmaxSaltDiffusion ( im, jm, km, u_0, c_0, L_hyd );
+                minmaxSaltDiffusion.searchMinMax_3D ( str_max_salt_diffusion, str_min_salt_diffusion, str_unit_salt_diffusion, Salt_Diffusion, h );
+
+                //  searching of maximum and minimum values of buoyancy force
+                string str_max_BuoyancyForce_3D = " max buoyancy force ", str_min_BuoyancyForce_3D = " min buoyancy force ", str_unit_BuoyancyForce_3D = "kN/m2";
+                MinMax_Hyd      minmaxBuoyancyForce_3D ( im, jm, km, u_0, c_0, L_hyd );
+                minmaxBuoyancyForce_3D.searchMinMax_3D ( str_max_BuoyancyForce_3D, str_min_BuoyancyForce_3D, str_unit_BuoyancyForce_3D, BuoyancyForce_3D, h );
+
+                // 2D_fields
+
+                //  searching of maximum and minimum values of total salt volume in a column
+                string str_max_salt_total = " max salt total ", str_min_salt_total = " min salt total ", str_unit_salt_total = "psu";
+                MinMax_Hyd      minmaxSalt_total ( jm, km, c_0 );
+                minmaxSalt_total.searchMinMax_2D ( str_max_salt_total, str_min_salt_total, str_unit_salt_total, Salt_total, h );
+
+                //  searching of maximum and minimum values of salt finger volume in a column
+                string str_max_Salt_Finger = " max Salt_Finger ", str_min_Salt_Finger = " min Salt_Finger ", str_unit_Salt_Finger = "psu";
+                MinMax_Hyd      minmaxSalt_finger ( jm, km, c_0 );
+                minmaxSalt_finger.searchMinMax_2D ( str_max_Salt_Finger, str_min_Salt_Finger, str_unit_Salt_Finger, SaltFinger, h );
+
+                //  searching of maximum and minimum values of salt diffusion volume in a column
+                string str_max_Salt_Diffusion = " max Salt_Diffusion ", str_min_Salt_Diffusion = " min Salt_Diffusion ", str_unit_Salt_Diffusion = "psu";
+                MinMax_Hyd      minmaxSalt_diffusion ( jm, km, c_0 );
+                minmaxSalt_diffusion.searchMinMax_2D ( str_max_Salt_Diffusion, str_min_Salt_Diffusion, str_unit_Salt_Diffusion, SaltDiffusion, h );
+
+                //  searching of maximum and minimum values of salt diffusion volume in a column
+                string str_max_BuoyancyForce_2D = " max BuoyancyForce_2D ", str_min_BuoyancyForce_2D = " min BuoyancyForce_2D ", str_unit_BuoyancyForce_2D = "N";
+                MinMax_Hyd      minmaxBuoyancyForce_2D ( jm, km, c_0 );
+                minmaxBuoyancyForce_2D.searchMinMax_2D ( str_max_BuoyancyForce_2D, str_min_BuoyancyForce_2D, str_unit_BuoyancyForce_2D, BuoyancyForce_2D, h );
+
+                get_output() << endl << " deep currents averaged for a two dimensional plane: " << endl << endl;
+
+                //  searching of maximum and minimum values of upwelling volume in a column
+                string str_max_upwelling = " max upwelling ", str_min_upwelling = " min upwelling ", str_unit_upwelling = "m/s";
+                MinMax_Hyd      minmaxUpwelling ( jm, km, c_0 );
+                minmaxUpwelling.searchMinMax_2D ( str_max_upwelling, str_min_upwelling, str_unit_upwelling, Upwelling, h );
+
+                //  searching of maximum and minimum values of downwelling volume in a column
+                string str_max_downwelling = " max downwelling ", str_min_downwelling = " min downwelling ", str_unit_downwelling = "m/s";
+                MinMax_Hyd      minmaxDownwelling ( jm, km, c_0 );
+                minmaxDownwelling.searchMinMax_2D ( str_max_downwelling, str_min_downwelling, str_unit_downwelling, Downwelling, h );
+
+                //  searching of maximum and minimum values of bottom water volume in a column
+                string str_max_bottom_water = " max bottom water ", str_min_bottom_water = " min bottom water ", str_unit_bottom_water = "m/s";
+                MinMax_Hyd      minmaxBottom_water ( jm, km, c_0 );
+                minmaxBottom_water.searchMinMax_2D ( str_max_bottom_water, str_min_bottom_water, str_unit_bottom_water, BottomWater, h );
+
+                //  searching of maximum and minimum values of the bathymetry
+                string str_max_bathymetry = " max bathymetry ", str_min_bathymetry = " min bathymetry ", str_unit_bathymetry = "m";
+                MinMax_Hyd      minmaxBathymetry ( jm, km, c_0 );
+                minmaxBathymetry.searchMinMax_2D ( str_max_bathymetry, str_min_bathymetry, str_unit_bathymetry, Bathymetry, h );
+            }
 
 
             // composition of results
-            calculate_MSL.run_data ( i_beg, dr, dthe, L_hyd, u_0, c_0, rad, the, h, u, v, w, c, Salt_Balance, Salt_Finger, 
-                    Salt_Diffusion, BuoyancyForce_3D, Upwelling, Downwelling, SaltFinger, SaltDiffusion, BuoyancyForce_2D, 
-                    Salt_total, BottomWater );
+            {
+                PhaseTimer timer ( phase_profile, "run_data" );
+                calculate_MSL.run_data ( i_beg, dr, dthe, L_hyd, u_0, c_0, rad, the, h, u, v, w, c, Salt_Balance, 
+                        Salt_Finger, Salt_Diffusion, BuoyancyForce_3D, Upwelling, Downwelling, SaltFinger, SaltDiffusion, 
+                        BuoyancyForce_2D, Salt_total, BottomWater );
+            }
 
             //  restoring the velocity component and the temperature for the new time step
-            move_data_to_new_arrays(im, jm, km, 1., old_arrays_3d, new_arrays_3d);
+            {
+                PhaseTimer timer ( phase_profile, "move_data_to_new_arrays" );
+                move_data_to_new_arrays(im, jm, km, 1., old_arrays_3d, new_arrays_3d);
+            }
+
+            if ( telemetry_sink.is_open() ){
+                TelemetrySink::Iteration iteration = { Ma, iter_cnt, pressure_iter, velocity_iter, dt, residuum, emin, 
+                                                       steady_change };
+                telemetry_sink.record ( iteration, min_Stationary.out_changes(), phase_profile );
+            }
 
             iter_cnt++;
+
+            if ( restart && ( Checkpoint::stop_requested() || 
+                              ( restart_interval > 0 && ( iter_cnt - 1 ) % restart_interval == 0 ) ) ){
+                write_restart ( Ma, pressure_iter, velocity_iter + 1, emin, convergence_3D );
+                if ( Checkpoint::stop_requested() ){
+                    output_writer.wait();
+                    Checkpoint::stop();
+                }
+            }
+
+            if ( convergence_3D.is_converged() )  break;
         }
         //  ::::::  end of velocity loop_3D: if ( velocity_iter > velocity_iter_max )   :::::::::::::::::::::::
 
+        //  steady solution reached, the remaining iterations are skipped
+        if ( convergence_3D.is_converged() )  break;
+
 
         //  pressure from the Euler equation ( 2. order derivatives of the pressure by adding the Poisson right hand sides )
-        startPressure.computePressure_3D ( u_0, r_0_water, rad, the, p_dyn, p_dynn, h, aux_u, aux_v, aux_w );
+        {
+            PhaseTimer timer ( phase_profile, "computePressure_3D" );
+            startPressure.computePressure_3D ( u_0, r_0_water, rad, the, p_dyn, p_dynn, h, aux_u, aux_v, aux_w );
+        }
 
         if( pressure_iter % checkpoint == 0 ){
+            PhaseTimer timer ( phase_profile, "write_file" );
             write_file(bathymetry_name, output_path);
         }
 
+        //  the pressure step is not part of an iteration of the velocity loop
+        if ( telemetry_sink.is_open() ){
+            telemetry_sink.record_pressure_step ( Ma, iter_cnt - 1, pressure_iter, phase_profile );
+        }
+
         //  limit of the computation in the sense of time steps
         if ( iter_cnt > nm )
         {
-            cout << "       nm = " << nm << "     .....     maximum number of iterations   nm   reached!" << endl;
+            get_output() << "       nm = " << nm << "     .....     maximum number of iterations   nm   reached!" << endl;
             break;
         }
     }// end of pressure loop_3D: if ( pressure_iter > pressure_iter_max )   :::::::::::
+    iteration_timer.stop();
+    loop_trace.end();
+
+    get_output() << endl << convergence_3D.report() << endl;
+    logger() << convergence_3D.report() << std::endl;
+
+    get_output() << endl << endl;
+
+    //  the iterations of the time slice are complete, a new run starts it afresh
+    if ( restart ){
+        std::remove ( restart_file ( Ma ).c_str() );
+    }
+
+    if ( phase_report && !phase_profile.empty() ){
+        string report = phase_profile.report ( "3D iterations" );
+        get_output() << endl << report << endl;
+        logger() << report << std::endl;
+        phase_profile.write_json ( output_path + "/" + std::to_string ( Ma ) + "Ma_hyd_phases.json", "hyd", Ma );
+    }
+
+    {
+        TraceScope write_trace ( "write result files", "io" );
+        write_file(bathymetry_name, output_path, true);
+    }
 
-    cout << endl << endl;
+    //  the result files of the time slice are complete before the next time slice reads them
+    {
+        TraceScope wait_trace ( "wait for output writer", "io" );
+        output_writer.wait();
+    }
+    if ( output_writer.get_depth() > 0 ){
+        string report = output_writer.report();
+        get_output() << endl << report << endl;
+        logger() << report << std::endl;
+    }
 
-    write_file(bathymetry_name, output_path, true);
+    if ( memory_report ){
+        report_memory ( "memory of the hydrosphere at the end of time slice " + std::to_string ( Ma ) + " Ma" );
+    }
 
     //  final remarks
-    cout << endl << "***** end of the Hydrosphere General Circulation Modell ( OGCM ) *****" << endl << endl;
+    get_output() << endl << "***** end of the Hydrosphere General Circulation Modell ( OGCM ) *****" << endl << endl;
+
+    if ( emin <= epsres )        get_output() << "***** steady solution reached! *****" << endl;
+
+    slice_trace.end();
+    TraceRecorder::flush();
+}
+
+
+AtomUtils::Checkpoint cHydrosphereModel::restart_checkpoint()
+{
+    Checkpoint checkpoint ( "hyd", im, jm, km );
+    checkpoint.add ( "h", h );
+    checkpoint.add ( "t", t );
+    checkpoint.add ( "u", u );
+    checkpoint.add ( "v", v );
+    checkpoint.add ( "w", w );
+    checkpoint.add ( "c", c );
+    checkpoint.add ( "tn", tn );
+    checkpoint.add ( "un", un );
+    checkpoint.add ( "vn", vn );
+    checkpoint.add ( "wn", wn );
+    checkpoint.add ( "cn", cn );
+    checkpoint.add ( "p_dyn", p_dyn );
+    checkpoint.add ( "p_dynn", p_dynn );
+    checkpoint.add ( "p_stat", p_stat );
+    checkpoint.add ( "rhs_t", rhs_t );
+    checkpoint.add ( "rhs_u", rhs_u );
+    checkpoint.add ( "rhs_v", rhs_v );
+    checkpoint.add ( "rhs_w", rhs_w );
+    checkpoint.add ( "rhs_c", rhs_c );
+    checkpoint.add ( "aux_u", aux_u );
+    checkpoint.add ( "aux_v", aux_v );
+    checkpoint.add ( "aux_w", aux_w );
+    checkpoint.add ( "Salt_Finger", Salt_Finger );
+    checkpoint.add ( "Salt_Diffusion", Salt_Diffusion );
+    checkpoint.add ( "Salt_Balance", Salt_Balance );
+    checkpoint.add ( "r_water", r_water );
+    checkpoint.add ( "r_salt_water", r_salt_water );
+    checkpoint.add ( "BuoyancyForce_3D", BuoyancyForce_3D );
+    checkpoint.add ( "Bathymetry", Bathymetry );
+    checkpoint.add ( "Upwelling", Upwelling );
+    checkpoint.add ( "Downwelling", Downwelling );
+    checkpoint.add ( "BottomWater", BottomWater );
+    checkpoint.add ( "SaltFinger", SaltFinger );
+    checkpoint.add ( "SaltDiffusion", SaltDiffusion );
+    checkpoint.add ( "Salt_total", Salt_total );
+    checkpoint.add ( "BuoyancyForce_2D", BuoyancyForce_2D );
+    checkpoint.add ( "Evaporation_Dalton", Evaporation_Dalton );
+    checkpoint.add ( "Precipitation", Precipitation );
+    return checkpoint;
+}
+
+
+std::size_t cHydrosphereModel::slice_bytes()
+{
+    std::vector<std::pair<std::string, std::size_t> > fields = restart_checkpoint().field_bytes();
+    std::size_t bytes = 0;
+    for ( size_t n = 0; n < fields.size(); n++ )  bytes += fields[ n ].second;
+
+    //  each queued snapshot of the output writer holds a copy of its fields
+    std::vector<Array*> fields_3d;
+    std::vector<Array_2D*> fields_2d;
+    snapshot_fields ( fields_3d, fields_2d );
+    std::size_t snapshot = 0;
+    for ( size_t n = 0; n < fields_3d.size(); n++ )  snapshot += fields_3d[ n ]->bytes();
+    for ( size_t n = 0; n < fields_2d.size(); n++ )  snapshot += fields_2d[ n ]->bytes();
+    return bytes + std::size_t ( std::max ( output_queue_depth, 0 ) ) * snapshot;
+}
+
+
+void cHydrosphereModel::report_memory ( const std::string &title )
+{
+    string report = MemoryAccount::report ( title, restart_checkpoint().field_bytes() );
+    get_output() << endl << report << endl;
+    logger() << report << std::endl;
+}
+
 
-    if ( emin <= epsres )        cout << "***** steady solution reached! *****" << endl;
+std::string cHydrosphereModel::restart_file ( int Ma ) const
+{
+    return output_path + "/" + std::to_string ( Ma ) + "Ma_hyd.restart";
+}
+
+
+void cHydrosphereModel::write_restart ( int Ma, int pressure_iter, int velocity_iter, double emin, 
+                                        const ConvergenceControl &convergence )
+{
+    std::map<std::string, double> state;
+    state[ "iter_cnt" ] = iter_cnt;
+    state[ "emin" ] = emin;
+    state[ "pressure_iter" ] = pressure_iter;
+    state[ "velocity_iter" ] = velocity_iter;
+    convergence.save ( state );
+
+    restart_checkpoint().write ( restart_file ( Ma ), Ma, state );
+    logger() << "restart file " << restart_file ( Ma ) << " written at n = " << iter_cnt << std::endl;
+}
+
+
+bool cHydrosphereModel::depends_on_previous_slice ( int Ma ) const
+{
+    // the surface salinity of a time slice is reconstructed from the results of the preceding slice
+    return Ma != 0 && use_earthbyte_reconstruction;
+}
+
+
+void cHydrosphereModel::run_slice_farm ( const std::vector<int> &slices )
+{
+    //  the memory of a time slice as allocated by the models of the workers
+    std::size_t slice_memory;
+    {
+        cHydrosphereModel model;
+        model.CopyConfig ( *this );
+        model.reset_arrays();
+        slice_memory = model.slice_bytes();
+    }
+
+    SliceFarm farm ( slice_concurrency, memory_budget, slice_memory );
+
+    get_output() << " time slice farm: " << slices.size() << " time slices on " << farm.workers() << " workers of "
+        << farm.threads() << " threads, " << slice_memory / ( 1024 * 1024 ) << " MB per time slice" << endl << endl;
+
+    farm.run ( slices,
+        [ this ] ( int Ma ){ return depends_on_previous_slice ( Ma ); },
+        [ this ] ( int Ma, std::ostream &out ){
+            cHydrosphereModel model;
+            model.CopyConfig ( *this );
+            model.output_buffer.set_target ( out.rdbuf() );
+            model.log_file = log_file + "." + std::to_string ( Ma );
+            model.RunTimeSlice ( Ma );
+        } );
 }
 
 
@@ -695,9 +1035,11 @@ void cHydrosphereModel::reset_arrays()
 
 void cHydrosphereModel::Run() 
 {
+    StreamScope stream_scope ( output_stream, log_stream(), log_level() );
+
     mkdir(output_path.c_str(), 0777);
 
-    cout << "Output is being written to " << output_path << "\n";
+    get_output() << "Output is being written to " << output_path << "\n";
 
     // write out the config for reproducibility
     // disabled for now
@@ -707,67 +1049,121 @@ void cHydrosphereModel::Run()
 
 
     if (verbose) {
-        cout << endl << endl << endl;
-        cout << "***** Hydrosphere General Circulation Model ( OGCM ) applied to laminar flow" << endl;
-        cout << "***** program for the computation of geo-atmospherical circulating flows in a spherical shell" << endl;
-        cout << "***** finite difference scheme for the solution of the 3D Navier-Stokes equations" << endl;
-        cout << "***** with 1 additional transport equations to describe the salinity" << endl;
-        cout << "***** 4th order Runge-Kutta scheme to solve 2nd order differential equations inside an inner iterational loop" << endl;
-        cout << "***** Poisson equation for the pressure solution in an outer iterational loop" << endl;
-        cout << "***** multi-layer and two-layer radiation model for the computation of the surface temperature" << endl;
-        cout << "***** temperature distribution given as a parabolic distribution from pole to pole, zonaly constant" << endl;
-        cout << "***** salinity is part of the Boussinesq approximation" << endl;
-        cout << "***** code developed by Roger Grundmann, Zum Marktsteig 1, D-01728 Bannewitz ( roger.grundmann@web.de )" << endl << endl;
-
-        cout << "***** original program name:  " << __FILE__ << endl;
-        cout << "***** compiled:  " << __DATE__  << "  at time:  " << __TIME__ << endl << endl;
+        get_output() << endl << endl << endl;
+        get_output() << "***** Hydrosphere General Circulation Model ( OGCM ) applied to laminar flow" << endl;
+        get_output() << "***** program for the computation of geo-atmospherical circulating flows in a spherical shell" << endl;
+        get_output() << "***** finite difference scheme for the solution of the 3D Navier-Stokes equations" << endl;
+        get_output() << "***** with 1 additional transport equations to describe the salinity" << endl;
+        get_output() << "***** 4th order Runge-Kutta scheme to solve 2nd order differential equations inside an inner iterational loop" << endl;
+        get_output() << "***** Poisson equation for the pressure solution in an outer iterational loop" << endl;
+        get_output() << "***** multi-layer and two-layer radiation model for the computation of the surface temperature" << endl;
+        get_output() << "***** temperature distribution given as a parabolic distribution from pole to pole, zonaly constant" << endl;
+        get_output() << "***** salinity is part of the Boussinesq approximation" << endl;
+        get_output() << "***** code developed by Roger Grundmann, Zum Marktsteig 1, D-01728 Bannewitz ( roger.grundmann@web.de )" << endl << endl;
+
+        get_output() << "***** original program name:  " << __FILE__ << endl;
+        get_output() << "***** compiled:  " << __DATE__  << "  at time:  " << __TIME__ << endl << endl;
     }
 
 
+    std::vector<int> slices;
     for(int i = time_start; i <= time_end; i+=time_step)
     {
-        RunTimeSlice(i);
+        slices.push_back(i);
+    }
+
+    if ( slice_concurrency > 1 && slices.size() > 1 ){
+        run_slice_farm ( slices );
+    }else{
+        for ( size_t s = 0; s < slices.size(); s++ )
+        {
+            RunTimeSlice ( slices[ s ] );
+        }
     }
 
     //  final remarks
-    cout << endl << "***** end of the Hydrosphere General Circulation Modell ( OGCM ) *****" << endl << endl;
-    cout << endl;
-    cout << "***** end of object oriented C++ program for the computation of 3D-hydrospheric circulation *****";
-    cout << "\n\n\n\n";
+    get_output() << endl << "***** end of the Hydrosphere General Circulation Modell ( OGCM ) *****" << endl << endl;
+    get_output() << endl;
+    get_output() << "***** end of object oriented C++ program for the computation of 3D-hydrospheric circulation *****";
+    get_output() << "\n\n\n\n";
 }
 
 void cHydrosphereModel::write_file( std::string &bathymetry_name, string& filepath, bool is_final_result)
+{
+    int n = iter_cnt-1;
+
+    //  the output writer writes the files from copies of the fields while the computation continues
+    std::shared_ptr<OutputSnapshot> snapshot = std::make_shared<OutputSnapshot>();
+    if ( output_writer.get_depth() > 0 ){
+        std::vector<Array*> fields_3d;
+        std::vector<Array_2D*> fields_2d;
+        snapshot_fields ( fields_3d, fields_2d );
+        snapshot->take ( fields_3d, fields_2d );
+    }
+    output_writer.submit ( [ this, snapshot, bathymetry_name, filepath, n, is_final_result ] ( ){
+        write_results ( *snapshot, bathymetry_name, filepath, n, is_final_result );
+    } );
+}
+
+void cHydrosphereModel::snapshot_fields ( std::vector<Array*> &fields_3d, std::vector<Array_2D*> &fields_2d )
+{
+    //  only the fields of the files which are written, the PlotData file needs a few
+    fields_3d = { &h, &t, &v, &w, &c };
+    fields_2d = { &Upwelling, &Downwelling, &BottomWater };
+    if ( paraview_output || paraview_panorama_vts ){
+        fields_3d.insert ( fields_3d.end(), 
+            { &p_dyn, &p_stat, &r_water, &r_salt_water, &u, &aux_u, &aux_v, &aux_w, &Salt_Finger, 
+              &Salt_Diffusion, &BuoyancyForce_3D, &Salt_Balance } );
+        fields_2d.insert ( fields_2d.end(), 
+            { &SaltFinger, &SaltDiffusion, &BuoyancyForce_2D, &Evaporation_Dalton, &Precipitation, &Bathymetry } );
+    }
+}
+
+
+void cHydrosphereModel::write_results ( const OutputSnapshot &f, std::string bathymetry_name, std::string filepath,
+                                        int n, bool is_final_result )
 {
     //  printout in ParaView and plot files
     //  class PostProcess_Hydrosphaere for the printing of results
-    PostProcess_Hydrosphere     write_File ( im, jm, km, filepath );
-
-    int j_longal = 75;
-    //  int j_longal = 90;
-    write_File.paraview_vtk_longal ( bathymetry_name, j_longal, iter_cnt-1, u_0, r_0_water, h, p_dyn, p_stat, r_water, 
-        r_salt_water, t, u, v, w, c, aux_u, aux_v, Salt_Finger, Salt_Diffusion, BuoyancyForce_3D, Salt_Balance );
-
-    //  zonal data along constant longitudes
-    int k_zonal = 185;
-    //  int k_zonal = 140;
-    write_File.paraview_vtk_zonal ( bathymetry_name, k_zonal, iter_cnt-1, u_0, r_0_water, h, p_dyn, p_stat, r_water, r_salt_water, 
-            t, u, v, w, c, Salt_Finger, Salt_Diffusion, BuoyancyForce_3D, Salt_Balance );
-
-    //  radial data along constant hight above ground
-    int i_radial = 40;
-    //  int i_radial = 39;
-    write_File.paraview_vtk_radial ( bathymetry_name, i_radial, iter_cnt-1, u_0, t_0, r_0_water, h, p_dyn, p_stat, r_water, 
-        r_salt_water, t, u, v, w, c, aux_u, aux_v, Salt_Finger, Salt_Diffusion, BuoyancyForce_3D, Salt_Balance, 
-        Upwelling, Downwelling, SaltFinger, SaltDiffusion, BuoyancyForce_2D, BottomWater, Evaporation_Dalton, 
-        Precipitation, Bathymetry );
+    PostProcess_Hydrosphere     write_File ( im, jm, km, filepath, vtk_format, vtk_float64 );
+
+    if ( paraview_output ){
+        //  longitudinal data along constant latitudes
+        int j_longal = 75;
+        //  int j_longal = 90;
+        write_File.paraview_vtk_longal ( bathymetry_name, j_longal, n, u_0, r_0_water, f ( h ), f ( p_dyn ), f ( p_stat ),
+                                         f ( r_water ), f ( r_salt_water ), f ( t ), f ( u ), f ( v ), f ( w ), f ( c ),
+                                         f ( aux_u ), f ( aux_v ), f ( Salt_Finger ), f ( Salt_Diffusion ),
+                                         f ( BuoyancyForce_3D ), f ( Salt_Balance ) );
+
+        //  zonal data along constant longitudes
+        int k_zonal = 185;
+        //  int k_zonal = 140;
+        write_File.paraview_vtk_zonal ( bathymetry_name, k_zonal, n, u_0, r_0_water, f ( h ), f ( p_dyn ), f ( p_stat ),
+                                        f ( r_water ), f ( r_salt_water ), f ( t ), f ( u ), f ( v ), f ( w ), f ( c ),
+                                        f ( Salt_Finger ), f ( Salt_Diffusion ), f ( BuoyancyForce_3D ), f ( Salt_Balance ) );
+
+        //  radial data along constant hight above ground
+        int i_radial = 40;
+        //  int i_radial = 39;
+        write_File.paraview_vtk_radial ( bathymetry_name, i_radial, n, u_0, t_0, r_0_water, f ( h ), f ( p_dyn ),
+                                         f ( p_stat ), f ( r_water ), f ( r_salt_water ), f ( t ), f ( u ), f ( v ),
+                                         f ( w ), f ( c ), f ( aux_u ), f ( aux_v ), f ( Salt_Finger ),
+                                         f ( Salt_Diffusion ), f ( BuoyancyForce_3D ), f ( Salt_Balance ), f ( Upwelling ),
+                                         f ( Downwelling ), f ( SaltFinger ), f ( SaltDiffusion ), f ( BuoyancyForce_2D ),
+                                         f ( BottomWater ), f ( Evaporation_Dalton ), f ( Precipitation ), f ( Bathymetry ) );
+    }
 
     //  3-dimensional data in cartesian coordinate system for a streamline pattern in panorama view
     if(paraview_panorama_vts){
-        write_File.paraview_panorama_vts ( bathymetry_name, iter_cnt-1, u_0, r_0_water, h, t, p_dyn, p_stat, r_water, r_salt_water, 
-            u, v, w, c, aux_u, aux_v, aux_w, Salt_Finger, Salt_Diffusion, BuoyancyForce_3D, Salt_Balance );
+        write_File.paraview_panorama_vts ( bathymetry_name, n, u_0, r_0_water, f ( h ), f ( t ), f ( p_dyn ),
+                                           f ( p_stat ), f ( r_water ), f ( r_salt_water ), f ( u ), f ( v ), f ( w ),
+                                           f ( c ), f ( aux_u ), f ( aux_v ), f ( aux_w ), f ( Salt_Finger ),
+                                           f ( Salt_Diffusion ), f ( BuoyancyForce_3D ), f ( Salt_Balance ) );
     }
     //  writing of plot data in the PlotData file
     PostProcess_Hydrosphere     ppa ( im, jm, km, output_path );
-    ppa.Hydrosphere_PlotData ( bathymetry_name, (is_final_result ? -1 : iter_cnt-1), u_0, h, v, w, t, c, BottomWater, Upwelling, Downwelling );
+    ppa.Hydrosphere_PlotData ( bathymetry_name, (is_final_result ? -1 : n), u_0, f ( h ), f ( v ), f ( w ), f ( t ),
+                               f ( c ), f ( BottomWater ), f ( Upwelling ), f ( Downwelling ) );
 
 }
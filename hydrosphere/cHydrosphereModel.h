@@ -3,15 +3,26 @@
 
 #include <string>
 #include <vector>
+#include <fstream>
 
 #include "Array.h"
 #include "Array_1D.h"
 #include "Array_2D.h"
 #include "tinyxml2.h"
+#include "PythonStream.h"
+#include "SurfaceTransfer.h"
+#include "OutputWriter.h"
+#include "Checkpoint.h"
+#include "PhaseTimer.h"
+#include "Logger.h"
 
 using namespace std;
 using namespace tinyxml2;
 
+namespace AtomUtils{
+    class ConvergenceControl;
+}
+
 class cHydrosphereModel{
 public:
 
@@ -23,12 +34,37 @@ public:
     void Run();
     void RunTimeSlice(int time_slice);
 
+    // surface fields of an atmosphere in the same process, used instead of the transfer file for the same time slice
+    void SetSurfaceTransfer(const AtomUtils::SurfaceTransfer &transfer){
+        surface_transfer = transfer;
+    }
+
     #include "HydrosphereParams.h.inc"
 
 private:
     void SetDefaultConfig();
+    void CopyConfig(const cHydrosphereModel &model);
     void reset_arrays();
     void write_file( std::string &bathymetry_name, string& filepath, bool is_final_result = false);
+    void snapshot_fields( std::vector<Array*> &fields_3d, std::vector<Array_2D*> &fields_2d );
+    void write_results( const AtomUtils::OutputSnapshot &f, std::string bathymetry_name, std::string filepath,
+                        int n, bool is_final_result );
+
+    bool depends_on_previous_slice( int Ma ) const;
+    void run_slice_farm( const std::vector<int> &slices );
+
+    AtomUtils::Checkpoint restart_checkpoint();
+    std::string restart_file( int Ma ) const;
+    void write_restart( int Ma, int pressure_iter, int velocity_iter, double emin, 
+                        const AtomUtils::ConvergenceControl &convergence );
+
+    // the bytes of a time slice with the snapshots of the output writer
+    std::size_t slice_bytes();
+    void report_memory( const std::string &title );
+
+    // opens log_file if it changed and applies log_flush_interval to the stream buffers
+    std::ostream& log_stream();
+    AtomUtils::LogLevel log_level() const;
 
     const int im = 41, jm = 181, km = 361, nm = 200;
 
@@ -36,6 +72,8 @@ private:
 
     std::vector<Array*> old_arrays_3d, new_arrays_3d, old_arrays_2d, new_arrays_2d;
 
+    AtomUtils::SurfaceTransfer surface_transfer;
+
     // 1D arrays
     Array_1D rad; // radial coordinate direction
     Array_1D the; // lateral coordinate direction
@@ -94,5 +132,21 @@ private:
     Array r_water; // water density as function of pressure
     Array r_salt_water; // salt water density as function of pressure and temperature
     Array BuoyancyForce_3D; // 3D buoyancy force
+
+    // time spent in the phases of the 3D iterations of the running time slice
+    AtomUtils::PhaseProfile phase_profile;
+
+    // output and log file of this model instance, bound to the running thread by the public entry points
+    // through buffers which pass the text on every log_flush_interval seconds and at the end of each call
+    PythonStream ps;
+    AtomUtils::BufferedStreambuf output_buffer;
+    std::ostream output_stream;
+    std::ofstream log_file_stream;
+    AtomUtils::BufferedStreambuf log_buffer;
+    std::ostream log_output;
+    std::string log_file_name;
+
+    // writes the result files in the background, declared last to finish before the fields are destroyed
+    AtomUtils::OutputWriter output_writer;
 };
 #endif
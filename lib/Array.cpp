@@ -23,14 +23,18 @@ using namespace AtomUtils;
 #define MAXJ 181
 #define MAXK 361
 
-Array::Array(int idim, int jdim, int kdim, double val):
+template <typename T>
+Array_T<T>::Array_T(int idim, int jdim, int kdim, double val):
     x(NULL) 
 {
     initArray(idim, jdim, kdim, val);
 }
 
-Array::~Array ( )
+template <typename T>
+Array_T<T>::~Array_T ( )
 {
+    AtomUtils::MemoryAccount::release ( bytes() );
+
     for ( int i = 0; i < im; i++ )
     {
         for ( int j = 0; j < jm; j++ )
@@ -48,7 +52,8 @@ Array::~Array ( )
 }
 
 
-void Array::initArray ( int im, int jm, int km, double aa )
+template <typename T>
+void Array_T<T>::initArray ( int im, int jm, int km, double aa )
 {
     if(x){
         assert(im == this->im);
@@ -74,15 +79,16 @@ void Array::initArray ( int im, int jm, int km, double aa )
         this->jm = jm;
         this->km = km;
 
-        x = new double**[im];
+        x = new T**[im];
+        AtomUtils::MemoryAccount::allocate ( bytes() );
 
         for ( int i = 0; i < im; i++ )
         {
-            x[ i ] = new double*[jm];
+            x[ i ] = new T*[jm];
 
             for ( int j = 0; j < jm; j++ )
             {
-                x[ i ][ j ] = new double[km];
+                x[ i ][ j ] = new T[km];
                 for ( int k = 0; k < km; k++ )
                 {
                     x[ i ][ j ][ k ] = aa;
@@ -93,22 +99,23 @@ void Array::initArray ( int im, int jm, int km, double aa )
 }
 
 
-void Array::printArray ( int im, int jm, int km )
+template <typename T>
+void Array_T<T>::printArray ( int im, int jm, int km )
 {
     assert(im == this->im);
     assert(jm == this->jm);
     assert(km == this->km);
 
-    cout.precision ( 3 );
-    cout.setf ( ios::fixed );
+    get_output().precision ( 3 );
+    get_output().setf ( ios::fixed );
 
 //      for ( int i = 0; i < im; i++ )
       for ( int i = 0; i <= 0; i++ )
     {
-//        cout << "i = " << i << "   " << "im = " << im << "   " << "( transfer test of x in 'print_Array()' )" << endl;
-//        cout << endl;
-//        cout << "  phi = k-direction ======>  theta = j-direction downwards :::::::::: r-level = " << i << endl;
-        cout << endl;
+//        get_output() << "i = " << i << "   " << "im = " << im << "   " << "( transfer test of x in 'print_Array()' )" << endl;
+//        get_output() << endl;
+//        get_output() << "  phi = k-direction ======>  theta = j-direction downwards :::::::::: r-level = " << i << endl;
+        get_output() << endl;
 
         for ( int j = 0; j < jm; j+=4 )
 //    for ( int i = 0; i < im ; i++ )
@@ -117,27 +124,29 @@ void Array::printArray ( int im, int jm, int km )
             for ( int k = 0; k < km; k+=20 )
 //            for ( int k = 0; k < km; k++ )
             {
-                cout.width ( 4 );
-                cout.fill( ' ' );
+                get_output().width ( 4 );
+                get_output().fill( ' ' );
 
-//                 cout << x[ i ][ j ][ k ] << " (" << &x[ i ][ j ][ k ] << ")" << " ";
-                cout << x[ i ][ j ][ k ] << " ";
+//                 get_output() << x[ i ][ j ][ k ] << " (" << &x[ i ][ j ][ k ] << ")" << " ";
+                get_output() << x[ i ][ j ][ k ] << " ";
             }
-            cout << endl;
+            get_output() << endl;
         }
-        cout << endl;
+        get_output() << endl;
     }
-    cout << endl;
+    get_output() << endl;
 }
 
-void Array::inspect(const std::string& prefix) const{
+template <typename T>
+void Array_T<T>::inspect(const std::string& prefix) const{
+    if(!log_enabled(LOG_DEBUG)) return;
     std::vector<double> mins(im, 0), maxes(im, 0), means(im, 0), s_means(im, 0);
     for(int i=0; i<im; i++){
         double min_tmp=x[i][0][0], max_tmp=x[i][0][0], mean_tmp=0, s_means_tmp=0, weight_tmp=0;
         for(int j=0; j<jm; j++){
             for(int k=0; k<km; k++){
-                min_tmp=std::min(min_tmp, x[i][j][k]);
-                max_tmp=std::max(max_tmp, x[i][j][k]);
+                min_tmp=std::min(min_tmp, double(x[i][j][k]));
+                max_tmp=std::max(max_tmp, double(x[i][j][k]));
                 mean_tmp+=x[i][j][k];
                 double w=cos(abs(90-j)*M_PI/180.);
                 s_means_tmp+=x[i][j][k]*w;
@@ -177,3 +186,5 @@ void Array::inspect(const std::string& prefix) const{
     logger()<<prefix<<"==================================="<<std::endl;
 }
 
+template class Array_T<double>;
+template class Array_T<float>;
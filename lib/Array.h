@@ -19,52 +19,58 @@
 #include <numeric>
 #include <tuple>
 
+#include "MemoryAccount.h"
+
 using namespace std;
 
-class Array
+// 3D field of im x jm x km values of the element type T, the models compute in Array ( double )
+template <typename T>
+class Array_T
 {
 private:
     int im, jm, km;
 
+    template <typename U> friend class Array_T;
+
 public:
-    double ***x;
+    T ***x;
     
-    Array(int idim, int jdim, int kdim, double val);
-    ~Array ( );
+    Array_T(int idim, int jdim, int kdim, double val);
+    ~Array_T ( );
 
-    Array(): im(0), jm(0), km(0), x(NULL)
+    Array_T(): im(0), jm(0), km(0), x(NULL)
     {}
 
     //copy constructor
-    Array(const Array &a){
-        im = a.im;
-        jm = a.jm;
-        km = a.km;
-
-        x = new double**[im];
-
-        for ( int i = 0; i < im; i++ )
-        {
-            x[ i ] = new double*[jm];
-
-            for ( int j = 0; j < jm; j++ )
-            {
-                x[ i ][ j ] = new double[km];
-                for ( int k = 0; k < km; k++ )
-                {
-                    x[ i ][ j ][ k ] = a.x[i][j][k];
-                }
-            }
-        }
+    Array_T(const Array_T &a): im(0), jm(0), km(0), x(NULL){
+        if(a.x)  assign(a);
+    }
+
+    //copy of a field of another element type, rounded to the precision of T
+    template <typename U>
+    explicit Array_T(const Array_T<U> &a): im(0), jm(0), km(0), x(NULL){
+        if(a.x)  assign(a);
+    }
+
+    bool is_allocated() const{
+        return x != NULL;
+    }
+
+    // memory of the values and the row pointers
+    std::size_t bytes() const{
+        return x ? std::size_t ( im ) * ( std::size_t ( jm ) * ( km * sizeof ( T ) + sizeof ( T* ) )
+                                          + sizeof ( T** ) ) : 0;
     }
 
     void printArray( int im, int jm, int km );
     void initArray( int im, int jm, int km, double value);
 
-    friend Array operator* (double coeff, const Array &a);
+    template <typename U>
+    friend Array_T<U> operator* (double coeff, const Array_T<U> &a);
 
-    //overload 
-    void operator=(const Array &a){
+    //copies the values of a, allocates the field if needed
+    template <typename U>
+    void assign(const Array_T<U> &a){
         if(!x){
             initArray(a.im, a.jm, a.km, 0);
         }
@@ -74,15 +80,20 @@ public:
         for(int i=0; i<im; i++){
             for(int j=0; j<jm; j++){
                 for(int k=0; k<km; k++){
-                    this->x[i][j][k]=a.x[i][j][k];
+                    this->x[i][j][k]=T(a.x[i][j][k]);
                 }
             }
         }
     }
 
+    //overload 
+    void operator=(const Array_T &a){
+        assign(a);
+    }
+
     //overload
-    Array operator+(double val){
-        Array ret(im, jm, km, 0.);
+    Array_T operator+(double val){
+        Array_T ret(im, jm, km, 0.);
         for(int i=0; i<im; i++){
             for(int j=0; j<jm; j++){
                 for(int k=0; k<km; k++){
@@ -94,18 +105,18 @@ public:
     }
 
     //overload
-    Array operator-(double val){
+    Array_T operator-(double val){
         return operator+(-val);
     }
 
     //overload
-    Array operator*(double val){
+    Array_T operator*(double val){
         return val*(*this);
     }
 
-    double max() const{
+    T max() const{
         assert(im && jm && km);
-        double ret=x[0][0][0];
+        T ret=x[0][0][0];
         for(int i=0; i<im; i++){
             for(int j=0; j<jm; j++){
                 for(int k=0; k<km; k++){
@@ -116,9 +127,9 @@ public:
         return ret;
     }
 
-    double min() const{
+    T min() const{
         assert(im && jm && km);
-        double ret=x[0][0][0];
+        T ret=x[0][0][0];
         for(int i=0; i<im; i++){
             for(int j=0; j<jm; j++){
                 for(int k=0; k<km; k++){
@@ -142,9 +153,9 @@ public:
         return ret/(im*jm*km);
     }
 
-    double max_2D() const{
+    T max_2D() const{
         assert(jm && km);
-        double ret=x[0][0][0];
+        T ret=x[0][0][0];
         for(int j=0; j<jm; j++){
             for(int k=0; k<km; k++){
                 ret=std::max(ret, x[0][j][k]);
@@ -153,9 +164,9 @@ public:
         return ret;
     }
 
-    double min_2D() const{
+    T min_2D() const{
         assert(jm && km);
-        double ret=x[0][0][0];
+        T ret=x[0][0][0];
         for(int j=0; j<jm; j++){
             for(int k=0; k<km; k++){
                 ret=std::min(ret, x[0][j][k]);
@@ -194,8 +205,9 @@ public:
     void inspect(const std::string& prefix="") const;
 };
 
-inline Array operator* (double coeff, const Array &a){
-    Array ret(a.im,a.jm,a.km, 0.);
+template <typename T>
+inline Array_T<T> operator* (double coeff, const Array_T<T> &a){
+    Array_T<T> ret(a.im,a.jm,a.km, 0.);
     for(int i=0; i<a.im; i++){
         for(int j=0; j<a.jm; j++){
             for(int k=0; k<a.km; k++){
@@ -206,6 +218,8 @@ inline Array operator* (double coeff, const Array &a){
     return ret;
 }
 
+typedef Array_T<double> Array;
+
 template <typename T = double>
 class Vector3D {
 public:
@@ -213,6 +227,10 @@ public:
         m_i(i), m_j(j), m_k(k), m_data((!i?1:i)*j*k, t)
     {}
 
+    std::size_t bytes() const{
+        return m_data.capacity() * sizeof ( T );
+    }
+
     //https://en.cppreference.com/w/cpp/language/operators
     //To provide multidimensional array access semantics, e.g. to implement a 3D array access a[i][j][k] = x;, 
     //operator[] has to return a reference to a 2D plane, which has to have its own operator[] which returns 
@@ -273,7 +291,7 @@ public:
 
 private:
     size_t m_i, m_j, m_k;
-    std::vector<T> m_data;
+    std::vector<T, AtomUtils::TrackedAllocator<T> > m_data;
 };
 
 #endif
@@ -12,6 +12,7 @@
 #include <iostream>
 
 #include "Array_1D.h"
+#include "Utils.h"
 
 using namespace std;
 
@@ -68,20 +69,20 @@ void Array_1D::printArray_1D( int mm )
 {
     assert(mm == this->mm); // FIXME: just until we remove mm throughout
 
-    cout.precision ( 6 );
-    cout.setf ( ios::fixed );
+    AtomUtils::get_output().precision ( 6 );
+    AtomUtils::get_output().setf ( ios::fixed );
 
-    cout << endl;
-    cout << " coordinate-direction " << endl;
-    cout << endl;
+    AtomUtils::get_output() << endl;
+    AtomUtils::get_output() << " coordinate-direction " << endl;
+    AtomUtils::get_output() << endl;
 
     for ( int i = 0; i < mm; i++ )
     {
-        cout.width ( 6 );
-        cout.fill( ' ' );
+        AtomUtils::get_output().width ( 6 );
+        AtomUtils::get_output().fill( ' ' );
 
-//        cout << z[ i ] << " (" << &z[ i ] << ")" << " ";
-        cout << z[ i ] << " ";
+//        AtomUtils::get_output() << z[ i ] << " (" << &z[ i ] << ")" << " ";
+        AtomUtils::get_output() << z[ i ] << " ";
     }
-    cout << endl;
+    AtomUtils::get_output() << endl;
 }
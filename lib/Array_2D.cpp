@@ -12,6 +12,7 @@
 #include <iostream>
 
 #include "Array_2D.h"
+#include "Utils.h"
 
 using namespace std;
 
@@ -25,6 +26,8 @@ Array_2D::Array_2D(int jdim, int kdim, double val) : y(NULL) {
 
 Array_2D::~Array_2D ( )
 {
+    AtomUtils::MemoryAccount::release ( bytes() );
+
     for ( int j = 0; j < jm; j++ )
     {
         delete [  ] y[ j ];
@@ -42,6 +45,7 @@ void Array_2D::initArray_2D ( int jm, int km, double bb )
         this->km = km;
 
         y = new double*[jm];
+        AtomUtils::MemoryAccount::allocate ( bytes() );
 
         for ( int j = 0; j < jm; j++ )
         {
@@ -69,12 +73,12 @@ void Array_2D::printArray_2D ( int jm, int km )
     assert(jm == this->jm);
     assert(km == this->km);
 
-    cout.precision ( 3 );
-    cout.setf ( ios::fixed );
+    AtomUtils::get_output().precision ( 3 );
+    AtomUtils::get_output().setf ( ios::fixed );
 
-    cout << endl;
-    cout << "  phi = k-direction ======>  theta = j-direction downwards :::::::::: r-level " << endl;
-    cout << endl;
+    AtomUtils::get_output() << endl;
+    AtomUtils::get_output() << "  phi = k-direction ======>  theta = j-direction downwards :::::::::: r-level " << endl;
+    AtomUtils::get_output() << endl;
 
     for ( int j = 0; j < jm; j+=4 )
 //    for ( int j = 0; j < jm; j++ )
@@ -82,13 +86,13 @@ void Array_2D::printArray_2D ( int jm, int km )
         for ( int k = 0; k < km; k+=20 )
 //        for ( int k = 0; k < km; k++ )
         {
-            cout.width ( 4 );
-            cout.fill( ' ' );
+            AtomUtils::get_output().width ( 4 );
+            AtomUtils::get_output().fill( ' ' );
 
-//             cout << y[ j ][ k ] << " (" << &y[ j ][ k ] << ")" << " ";
-            cout << y[ j ][ k ] << " ";
+//             AtomUtils::get_output() << y[ j ][ k ] << " (" << &y[ j ][ k ] << ")" << " ";
+            AtomUtils::get_output() << y[ j ][ k ] << " ";
         }
-    cout << endl;
+    AtomUtils::get_output() << endl;
     }
-    cout << endl;
+    AtomUtils::get_output() << endl;
 }
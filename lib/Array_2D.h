@@ -12,6 +12,9 @@
 #define _ARRAY_2D_
 
 #include <iostream>
+#include <cassert>
+
+#include "MemoryAccount.h"
 
 using namespace std;
 
@@ -28,6 +31,31 @@ public:
 
     Array_2D(): jm(0), km(0), y(NULL){}
 
+    //copy constructor
+    Array_2D(const Array_2D &a): jm(0), km(0), y(NULL){
+        if(a.y)  *this = a;
+    }
+
+    // memory of the values and the row pointers
+    std::size_t bytes() const{
+        return y ? std::size_t ( jm ) * ( km * sizeof ( double ) + sizeof ( double* ) ) : 0;
+    }
+
+    //copies the values of a, allocates the field if needed, as Array::operator=
+    Array_2D& operator=(const Array_2D &a){
+        if(!y){
+            initArray_2D(a.jm, a.km, 0);
+        }
+        assert(this->jm == a.jm);
+        assert(this->km == a.km);
+        for(int j=0; j<jm; j++){
+            for(int k=0; k<km; k++){
+                this->y[j][k]=a.y[j][k];
+            }
+        }
+        return *this;
+    }
+
     void printArray_2D ( int, int );
     void initArray_2D ( int, int, double );
 };
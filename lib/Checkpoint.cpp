@@ -0,0 +1,273 @@
+#include <atomic>
+#include <chrono>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <thread>
+
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <Checkpoint.h>
+#include <TraceRecorder.h>
+#include <Utils.h>
+
+using namespace AtomUtils;
+
+const std::uint32_t Checkpoint::version = 1;
+
+namespace{
+    // layout: Header, n_scalars Scalar, n_fields Field, then the values of the fields in the order of the Field entries,
+    // a 2D field has im = 0
+    const char restart_magic[ 8 ] = { 'A', 'T', 'O', 'M', 'R', 'S', 'T', 'F' };
+
+    struct Header{
+        char magic[ 8 ];
+        std::uint32_t version;
+        char model[ 8 ];
+        std::int32_t Ma;
+        std::uint32_t n_scalars, n_fields;
+    };
+
+    struct Scalar{
+        char name[ 56 ];
+        double value;
+    };
+
+    struct Field{
+        char name[ 52 ];
+        std::uint32_t im, jm, km;
+    };
+
+    volatile std::sig_atomic_t stop_signal = 0;
+    std::atomic<int> running_loops ( 0 );
+    void ( * volatile drain_hook ) ( ) = nullptr;
+
+    void on_signal ( int signal ){
+        stop_signal = signal;
+        if ( running_loops.load ( ) == 0 ){
+            if ( drain_hook )  drain_hook ( );
+            _exit ( 128 + signal );
+        }
+    }
+
+    // passes on the text buffered by the calling thread before the process ends
+    void flush_all ( ){
+        if ( drain_hook )  drain_hook ( );
+        TraceRecorder::flush ( );
+        std::cout.flush ( );
+        std::cerr.flush ( );
+    }
+
+    template<class T>
+    void copy_name ( T &entry, const std::string &name ){
+        std::memset ( entry.name, 0, sizeof ( entry.name ) );
+        std::strncpy ( entry.name, name.c_str ( ), sizeof ( entry.name ) - 1 );
+    }
+
+    void write_or_abort ( std::FILE *f, const void *data, std::size_t size, const std::string &path ){
+        if ( std::fwrite ( data, 1, size, f ) != size ){
+            std::cerr << "ERROR: could not write the restart file " << path << "\n";
+            abort();
+        }
+    }
+
+    void read_or_abort ( std::FILE *f, void *data, std::size_t size, const std::string &path ){
+        if ( std::fread ( data, 1, size, f ) != size ){
+            std::cerr << "ERROR: could not read the restart file " << path << "\n";
+            abort();
+        }
+    }
+}
+
+Checkpoint::Checkpoint ( const std::string &model, int im, int jm, int km ) :
+    model ( model ),
+    im ( im ),
+    jm ( jm ),
+    km ( km )
+{}
+
+void Checkpoint::add ( const std::string &name, Array &field ){
+    fields_3d.push_back ( std::make_pair ( name, &field ) );
+}
+
+void Checkpoint::add ( const std::string &name, Array_2D &field ){
+    fields_2d.push_back ( std::make_pair ( name, &field ) );
+}
+
+void Checkpoint::write ( const std::string &path, int Ma, const std::map<std::string, double> &scalars ) const{
+    Header header;
+    std::memcpy ( header.magic, restart_magic, sizeof ( header.magic ) );
+    header.version = version;
+    std::memset ( header.model, 0, sizeof ( header.model ) );
+    std::strncpy ( header.model, model.c_str ( ), sizeof ( header.model ) - 1 );
+    header.Ma = Ma;
+    header.n_scalars = scalars.size ( );
+    header.n_fields = fields_3d.size ( ) + fields_2d.size ( );
+
+    std::string temporary = path + ".tmp";
+    std::FILE *f = std::fopen ( temporary.c_str ( ), "wb" );
+    if ( !f ){
+        std::cerr << "ERROR: could not open the restart file " << temporary << "\n";
+        abort();
+    }
+    write_or_abort ( f, &header, sizeof ( header ), temporary );
+    for ( std::map<std::string, double>::const_iterator s = scalars.begin ( ); s != scalars.end ( ); ++s ){
+        Scalar scalar;
+        copy_name ( scalar, s->first );
+        scalar.value = s->second;
+        write_or_abort ( f, &scalar, sizeof ( scalar ), temporary );
+    }
+    for ( std::size_t n = 0; n < fields_3d.size ( ); n++ ){
+        Field field;
+        copy_name ( field, fields_3d[ n ].first );
+        field.im = im;
+        field.jm = jm;
+        field.km = km;
+        write_or_abort ( f, &field, sizeof ( field ), temporary );
+    }
+    for ( std::size_t n = 0; n < fields_2d.size ( ); n++ ){
+        Field field;
+        copy_name ( field, fields_2d[ n ].first );
+        field.im = 0;
+        field.jm = jm;
+        field.km = km;
+        write_or_abort ( f, &field, sizeof ( field ), temporary );
+    }
+    for ( std::size_t n = 0; n < fields_3d.size ( ); n++ ){
+        for ( int i = 0; i < im; i++ ){
+            for ( int j = 0; j < jm; j++ ){
+                write_or_abort ( f, fields_3d[ n ].second->x[ i ][ j ], km * sizeof ( double ), temporary );
+            }
+        }
+    }
+    for ( std::size_t n = 0; n < fields_2d.size ( ); n++ ){
+        for ( int j = 0; j < jm; j++ ){
+            write_or_abort ( f, fields_2d[ n ].second->y[ j ], km * sizeof ( double ), temporary );
+        }
+    }
+
+    // on the disk before the rename, a crash leaves either the old or the new restart file
+    if ( std::fflush ( f ) != 0 || fsync ( fileno ( f ) ) != 0 || std::fclose ( f ) != 0
+         || std::rename ( temporary.c_str ( ), path.c_str ( ) ) != 0 ){
+        std::remove ( temporary.c_str ( ) );
+        std::cerr << "ERROR: could not write the restart file " << path << "\n";
+        abort();
+    }
+}
+
+std::vector<std::pair<std::string, std::size_t> > Checkpoint::field_bytes ( ) const{
+    std::vector<std::pair<std::string, std::size_t> > fields;
+    for ( std::size_t n = 0; n < fields_3d.size ( ); n++ ){
+        fields.push_back ( std::make_pair ( fields_3d[ n ].first, fields_3d[ n ].second->bytes ( ) ) );
+    }
+    for ( std::size_t n = 0; n < fields_2d.size ( ); n++ ){
+        fields.push_back ( std::make_pair ( fields_2d[ n ].first, fields_2d[ n ].second->bytes ( ) ) );
+    }
+    return fields;
+}
+
+bool Checkpoint::read ( const std::string &path, int Ma, std::map<std::string, double> &scalars ) const{
+    std::FILE *f = std::fopen ( path.c_str ( ), "rb" );
+    if ( !f )  return false;
+
+    struct stat info;
+    Header header;
+    std::string reason;
+    std::vector<Scalar> stored_scalars;
+    std::vector<Field> stored_fields;
+    if ( fstat ( fileno ( f ), &info ) != 0 || std::fread ( &header, sizeof ( header ), 1, f ) != 1
+         || std::memcmp ( header.magic, restart_magic, sizeof ( restart_magic ) ) != 0 ){
+        reason = "no restart file";
+    }else if ( header.version != version ){
+        reason = "version " + std::to_string ( header.version ) + " instead of " + std::to_string ( version );
+    }else if ( std::strncmp ( header.model, model.c_str ( ), sizeof ( header.model ) ) != 0 || header.Ma != Ma ){
+        reason = "written for another model or time slice";
+    }else if ( header.n_fields != fields_3d.size ( ) + fields_2d.size ( ) || header.n_scalars > 1000 ){
+        reason = "different fields";
+    }else{
+        stored_scalars.resize ( header.n_scalars );
+        stored_fields.resize ( header.n_fields );
+        if ( std::fread ( stored_scalars.data ( ), sizeof ( Scalar ), header.n_scalars, f ) != header.n_scalars
+             || std::fread ( stored_fields.data ( ), sizeof ( Field ), header.n_fields, f ) != header.n_fields ){
+            reason = "truncated";
+        }
+    }
+    for ( std::size_t n = 0; reason.empty ( ) && n < stored_fields.size ( ); n++ ){
+        const Field &field = stored_fields[ n ];
+        bool is_3d = n < fields_3d.size ( );
+        const std::string &name = is_3d ? fields_3d[ n ].first : fields_2d[ n - fields_3d.size ( ) ].first;
+        if ( std::strncmp ( field.name, name.c_str ( ), sizeof ( field.name ) ) != 0
+             || field.im != ( std::uint32_t ) ( is_3d ? im : 0 ) || field.jm != ( std::uint32_t ) jm
+             || field.km != ( std::uint32_t ) km ){
+            reason = "different fields";
+        }
+    }
+    std::size_t expected = sizeof ( Header ) + stored_scalars.size ( ) * sizeof ( Scalar )
+                           + stored_fields.size ( ) * sizeof ( Field )
+                           + ( fields_3d.size ( ) * im + fields_2d.size ( ) ) * std::size_t ( jm * km ) * sizeof ( double );
+    if ( reason.empty ( ) && ( std::size_t ) info.st_size != expected )  reason = "truncated";
+    if ( !reason.empty ( ) ){
+        std::fclose ( f );
+        logger() << "restart file " << path << " not used: " << reason << std::endl;
+        return false;
+    }
+
+    scalars.clear ( );
+    for ( std::size_t n = 0; n < stored_scalars.size ( ); n++ ){
+        stored_scalars[ n ].name[ sizeof ( stored_scalars[ n ].name ) - 1 ] = 0;
+        scalars[ stored_scalars[ n ].name ] = stored_scalars[ n ].value;
+    }
+    for ( std::size_t n = 0; n < fields_3d.size ( ); n++ ){
+        for ( int i = 0; i < im; i++ ){
+            for ( int j = 0; j < jm; j++ ){
+                read_or_abort ( f, fields_3d[ n ].second->x[ i ][ j ], km * sizeof ( double ), path );
+            }
+        }
+    }
+    for ( std::size_t n = 0; n < fields_2d.size ( ); n++ ){
+        for ( int j = 0; j < jm; j++ ){
+            read_or_abort ( f, fields_2d[ n ].second->y[ j ], km * sizeof ( double ), path );
+        }
+    }
+    std::fclose ( f );
+    return true;
+}
+
+void Checkpoint::catch_signals ( ){
+    struct sigaction action;
+    std::memset ( &action, 0, sizeof ( action ) );
+    action.sa_handler = on_signal;
+    sigemptyset ( &action.sa_mask );
+    sigaction ( SIGINT, &action, nullptr );
+    sigaction ( SIGTERM, &action, nullptr );
+}
+
+bool Checkpoint::stop_requested ( ){
+    return stop_signal != 0;
+}
+
+void Checkpoint::set_drain ( void ( *drain ) ( ) ){
+    drain_hook = drain;
+}
+
+void Checkpoint::stop ( ){
+    flush_all ( );
+    if ( --running_loops == 0 )  _exit ( 128 + stop_signal );
+    while ( true )  std::this_thread::sleep_for ( std::chrono::seconds ( 1 ) );
+}
+
+CheckpointScope::CheckpointScope ( bool active ) :
+    active ( active )
+{
+    if ( active )  running_loops++;
+}
+
+CheckpointScope::~CheckpointScope ( ){
+    if ( active && --running_loops == 0 && stop_signal != 0 ){
+        flush_all ( );
+        _exit ( 128 + stop_signal );
+    }
+}
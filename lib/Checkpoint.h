@@ -0,0 +1,78 @@
+/*
+ * Atmosphere General Circulation Modell ( AGCM ) applied to laminar flow
+ * Program for the computation of geo-atmospherical circulating flows in a spherical shell
+ * Finite difference scheme for the solution of the 3D Navier-Stokes equations
+ * with 2 additional transport equations to describe the water vapour and co2 concentration
+ * 4. order Runge-Kutta scheme to solve 2. order differential equations
+ *
+ * class to write and read the restart file of a time slice
+*/
+
+#ifndef _CHECKPOINT_
+#define _CHECKPOINT_
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Array.h"
+#include "Array_2D.h"
+
+namespace AtomUtils{
+    // binary restart file of the 3D iterations of a time slice: the named 3D fields of im x jm x km and 2D fields
+    // of jm x km values registered by add ( ) and named scalars like the iteration counters,
+    // the file is written to a temporary file first and renamed, an interrupted write leaves the last restart file intact,
+    // read ( ) only accepts a file of the same version, model, time slice and fields
+    class Checkpoint{
+        private:
+            std::string model;
+            int im, jm, km;
+            std::vector<std::pair<std::string, Array*> > fields_3d;
+            std::vector<std::pair<std::string, Array_2D*> > fields_2d;
+
+        public:
+            static const std::uint32_t version;
+
+            Checkpoint ( const std::string &model, int im, int jm, int km );
+
+            void add ( const std::string &name, Array &field );
+            void add ( const std::string &name, Array_2D &field );
+
+            void write ( const std::string &path, int Ma, const std::map<std::string, double> &scalars ) const;
+
+            // names and memory of the registered fields
+            std::vector<std::pair<std::string, std::size_t> > field_bytes ( ) const;
+
+            // fills the fields and scalars from path, false with the reason in the log file when the file is
+            // missing or does not match, the fields are only changed when the file matches
+            bool read ( const std::string &path, int Ma, std::map<std::string, double> &scalars ) const;
+
+            // SIGINT and SIGTERM stop the process at once, unless iterations which can write a restart file run,
+            // these notice stop_requested ( ) after their current iteration, write their restart file and call stop ( )
+            static void catch_signals ( );
+            static bool stop_requested ( );
+
+            // drain is called on the thread which ends the process before it does so, to pass on the text it buffers
+            static void set_drain ( void ( *drain ) ( ) );
+
+            // the last running iteration loop to stop ends the process with 128 + signal number,
+            // the others wait for it, never returns
+            static void stop ( );
+    };
+
+    // marks iterations which write a restart file on a signal for the lifetime of the object
+    class CheckpointScope{
+        private:
+            bool active;
+
+        public:
+            explicit CheckpointScope ( bool active );
+            ~CheckpointScope ( );
+
+            CheckpointScope ( const CheckpointScope& ) = delete;
+            CheckpointScope& operator= ( const CheckpointScope& ) = delete;
+    };
+}
+#endif
@@ -3,6 +3,8 @@
 #include <iostream>
 #include <stdexcept>
 
+#include "Utils.h"
+
 void Config::FillDoubleWithElement(const tinyxml2::XMLElement *parent, const char *name, double &dest) {
     const tinyxml2::XMLElement *elem = parent->FirstChildElement(name);
     if (!elem) {
@@ -14,7 +16,7 @@ void Config::FillDoubleWithElement(const tinyxml2::XMLElement *parent, const cha
         try {
             dest = std::stod(text);
         } catch (std::invalid_argument) {
-            std::cout << "ERROR: while reading XML file, could not convert '" << text << "' to double for parameter " << name << "\n";
+            AtomUtils::get_output() << "ERROR: while reading XML file, could not convert '" << text << "' to double for parameter " << name << "\n";
             std::exit(1);
         }
     }
@@ -31,7 +33,7 @@ void Config::FillIntWithElement(const tinyxml2::XMLElement *parent, const char *
         try {
             dest = std::stoi(text);
         } catch (std::invalid_argument) {
-            std::cout << "ERROR: while reading XML file, could not convert '" << text << "' to int for parameter " << name << "\n";
+            AtomUtils::get_output() << "ERROR: while reading XML file, could not convert '" << text << "' to int for parameter " << name << "\n";
             std::exit(1);
         }
     }
@@ -61,7 +63,7 @@ void Config::FillBoolWithElement(const tinyxml2::XMLElement *parent, const char
     } else if (0 == strcmp(text, "true")) {
         dest = true;
     } else {
-        std::cout << "ERROR: while reading XML file, could not convert '" << text << "' to bool (true/false) for parameter " << name << "\n";
+        AtomUtils::get_output() << "ERROR: while reading XML file, could not convert '" << text << "' to bool (true/false) for parameter " << name << "\n";
         std::exit(1);
     }
 }
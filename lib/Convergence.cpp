@@ -0,0 +1,74 @@
+#include <cmath>
+#include <sstream>
+
+#include <Convergence.h>
+
+using namespace AtomUtils;
+
+ConvergenceControl::ConvergenceControl ( const std::string &name, int pressure_iter_max, int velocity_iter_max, int nm,
+                                         int window, double eps_emin, double eps_steady ) :
+    name ( name ),
+    iter_planned ( planned_iterations ( pressure_iter_max, velocity_iter_max, nm ) ),
+    window ( window ),
+    eps_emin ( eps_emin ),
+    eps_steady ( eps_steady ),
+    iter_done ( 0 ),
+    iter_hold ( 0 ),
+    residuum_last ( HUGE_VAL ),
+    emin_last ( 0. ),
+    steady_last ( 0. ),
+    converged ( false )
+{}
+
+int ConvergenceControl::planned_iterations ( int pressure_iter_max, int velocity_iter_max, int nm ){
+    // the pressure loop is left as soon as more than nm velocity iterations have been done
+    if ( velocity_iter_max <= 0 )  return 0;
+    int pressure_iter = ( nm + velocity_iter_max - 1 ) / velocity_iter_max;
+    if ( pressure_iter > pressure_iter_max )  pressure_iter = pressure_iter_max;
+    return pressure_iter * velocity_iter_max;
+}
+
+bool ConvergenceControl::update ( double emin, double steady_change, double residuum ){
+    iter_done++;
+    residuum = fabs ( residuum );
+    // comparisons with NaN fail, a diverging iteration never counts as converged
+    bool hold = ( emin <= eps_emin ) && ( steady_change <= eps_steady ) && ( residuum <= residuum_last * ( 1. + eps_emin ) );
+    iter_hold = hold ? iter_hold + 1 : 0;
+    residuum_last = residuum;
+    emin_last = emin;
+    steady_last = steady_change;
+    converged = window > 0 && iter_hold >= window;
+    return converged;
+}
+
+std::string ConvergenceControl::report ( ) const{
+    std::ostringstream os;
+    os << " " << name << " convergence: ";
+    if ( converged ){
+        os << "steady solution after " << iter_done << " of " << iter_planned << " iterations, "
+           << iterations_saved ( ) << " iterations saved";
+    }else{
+        os << "criteria not met after " << iter_done << " iterations ( held for " << iter_hold << " of " << window << " )";
+    }
+    os << ", emin = " << emin_last << ", max change = " << steady_last << ", residuum = " << residuum_last;
+    return os.str();
+}
+
+void ConvergenceControl::save ( std::map<std::string, double> &state ) const{
+    state[ "convergence.iter_done" ] = iter_done;
+    state[ "convergence.iter_hold" ] = iter_hold;
+    state[ "convergence.residuum_last" ] = residuum_last;
+    state[ "convergence.emin_last" ] = emin_last;
+    state[ "convergence.steady_last" ] = steady_last;
+    state[ "convergence.converged" ] = converged;
+}
+
+void ConvergenceControl::restore ( const std::map<std::string, double> &state ){
+    std::map<std::string, double>::const_iterator s;
+    if ( ( s = state.find ( "convergence.iter_done" ) ) != state.end ( ) )  iter_done = ( int ) s->second;
+    if ( ( s = state.find ( "convergence.iter_hold" ) ) != state.end ( ) )  iter_hold = ( int ) s->second;
+    if ( ( s = state.find ( "convergence.residuum_last" ) ) != state.end ( ) )  residuum_last = s->second;
+    if ( ( s = state.find ( "convergence.emin_last" ) ) != state.end ( ) )  emin_last = s->second;
+    if ( ( s = state.find ( "convergence.steady_last" ) ) != state.end ( ) )  steady_last = s->second;
+    if ( ( s = state.find ( "convergence.converged" ) ) != state.end ( ) )  converged = s->second != 0.;
+}
@@ -0,0 +1,54 @@
+/*
+ * Atmosphere General Circulation Modell ( AGCM ) applied to laminar flow
+ * Program for the computation of geo-atmospherical circulating flows in a spherical shell
+ * Finite difference scheme for the solution of the 3D Navier-Stokes equations
+ * with 2 additional transport equations to describe the water vapour and co2 concentration
+ * 4. order Runge-Kutta scheme to solve 2. order differential equations
+ *
+ * class to terminate the pressure and velocity iterations of a time slice when a steady solution is reached
+*/
+
+#ifndef _CONVERGENCE_
+#define _CONVERGENCE_
+
+#include <map>
+#include <string>
+
+namespace AtomUtils{
+    // an iteration counts as converged when
+    //   the relative change of the residuum emin <= eps_emin,
+    //   the largest change of the flow properties from the steadyQuery functions <= eps_steady and
+    //   the residuum of the continuity equation does not grow compared to the previous iteration,
+    // the time slice is terminated when this holds for window consecutive iterations, window = 0 runs all iterations
+    class ConvergenceControl{
+        private:
+            std::string name;
+            int iter_planned, window;
+            double eps_emin, eps_steady;
+            int iter_done, iter_hold;
+            double residuum_last, emin_last, steady_last;
+            bool converged;
+
+        public:
+            ConvergenceControl ( const std::string &name, int pressure_iter_max, int velocity_iter_max, int nm,
+                                 int window, double eps_emin, double eps_steady );
+
+            // number of iterations the pressure and velocity loops run without the controller, limited by nm
+            static int planned_iterations ( int pressure_iter_max, int velocity_iter_max, int nm );
+
+            // to be called once per velocity iteration, returns true when the iterations may be terminated
+            bool update ( double emin, double steady_change, double residuum );
+
+            bool is_converged ( ) const{ return converged; }
+            int iterations ( ) const{ return iter_done; }
+            int iterations_saved ( ) const{ return converged ? iter_planned - iter_done : 0; }
+
+            // one line summary of the iterations done and saved for the printout and the log file
+            std::string report ( ) const;
+
+            // state of the iterations done so far for a restart file, under keys beginning with "convergence."
+            void save ( std::map<std::string, double> &state ) const;
+            void restore ( const std::map<std::string, double> &state );
+    };
+}
+#endif
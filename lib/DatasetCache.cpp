@@ -0,0 +1,112 @@
+#include <cmath>
+#include <list>
+#include <map>
+#include <mutex>
+
+#include <sys/stat.h>
+
+#include <DatasetCache.h>
+#include <GridArchive.h>
+#include <Utils.h>
+#include <XyzReader.h>
+
+using namespace AtomUtils;
+
+namespace{
+    struct Entry{
+        DatasetCache::Handle data;
+        off_t size;
+        time_t mtime;
+        std::list<std::string>::iterator used;
+    };
+
+    // the grids of all time slices of a data set fit in, a grid of 1° takes half a MB
+    std::size_t capacity = 512 << 20;
+    std::size_t cached_bytes = 0;
+    std::map<std::string, Entry> entries;
+    std::list<std::string> recently_used;      // front is the most recently used key
+    std::mutex cache_mutex;
+
+    std::size_t bytes_of ( const DatasetCache::Handle &data ){
+        return data->size ( ) * sizeof ( double );
+    }
+
+    void erase ( std::map<std::string, Entry>::iterator e ){
+        cached_bytes -= bytes_of ( e->second.data );
+        recently_used.erase ( e->second.used );
+        entries.erase ( e );
+    }
+
+    // entries held by a caller are counted but kept, the cache may stay above capacity until they are released
+    void evict ( ){
+        std::list<std::string>::iterator key = recently_used.end ( );
+        while ( cached_bytes > capacity && key != recently_used.begin ( ) ){
+            --key;
+            std::map<std::string, Entry>::iterator e = entries.find ( *key );
+            if ( e->second.data.use_count ( ) == 1 ){
+                key = recently_used.erase ( key );
+                cached_bytes -= bytes_of ( e->second.data );
+                entries.erase ( e );
+            }
+        }
+    }
+}
+
+DatasetCache::Handle DatasetCache::get ( const std::string &path, const std::string &kind,
+                                         const std::function<void ( Data& )> &load ){
+    struct stat info;
+    if ( stat ( path.c_str ( ), &info ) != 0 ){
+        std::shared_ptr<Data> data = std::make_shared<Data> ( );
+        load ( *data );
+        return data;
+    }
+
+    // loading under the lock, models asking for the same data set at the same time load it once
+    std::lock_guard<std::mutex> lock ( cache_mutex );
+    std::string key = kind + ":" + path;
+    std::map<std::string, Entry>::iterator e = entries.find ( key );
+    if ( e != entries.end ( ) ){
+        if ( e->second.size == info.st_size && e->second.mtime == info.st_mtime ){
+            recently_used.splice ( recently_used.begin ( ), recently_used, e->second.used );
+            return e->second.data;
+        }
+        logger() << "dataset cache: " << path << " changed, loading it again" << std::endl;
+        erase ( e );
+    }
+
+    std::shared_ptr<Data> data = std::make_shared<Data> ( );
+    load ( *data );
+    recently_used.push_front ( key );
+    Entry &entry = entries[ key ];
+    entry.data = data;
+    entry.size = info.st_size;
+    entry.mtime = info.st_mtime;
+    entry.used = recently_used.begin ( );
+    cached_bytes += bytes_of ( entry.data );
+    evict ( );
+    return data;
+}
+
+DatasetCache::Handle DatasetCache::grid ( const std::string &path, int rows, int cols,
+                                          const std::string &description ){
+    return get ( path, "grid " + std::to_string ( rows ) + "x" + std::to_string ( cols ),
+                 [&] ( Data &z ){
+                     if ( !GridArchive::read ( path, rows, cols, z ) ){
+                         XyzReader ( path, description ).read_grid ( rows, cols, NAN, z );
+                         GridArchive::round ( z );
+                     }
+                 } );
+}
+
+void DatasetCache::set_capacity ( std::size_t bytes ){
+    std::lock_guard<std::mutex> lock ( cache_mutex );
+    capacity = bytes;
+    evict ( );
+}
+
+void DatasetCache::clear ( ){
+    std::lock_guard<std::mutex> lock ( cache_mutex );
+    entries.clear ( );
+    recently_used.clear ( );
+    cached_bytes = 0;
+}
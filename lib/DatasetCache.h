@@ -0,0 +1,47 @@
+/*
+ * Atmosphere General Circulation Modell ( AGCM ) applied to laminar flow
+ * Program for the computation of geo-atmospherical circulating flows in a spherical shell
+ * Finite difference scheme for the solution of the 3D Navier-Stokes equations
+ * with 2 additional transport equations to describe the water vapour and co2 concentration
+ * 4. order Runge-Kutta scheme to solve 2. order differential equations
+ *
+ * class to share the read only input data sets between time slices and models of a process
+*/
+
+#ifndef _DATASETCACHE_
+#define _DATASETCACHE_
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace AtomUtils{
+    // process wide cache of the immutable input data sets, an entry is keyed by the kind of data and the path
+    // and is loaded again when size or modification time of the file change,
+    // the data sets are handed out as shared pointers to const data, an entry which is only held by the cache
+    // is evicted least recently used first when the cache grows beyond its capacity, entries still held by a
+    // caller are never evicted, all functions may be called from several threads
+    class DatasetCache{
+        public:
+            typedef std::vector<double> Data;
+            typedef std::shared_ptr<const Data> Handle;
+
+            // the data set of kind at path, load fills it when it is not cached or the file has changed,
+            // a file which can not be stat'ed is loaded every time and is not cached
+            static Handle get ( const std::string &path, const std::string &kind,
+                                const std::function<void ( Data& )> &load );
+
+            // z values of the .xyz grid of rows x cols lines from the grid archive or the text file,
+            // values which could not be read are NaN, description names the file in error messages
+            static Handle grid ( const std::string &path, int rows, int cols, const std::string &description );
+
+            // upper bound in bytes for the data sets only held by the cache, 0 evicts them at once
+            static void set_capacity ( std::size_t bytes );
+
+            // drops all entries, data sets still held by callers stay valid
+            static void clear ( );
+    };
+}
+#endif
@@ -0,0 +1,31 @@
+#include <cstdlib>
+#include <iostream>
+
+#include <FieldRegistry.h>
+
+using namespace AtomUtils;
+
+void FieldRegistry::add ( const std::string &name, Array &field, int im, int jm, int km, double value ){
+    Entry entry = { &field, im, jm, km, value };
+    fields[ name ] = entry;
+    if ( field.is_allocated ( ) )  field.initArray ( im, jm, km, value );
+}
+
+Array& FieldRegistry::require ( const std::string &name ){
+    std::map<std::string, Entry>::iterator entry = fields.find ( name );
+    if ( entry == fields.end ( ) ){
+        std::cerr << "ERROR: the field " << name << " is not registered\n";
+        abort();
+    }
+    Entry &e = entry->second;
+    if ( !e.field->is_allocated ( ) )  e.field->initArray ( e.im, e.jm, e.km, e.value );
+    return *e.field;
+}
+
+std::vector<std::string> FieldRegistry::unallocated ( ) const{
+    std::vector<std::string> names;
+    for ( std::map<std::string, Entry>::const_iterator entry = fields.begin ( ); entry != fields.end ( ); ++entry ){
+        if ( !entry->second.field->is_allocated ( ) )  names.push_back ( entry->first );
+    }
+    return names;
+}
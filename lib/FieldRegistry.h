@@ -0,0 +1,44 @@
+/*
+ * Atmosphere General Circulation Modell ( AGCM ) applied to laminar flow
+ * Program for the computation of geo-atmospherical circulating flows in a spherical shell
+ * Finite difference scheme for the solution of the 3D Navier-Stokes equations
+ * with 2 additional transport equations to describe the water vapour and co2 concentration
+ * 4. order Runge-Kutta scheme to solve 2. order differential equations
+ *
+ * class to allocate the diagnostic fields of a model on their first use
+*/
+
+#ifndef _FIELDREGISTRY_
+#define _FIELDREGISTRY_
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "Array.h"
+
+namespace AtomUtils{
+    // 3D fields which only feed the result files and the printout, a field stays unallocated
+    // ( Array::is_allocated ( ) false ) until a consumer asks for it by require ( ), the computation
+    // skips the unallocated ones
+    class FieldRegistry{
+        private:
+            struct Entry{
+                Array *field;
+                int im, jm, km;
+                double value;
+            };
+            std::map<std::string, Entry> fields;
+
+        public:
+            // registers field with its size and initial value, an allocated field is reset to value
+            void add ( const std::string &name, Array &field, int im, int jm, int km, double value );
+
+            // allocates the field with its initial value on the first call
+            Array& require ( const std::string &name );
+
+            // names of the registered fields which are not allocated
+            std::vector<std::string> unallocated ( ) const;
+    };
+}
+#endif
@@ -0,0 +1,182 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <GridArchive.h>
+#include <Utils.h>
+#include <XyzReader.h>
+
+using namespace AtomUtils;
+
+const char *GridArchive::file_name = "xyz_grids.archive";
+
+namespace{
+    // layout: Header, n_entries Entry, then the float32 grids at their offsets from the begin of the file
+    const char archive_magic[ 8 ] = { 'A', 'T', 'O', 'M', 'G', 'R', 'I', 'D' };
+    const std::uint32_t archive_version = 1;
+
+    struct Header{
+        char magic[ 8 ];
+        std::uint32_t version, n_entries;
+    };
+
+    struct Entry{
+        char name[ 112 ];
+        std::uint64_t offset, source_size;
+        std::int64_t source_mtime;
+        std::uint32_t rows, cols;
+    };
+
+    std::string directory_of ( const std::string &path ){
+        std::size_t slash = path.find_last_of ( '/' );
+        return slash == std::string::npos ? "." : path.substr ( 0, slash );
+    }
+
+    std::string name_of ( const std::string &path ){
+        std::size_t slash = path.find_last_of ( '/' );
+        return slash == std::string::npos ? path : path.substr ( slash + 1 );
+    }
+
+    // z values of an .xyz file, the number of columns is the number of lines of the first latitude
+    bool read_xyz ( const std::string &path, std::vector<float> &z, std::uint32_t &rows, std::uint32_t &cols ){
+        XyzReader ifile ( path, "grid archive source" );
+
+        double lat_first = 0.;
+        cols = 0;
+        z.clear ( );
+        double lon, lat, value;
+        while ( ifile.next ( lon, lat, value ) ){
+            if ( z.empty ( ) )  lat_first = lat;
+            if ( cols == 0 && !std::isnan ( lat ) && lat != lat_first )  cols = z.size ( );
+            z.push_back ( ( float ) value );
+        }
+        if ( cols == 0 )  cols = z.size ( );
+        if ( cols == 0 || z.size ( ) % cols != 0 ){
+            logger() << "grid archive: " << path << " is no complete grid, not archived" << std::endl;
+            return false;
+        }
+        rows = z.size ( ) / cols;
+        return true;
+    }
+}
+
+int GridArchive::build ( const std::string &directory ){
+    std::vector<std::string> names;
+    DIR *dir = opendir ( directory.c_str ( ) );
+    if ( !dir ){
+        std::cerr << "ERROR: could not open the directory " << directory << " for the grid archive\n";
+        abort();
+    }
+    while ( dirent *e = readdir ( dir ) ){
+        std::string name = e->d_name;
+        if ( name.size ( ) > 4 && name.compare ( name.size ( ) - 4, 4, ".xyz" ) == 0
+             && name.size ( ) < sizeof ( Entry::name ) )  names.push_back ( name );
+    }
+    closedir ( dir );
+    std::sort ( names.begin ( ), names.end ( ) );
+
+    std::vector<Entry> entries;
+    std::vector<std::vector<float> > grids;
+    for ( std::size_t n = 0; n < names.size ( ); n++ ){
+        std::string path = directory + "/" + names[ n ];
+        struct stat info;
+        Entry entry;
+        std::vector<float> z;
+        if ( stat ( path.c_str ( ), &info ) != 0 || !read_xyz ( path, z, entry.rows, entry.cols ) )  continue;
+        std::memset ( entry.name, 0, sizeof ( entry.name ) );
+        std::strncpy ( entry.name, names[ n ].c_str ( ), sizeof ( entry.name ) - 1 );
+        entry.source_size = info.st_size;
+        entry.source_mtime = info.st_mtime;
+        entries.push_back ( entry );
+        grids.push_back ( z );
+    }
+
+    std::uint64_t offset = sizeof ( Header ) + entries.size ( ) * sizeof ( Entry );
+    for ( std::size_t n = 0; n < entries.size ( ); n++ ){
+        entries[ n ].offset = offset;
+        offset += grids[ n ].size ( ) * sizeof ( float );
+    }
+
+    // written to a temporary file first, so that a running model never maps a half written archive
+    std::string archive = directory + "/" + file_name;
+    std::string temporary = archive + ".tmp";
+    std::ofstream ofile ( temporary, std::ios::binary );
+    if ( !ofile.is_open ( ) ){
+        std::cerr << "ERROR: could not open the grid archive " << temporary << "\n";
+        abort();
+    }
+    Header header;
+    std::memcpy ( header.magic, archive_magic, sizeof ( header.magic ) );
+    header.version = archive_version;
+    header.n_entries = entries.size ( );
+    ofile.write ( reinterpret_cast<const char*> ( &header ), sizeof ( header ) );
+    ofile.write ( reinterpret_cast<const char*> ( entries.data ( ) ), entries.size ( ) * sizeof ( Entry ) );
+    for ( std::size_t n = 0; n < grids.size ( ); n++ ){
+        ofile.write ( reinterpret_cast<const char*> ( grids[ n ].data ( ) ), grids[ n ].size ( ) * sizeof ( float ) );
+    }
+    ofile.close ( );
+    if ( !ofile || std::rename ( temporary.c_str ( ), archive.c_str ( ) ) != 0 ){
+        std::remove ( temporary.c_str ( ) );
+        std::cerr << "ERROR: could not write the grid archive " << archive << "\n";
+        abort();
+    }
+    return entries.size ( );
+}
+
+bool GridArchive::read ( const std::string &xyz_file, int rows, int cols, std::vector<double> &z ){
+    std::string archive = directory_of ( xyz_file ) + "/" + file_name;
+    int fd = open ( archive.c_str ( ), O_RDONLY );
+    if ( fd < 0 )  return false;
+
+    struct stat info;
+    void *map = MAP_FAILED;
+    if ( fstat ( fd, &info ) == 0 && info.st_size >= ( off_t ) sizeof ( Header ) ){
+        map = mmap ( nullptr, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0 );
+    }
+    close ( fd );
+    if ( map == MAP_FAILED )  return false;
+
+    const char *base = static_cast<const char*> ( map );
+    std::size_t size = info.st_size;
+    const Header *header = reinterpret_cast<const Header*> ( base );
+    const Entry *entry = nullptr;
+    if ( std::memcmp ( header->magic, archive_magic, sizeof ( archive_magic ) ) == 0
+         && header->version == archive_version
+         && sizeof ( Header ) + ( std::size_t ) header->n_entries * sizeof ( Entry ) <= size ){
+        const Entry *entries = reinterpret_cast<const Entry*> ( base + sizeof ( Header ) );
+        std::string name = name_of ( xyz_file );
+        for ( std::uint32_t n = 0; n < header->n_entries && !entry; n++ ){
+            if ( std::strncmp ( entries[ n ].name, name.c_str ( ), sizeof ( Entry::name ) ) == 0 )  entry = &entries[ n ];
+        }
+    }
+
+    bool valid = entry && ( int ) entry->rows == rows && ( int ) entry->cols == cols
+                 && entry->offset + ( std::uint64_t ) rows * cols * sizeof ( float ) <= size;
+    struct stat source;
+    if ( valid && stat ( xyz_file.c_str ( ), &source ) == 0
+         && ( ( std::uint64_t ) source.st_size != entry->source_size || source.st_mtime != entry->source_mtime ) ){
+        logger() << "grid archive: " << xyz_file << " changed since the archive was built, reading the text file"
+                 << std::endl;
+        valid = false;
+    }
+    if ( valid ){
+        const float *values = reinterpret_cast<const float*> ( base + entry->offset );
+        z.assign ( values, values + rows * cols );
+    }
+    munmap ( map, size );
+    return valid;
+}
+
+void GridArchive::round ( std::vector<double> &z ){
+    for ( std::size_t n = 0; n < z.size ( ); n++ )  z[ n ] = ( float ) z[ n ];
+}
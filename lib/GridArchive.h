@@ -0,0 +1,39 @@
+/*
+ * Atmosphere General Circulation Modell ( AGCM ) applied to laminar flow
+ * Program for the computation of geo-atmospherical circulating flows in a spherical shell
+ * Finite difference scheme for the solution of the 3D Navier-Stokes equations
+ * with 2 additional transport equations to describe the water vapour and co2 concentration
+ * 4. order Runge-Kutta scheme to solve 2. order differential equations
+ *
+ * class to keep the paleotopography/bathymetry grids of a data set in one binary archive
+*/
+
+#ifndef _GRIDARCHIVE_
+#define _GRIDARCHIVE_
+
+#include <string>
+#include <vector>
+
+namespace AtomUtils{
+    // indexed archive of the z values of all .xyz grids in a directory, stored as float32 in the order of the lines,
+    // the archive is written once by build ( ) and memory mapped by read ( ),
+    // an entry is only used as long as size and modification time of its .xyz file are unchanged,
+    // values which could not be read from the .xyz file are stored as NaN, the text files are read with the
+    // same float32 rounding ( round ( ) ), so a grid has the same values with and without the archive
+    class GridArchive{
+        public:
+            // name of the archive inside the directory of the .xyz files
+            static const char *file_name;
+
+            // converts all .xyz files of directory into its archive, returns the number of grids stored
+            static int build ( const std::string &directory );
+
+            // z values of xyz_file, false if the archive has no valid entry of rows x cols values for it,
+            // the caller then reads the text file
+            static bool read ( const std::string &xyz_file, int rows, int cols, std::vector<double> &z );
+
+            // rounds the z values read from a text file to the float32 values of the archive
+            static void round ( std::vector<double> &z );
+    };
+}
+#endif
@@ -0,0 +1,96 @@
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+
+#include <Logger.h>
+
+using namespace AtomUtils;
+
+namespace{
+    LogLevel parse_level ( const std::string &name ){
+        const char *names[] = { "off", "error", "warning", "info", "debug" };
+        for ( int n = LOG_OFF; n <= LOG_DEBUG; n++ ){
+            if ( name == names[ n ] )  return LogLevel ( n );
+        }
+        std::cerr << "ERROR: unknown log level " << name << ", use off, error, warning, info or debug\n";
+        abort();
+    }
+}
+
+LogLevel AtomUtils::log_level ( const std::string &spec, const std::string &component ){
+    LogLevel level = LOG_INFO;
+    std::istringstream is ( spec );
+    std::string entry;
+    while ( std::getline ( is, entry, ',' ) ){
+        std::size_t begin = entry.find_first_not_of ( " \t" ), end = entry.find_last_not_of ( " \t" );
+        if ( begin == std::string::npos )  continue;
+        entry = entry.substr ( begin, end - begin + 1 );
+
+        std::size_t equals = entry.find ( '=' );
+        if ( equals == std::string::npos )  level = parse_level ( entry );
+        else if ( entry.substr ( 0, equals ) == component )  return parse_level ( entry.substr ( equals + 1 ) );
+    }
+    return level;
+}
+
+BufferedStreambuf::BufferedStreambuf ( std::streambuf *target, double interval, std::size_t size ):
+    size ( size ),
+    target ( target ),
+    interval ( interval ),
+    last_drain ( std::chrono::steady_clock::now ( ) ),
+    busy ( 0 )
+{
+    buffer.reserve ( size );
+}
+
+BufferedStreambuf::~BufferedStreambuf ( ){
+    drain ( );
+}
+
+void BufferedStreambuf::set_target ( std::streambuf *target ){
+    drain ( );
+    this->target = target;
+}
+
+void BufferedStreambuf::set_interval ( double seconds ){
+    interval = seconds;
+}
+
+void BufferedStreambuf::drain ( ){
+    if ( busy )  return;
+    busy = 1;
+    pass_on ( );
+    busy = 0;
+}
+
+void BufferedStreambuf::pass_on ( ){
+    if ( target && !buffer.empty ( ) ){
+        target->sputn ( buffer.data ( ), buffer.size ( ) );
+        target->pubsync ( );
+    }
+    buffer.clear ( );
+    last_drain = std::chrono::steady_clock::now ( );
+}
+
+std::streamsize BufferedStreambuf::xsputn ( const char *s, std::streamsize n ){
+    if ( busy )  return 0;
+    busy = 1;
+    buffer.append ( s, n );
+    if ( buffer.size ( ) >= size )  pass_on ( );
+    busy = 0;
+    return n;
+}
+
+BufferedStreambuf::int_type BufferedStreambuf::overflow ( int_type c ){
+    if ( !traits_type::eq_int_type ( c, traits_type::eof ( ) ) ){
+        char ch = traits_type::to_char_type ( c );
+        xsputn ( &ch, 1 );
+    }
+    return traits_type::not_eof ( c );
+}
+
+int BufferedStreambuf::sync ( ){
+    if ( interval <= 0. || std::chrono::duration<double> ( std::chrono::steady_clock::now ( ) - last_drain ).count ( )
+                           >= interval )  drain ( );
+    return 0;
+}
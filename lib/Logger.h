@@ -0,0 +1,61 @@
+/*
+ * Atmosphere General Circulation Modell ( AGCM ) applied to laminar flow
+ * Program for the computation of geo-atmospherical circulating flows in a spherical shell
+ * Finite difference scheme for the solution of the 3D Navier-Stokes equations
+ * with 2 additional transport equations to describe the water vapour and co2 concentration
+ * 4. order Runge-Kutta scheme to solve 2. order differential equations
+ *
+ * class to buffer the output and the log of the models
+*/
+
+#ifndef _LOGGER_
+#define _LOGGER_
+
+#include <chrono>
+#include <csignal>
+#include <streambuf>
+#include <string>
+
+namespace AtomUtils{
+    enum LogLevel { LOG_OFF, LOG_ERROR, LOG_WARNING, LOG_INFO, LOG_DEBUG };
+
+    // level of component in spec, a comma separated list of a default level and component=level pairs
+    // like "info,hyd=warning,atm=debug", the levels are off, error, warning, info and debug
+    LogLevel log_level ( const std::string &spec, const std::string &component );
+
+    // collects the text written to it and passes it on to target in batches, when the buffer is full,
+    // on drain ( ) and on a flush ( std::endl ) at least interval seconds after the last batch, a flush
+    // in between costs no system call and no call into Python, it belongs to the thread of one model
+    class BufferedStreambuf : public std::streambuf{
+        public:
+            explicit BufferedStreambuf ( std::streambuf *target, double interval = 1., std::size_t size = 1 << 16 );
+            ~BufferedStreambuf ( );
+
+            BufferedStreambuf ( const BufferedStreambuf& ) = delete;
+            BufferedStreambuf& operator= ( const BufferedStreambuf& ) = delete;
+
+            // passes the buffered text on to the previous target first
+            void set_target ( std::streambuf *target );
+            void set_interval ( double seconds );
+
+            // passes the buffered text on to target and flushes it, does nothing when called from a signal handler
+            // which interrupted a write into the buffer
+            void drain ( );
+
+        protected:
+            virtual std::streamsize xsputn ( const char *s, std::streamsize n );
+            virtual int_type overflow ( int_type c );
+            virtual int sync ( );
+
+        private:
+            void pass_on ( );
+
+            std::string buffer;
+            std::size_t size;
+            std::streambuf *target;
+            double interval;
+            std::chrono::steady_clock::time_point last_drain;
+            volatile std::sig_atomic_t busy;
+    };
+}
+#endif
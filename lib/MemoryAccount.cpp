@@ -0,0 +1,69 @@
+#include <algorithm>
+#include <atomic>
+#include <iomanip>
+#include <sstream>
+
+#include <sys/resource.h>
+
+#include <MemoryAccount.h>
+
+using namespace AtomUtils;
+
+namespace{
+    std::atomic<std::size_t> current_bytes ( 0 );
+    std::atomic<std::size_t> highest_bytes ( 0 );
+
+    double MB ( std::size_t bytes ){
+        return bytes / ( 1024. * 1024. );
+    }
+}
+
+void MemoryAccount::allocate ( std::size_t bytes ){
+    std::size_t now = current_bytes += bytes;
+    std::size_t peak = highest_bytes.load ( );
+    while ( now > peak && !highest_bytes.compare_exchange_weak ( peak, now ) ){}
+}
+
+void MemoryAccount::release ( std::size_t bytes ){
+    current_bytes -= bytes;
+}
+
+std::size_t MemoryAccount::bytes ( ){
+    return current_bytes.load ( );
+}
+
+std::size_t MemoryAccount::peak_bytes ( ){
+    return highest_bytes.load ( );
+}
+
+std::size_t MemoryAccount::max_rss ( ){
+    struct rusage usage;
+    if ( getrusage ( RUSAGE_SELF, &usage ) != 0 )  return 0;
+#ifdef __APPLE__
+    return usage.ru_maxrss;   // in bytes on macOS
+#else
+    return std::size_t ( usage.ru_maxrss ) * 1024;   // in kB on Linux
+#endif
+}
+
+std::string MemoryAccount::report ( const std::string &title,
+                                    std::vector<std::pair<std::string, std::size_t> > fields ){
+    std::stable_sort ( fields.begin ( ), fields.end ( ),
+        [ ] ( const std::pair<std::string, std::size_t> &a, const std::pair<std::string, std::size_t> &b ){
+            return a.second > b.second;
+        } );
+    std::size_t total = 0;
+    for ( std::size_t n = 0; n < fields.size ( ); n++ )  total += fields[ n ].second;
+
+    std::ostringstream os;
+    os.setf ( std::ios::fixed );
+    os << std::setprecision ( 1 );
+    os << " " << title << ": " << fields.size ( ) << " fields, " << MB ( total ) << " MB\n";
+    for ( std::size_t n = 0; n < fields.size ( ); n++ ){
+        os << "   " << std::left << std::setw ( 24 ) << fields[ n ].first << std::right << std::setw ( 10 )
+           << MB ( fields[ n ].second ) << " MB\n";
+    }
+    os << " fields of all models of the process: " << MB ( bytes ( ) ) << " MB, high-water mark "
+       << MB ( peak_bytes ( ) ) << " MB, peak resident memory " << MB ( max_rss ( ) ) << " MB";
+    return os.str ( );
+}
@@ -0,0 +1,65 @@
+/*
+ * Atmosphere General Circulation Modell ( AGCM ) applied to laminar flow
+ * Program for the computation of geo-atmospherical circulating flows in a spherical shell
+ * Finite difference scheme for the solution of the 3D Navier-Stokes equations
+ * with 2 additional transport equations to describe the water vapour and co2 concentration
+ * 4. order Runge-Kutta scheme to solve 2. order differential equations
+ *
+ * class to account the memory of the fields of the models
+*/
+
+#ifndef _MEMORYACCOUNT_
+#define _MEMORYACCOUNT_
+
+#include <cstddef>
+#include <new>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace AtomUtils{
+    // bytes held by the Array, Array_2D and Vector3D fields of all models of the process, counted by their
+    // allocations, and the high-water mark of it, which includes the snapshots of the output writers
+    // and the temporary fields of the computation
+    class MemoryAccount{
+        public:
+            static void allocate ( std::size_t bytes );
+            static void release ( std::size_t bytes );
+
+            static std::size_t bytes ( );
+            static std::size_t peak_bytes ( );
+
+            // peak resident memory of the process as seen by the operating system, 0 if unknown
+            static std::size_t max_rss ( );
+
+            // table of the named fields of a model, largest first, their total, and the memory of the process
+            static std::string report ( const std::string &title,
+                                        std::vector<std::pair<std::string, std::size_t> > fields );
+    };
+
+    // allocator of the std::vector based fields, accounts their memory in MemoryAccount
+    template<class T>
+    struct TrackedAllocator{
+        typedef T value_type;
+
+        TrackedAllocator ( ){}
+        template<class U> TrackedAllocator ( const TrackedAllocator<U>& ){}
+
+        T* allocate ( std::size_t n ){
+            T *p = static_cast<T*> ( ::operator new ( n * sizeof ( T ) ) );
+            MemoryAccount::allocate ( n * sizeof ( T ) );
+            return p;
+        }
+
+        void deallocate ( T *p, std::size_t n ){
+            MemoryAccount::release ( n * sizeof ( T ) );
+            ::operator delete ( p );
+        }
+    };
+
+    template<class T, class U>
+    bool operator== ( const TrackedAllocator<T>&, const TrackedAllocator<U>& ){ return true; }
+    template<class T, class U>
+    bool operator!= ( const TrackedAllocator<T>&, const TrackedAllocator<U>& ){ return false; }
+}
+#endif
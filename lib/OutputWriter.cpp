@@ -0,0 +1,159 @@
+#include <chrono>
+#include <sstream>
+
+#include <OutputWriter.h>
+#include <TraceRecorder.h>
+#include <Utils.h>
+
+using namespace AtomUtils;
+
+OutputSnapshot::~OutputSnapshot ( ){
+    for ( auto &field : arrays_3d )  delete field.second;
+    for ( auto &field : arrays_2d )  delete field.second;
+}
+
+void OutputSnapshot::take ( const std::vector<Array*> &fields_3d, const std::vector<Array_2D*> &fields_2d ){
+    for ( Array *field : fields_3d ){
+        if ( !arrays_3d.count ( field ) )  arrays_3d[ field ] = new Array ( *field );
+    }
+    for ( Array_2D *field : fields_2d ){
+        if ( !arrays_2d.count ( field ) )  arrays_2d[ field ] = new Array_2D ( *field );
+    }
+}
+
+Array& OutputSnapshot::operator() ( Array &field ) const{
+    auto copy = arrays_3d.find ( &field );
+    return copy == arrays_3d.end ( ) ? field : *copy->second;
+}
+
+Array_2D& OutputSnapshot::operator() ( Array_2D &field ) const{
+    auto copy = arrays_2d.find ( &field );
+    return copy == arrays_2d.end ( ) ? field : *copy->second;
+}
+
+
+OutputWriter::OutputWriter ( ) :
+    depth ( 0 ),
+    in_flight ( 0 ),
+    stop ( false ),
+    jobs_done ( 0 ),
+    blocked ( 0. )
+{}
+
+OutputWriter::~OutputWriter ( ){
+    {
+        std::unique_lock<std::mutex> lock ( mutex );
+        changed.wait ( lock, [ this ] ( ){ return in_flight == 0; } );
+        stop = true;
+        changed.notify_all ( );
+    }
+    if ( worker.joinable ( ) )  worker.join ( );
+    forward ( );
+}
+
+void OutputWriter::submit ( const std::function<void ( )> &job ){
+    if ( depth <= 0 ){
+        job ( );
+        return;
+    }
+
+    forward ( );
+
+    std::ostream *output = &get_output ( ), *log = &get_logger ( );
+    LogLevel level = get_log_level ( );
+    std::function<void ( )> bound_job = [ this, job, output, log, level ] ( ){
+        std::ostringstream job_output, job_log;
+        std::exception_ptr job_error;
+        try{
+            StreamScope stream_scope ( job_output, job_log, level );
+            job ( );
+        }catch ( ... ){
+            job_error = std::current_exception ( );
+        }
+        {
+            std::lock_guard<std::mutex> guard ( mutex );
+            printouts.push_back ( Printout { output, log, job_output.str ( ), job_log.str ( ) } );
+        }
+        if ( job_error )  std::rethrow_exception ( job_error );
+    };
+
+    std::unique_lock<std::mutex> lock ( mutex );
+    if ( !worker.joinable ( ) )  worker = std::thread ( &OutputWriter::work, this );
+
+    auto start = std::chrono::steady_clock::now ( );
+    if ( in_flight >= depth ){
+        TraceScope blocked_trace ( "blocked by output writer", "io" );
+        changed.wait ( lock, [ this ] ( ){ return in_flight < depth; } );
+    }
+    blocked += std::chrono::duration<double> ( std::chrono::steady_clock::now ( ) - start ).count ( );
+
+    queue.push_back ( bound_job );
+    in_flight++;
+    changed.notify_all ( );
+}
+
+void OutputWriter::work ( ){
+    TraceRecorder::name_thread ( "output writer" );
+    std::unique_lock<std::mutex> lock ( mutex );
+    while ( true ){
+        changed.wait ( lock, [ this ] ( ){ return !queue.empty ( ) || stop; } );
+        if ( queue.empty ( ) )  return;
+
+        std::function<void ( )> job = queue.front ( );
+        queue.erase ( queue.begin ( ) );
+        lock.unlock ( );
+
+        std::exception_ptr job_error;
+        try{
+            TraceScope job_trace ( "write result files", "io" );
+            job ( );
+        }catch ( ... ){
+            job_error = std::current_exception ( );
+        }
+
+        lock.lock ( );
+        if ( job_error && !error )  error = job_error;
+        in_flight--;
+        jobs_done++;
+        changed.notify_all ( );
+    }
+}
+
+void OutputWriter::forward ( ){
+    std::vector<Printout> finished;
+    {
+        std::lock_guard<std::mutex> guard ( mutex );
+        finished.swap ( printouts );
+    }
+    for ( const Printout &printout : finished ){
+        *printout.output << printout.output_text;
+        *printout.log << printout.log_text;
+    }
+}
+
+void OutputWriter::wait ( ){
+    {
+        std::unique_lock<std::mutex> lock ( mutex );
+        changed.wait ( lock, [ this ] ( ){ return in_flight == 0; } );
+    }
+    forward ( );
+
+    std::unique_lock<std::mutex> lock ( mutex );
+    if ( error ){
+        std::exception_ptr job_error = error;
+        error = nullptr;
+        std::rethrow_exception ( job_error );
+    }
+}
+
+std::string OutputWriter::report ( ){
+    std::lock_guard<std::mutex> guard ( mutex );
+    std::ostringstream os;
+    os.precision ( 2 );
+    os.setf ( std::ios::fixed );
+    os << " output writer: " << jobs_done << " result snapshots written in the background, computation blocked for "
+       << blocked << " s";
+    jobs_done = 0;
+    blocked = 0.;
+    return os.str ( );
+}
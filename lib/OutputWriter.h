@@ -0,0 +1,96 @@
+/*
+ * Atmosphere General Circulation Modell ( AGCM ) applied to laminar flow
+ * Program for the computation of geo-atmospherical circulating flows in a spherical shell
+ * Finite difference scheme for the solution of the 3D Navier-Stokes equations
+ * with 2 additional transport equations to describe the water vapour and co2 concentration
+ * 4. order Runge-Kutta scheme to solve 2. order differential equations
+ *
+ * classes to write the result files on a background thread while the computation continues
+*/
+
+#ifndef _OUTPUTWRITER_
+#define _OUTPUTWRITER_
+
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <map>
+#include <string>
+#include <mutex>
+#include <ostream>
+#include <thread>
+#include <vector>
+
+#include "Array.h"
+#include "Array_2D.h"
+
+namespace AtomUtils{
+    // copies of the fields a result file is written from, snapshot ( field ) returns the copy of a taken field
+    // and the field itself otherwise, so the same printout code serves the synchronous and the background writing
+    class OutputSnapshot{
+        private:
+            std::map<const Array*, Array*> arrays_3d;
+            std::map<const Array_2D*, Array_2D*> arrays_2d;
+
+        public:
+            OutputSnapshot ( ){}
+            ~OutputSnapshot ( );
+
+            OutputSnapshot ( const OutputSnapshot& ) = delete;
+            OutputSnapshot& operator= ( const OutputSnapshot& ) = delete;
+
+            void take ( const std::vector<Array*> &fields_3d, const std::vector<Array_2D*> &fields_2d );
+
+            Array& operator() ( Array &field ) const;
+            Array_2D& operator() ( Array_2D &field ) const;
+    };
+
+    // runs the jobs on a thread of its own in the order of submission, at most depth jobs are queued or running,
+    // submit() blocks while the writer is behind, depth <= 0 runs a job at once on the calling thread
+    // the printout of a job is collected on the writer thread and passed on as a whole to the output and log
+    // streams of the thread which submitted it, by that thread in submit(), wait() and the destructor
+    class OutputWriter{
+        private:
+            struct Printout{
+                std::ostream *output, *log;
+                std::string output_text, log_text;
+            };
+
+            int depth;
+            std::vector<std::function<void ( )> > queue;
+            std::vector<Printout> printouts;
+            int in_flight;
+            bool stop;
+            std::exception_ptr error;
+            std::mutex mutex;
+            std::condition_variable changed;
+            std::thread worker;
+
+            int jobs_done;
+            double blocked;
+
+            void work ( );
+
+            // passes the printout of the finished jobs on, on the thread which submitted them
+            void forward ( );
+
+        public:
+            OutputWriter ( );
+            ~OutputWriter ( );
+
+            OutputWriter ( const OutputWriter& ) = delete;
+            OutputWriter& operator= ( const OutputWriter& ) = delete;
+
+            void set_depth ( int depth ){ this->depth = depth; }
+            int get_depth ( ) const{ return depth; }
+
+            void submit ( const std::function<void ( )> &job );
+
+            // blocks until all submitted jobs are written, rethrows the first error of a job
+            void wait ( );
+
+            // jobs written in the background and the time submit() was blocked since the last call, then reset
+            std::string report ( );
+    };
+}
+#endif
@@ -0,0 +1,92 @@
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <PerfCounters.h>
+
+using namespace AtomUtils;
+
+#ifdef __linux__
+namespace{
+    int open_counter ( std::uint64_t config, int group_fd ){
+        perf_event_attr attr;
+        std::memset ( &attr, 0, sizeof ( attr ) );
+        attr.size = sizeof ( attr );
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.config = config;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+        return syscall ( __NR_perf_event_open, &attr, 0, -1, group_fd, 0 );
+    }
+}
+
+PerfCounters::PerfCounters ( ){
+    const std::uint64_t config[ n_events ] = { PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+                                               PERF_COUNT_HW_CACHE_REFERENCES, PERF_COUNT_HW_CACHE_MISSES };
+    int team = 1;
+#ifdef _OPENMP
+    team = omp_get_max_threads ( );
+#endif
+    fd.assign ( team * n_events, -1 );
+
+    // the counters of a thread count that thread only, so each thread of the team opens its own group
+    #pragma omp parallel num_threads ( team )
+    {
+        int thread = 0;
+#ifdef _OPENMP
+        thread = omp_get_thread_num ( );
+#endif
+        int *group = &fd[ thread * n_events ];
+        for ( int n = 0; n < n_events; n++ ){
+            group[ n ] = open_counter ( config[ n ], n == 0 ? -1 : group[ 0 ] );
+            if ( group[ n ] < 0 ){
+                #pragma omp critical ( perf_counters )
+                if ( reason.empty ( ) )  reason = std::string ( "perf_event_open: " ) + std::strerror ( errno );
+                break;
+            }
+        }
+    }
+
+    if ( !reason.empty ( ) ){
+        for ( std::size_t n = 0; n < fd.size ( ); n++ ){
+            if ( fd[ n ] >= 0 )  close ( fd[ n ] );
+        }
+        fd.clear ( );
+    }
+}
+
+PerfCounters::~PerfCounters ( ){
+    for ( std::size_t n = 0; n < fd.size ( ); n++ )  close ( fd[ n ] );
+}
+
+void PerfCounters::read ( Values &values ) const{
+    values = Values ( );
+    for ( std::size_t leader = 0; leader < fd.size ( ); leader += n_events ){
+        std::uint64_t data[ 3 + n_events ];   // number of counters, time enabled, time running, values
+        if ( ::read ( fd[ leader ], data, sizeof ( data ) ) != sizeof ( data ) || data[ 2 ] == 0 )  continue;
+        double scale = double ( data[ 1 ] ) / double ( data[ 2 ] );
+        for ( int n = 0; n < n_events; n++ )  values.count[ n ] += double ( data[ 3 + n ] ) * scale;
+    }
+}
+#else
+PerfCounters::PerfCounters ( ) :
+    reason ( "perf_event_open is only available on Linux" )
+{}
+
+PerfCounters::~PerfCounters ( ){}
+
+void PerfCounters::read ( Values &values ) const{
+    values = Values ( );
+}
+#endif
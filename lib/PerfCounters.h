@@ -0,0 +1,68 @@
+/*
+ * Atmosphere General Circulation Modell ( AGCM ) applied to laminar flow
+ * Program for the computation of geo-atmospherical circulating flows in a spherical shell
+ * Finite difference scheme for the solution of the 3D Navier-Stokes equations
+ * with 2 additional transport equations to describe the water vapour and co2 concentration
+ * 4. order Runge-Kutta scheme to solve 2. order differential equations
+ *
+ * class to read the hardware performance counters of the running thread
+*/
+
+#ifndef _PERFCOUNTERS_
+#define _PERFCOUNTERS_
+
+#include <string>
+#include <vector>
+
+namespace AtomUtils{
+    // cycles, instructions and last level cache references and misses of the OpenMP team of the thread which
+    // created the object, counted by the Linux perf_event_open without external tools
+    //
+    // each thread of the team gets a group of the four counters led by the cycles, opened in a parallel region,
+    // so the persistent OpenMP threads are counted while they run, the counters of a group run in the same time
+    // window, the group is scaled as a whole when the kernel multiplexes it, read ( ) sums the groups
+    class PerfCounters{
+        public:
+            enum Event{ cycles, instructions, llc_references, llc_misses, n_events };
+
+            struct Values{
+                double count[ n_events ];
+
+                Values ( ){
+                    for ( int n = 0; n < n_events; n++ )  count[ n ] = 0.;
+                }
+
+                Values& operator+= ( const Values &other ){
+                    for ( int n = 0; n < n_events; n++ )  count[ n ] += other.count[ n ];
+                    return *this;
+                }
+
+                Values operator- ( const Values &other ) const{
+                    Values difference;
+                    for ( int n = 0; n < n_events; n++ )  difference.count[ n ] = count[ n ] - other.count[ n ];
+                    return difference;
+                }
+            };
+
+            PerfCounters ( );
+            ~PerfCounters ( );
+
+            PerfCounters ( const PerfCounters& ) = delete;
+            PerfCounters& operator= ( const PerfCounters& ) = delete;
+
+            // false with the reason in error ( ) when the kernel refuses the counters ( perf_event_paranoid,
+            // containers, no hardware counters in a virtual machine ), read ( ) then gives zeros
+            bool available ( ) const{ return !fd.empty ( ); }
+            const std::string& error ( ) const{ return reason; }
+
+            void read ( Values &values ) const;
+
+            // threads counted
+            int threads ( ) const{ return fd.size ( ) / n_events; }
+
+        private:
+            std::vector<int> fd;  // n_events per thread, the leader first
+            std::string reason;
+    };
+}
+#endif
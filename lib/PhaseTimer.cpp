@@ -0,0 +1,126 @@
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+
+#include <PhaseTimer.h>
+#include <Utils.h>
+
+using namespace AtomUtils;
+
+namespace{
+    std::string json_string ( const std::string &s ){
+        std::string quoted = "\"";
+        for ( std::size_t n = 0; n < s.size ( ); n++ ){
+            if ( s[ n ] == '"' || s[ n ] == '\\' )  quoted += '\\';
+            quoted += s[ n ];
+        }
+        return quoted + "\"";
+    }
+}
+
+PhaseProfile::PhaseProfile ( ) :
+    total ( 0. ),
+    iterations ( 0 )
+{}
+
+void PhaseProfile::reset ( ){
+    phases.clear ( );
+    total = 0.;
+    iterations = 0;
+}
+
+void PhaseProfile::count_hardware ( bool count ){
+    counters.reset ( );
+    if ( !count || !phase_timers_enabled )  return;
+    counters.reset ( new PerfCounters ( ) );
+    if ( !counters->available ( ) ){
+        logger() << "hardware counters not available, " << counters->error ( ) << std::endl;
+    }
+}
+
+void PhaseProfile::add ( const char *name, double seconds, const PerfCounters::Values &counts ){
+    for ( std::size_t n = 0; n < phases.size ( ); n++ ){
+        if ( phases[ n ].name == name ){
+            phases[ n ].seconds += seconds;
+            phases[ n ].calls++;
+            phases[ n ].counts += counts;
+            return;
+        }
+    }
+    Phase phase = { name, seconds, 1, counts };
+    phases.push_back ( phase );
+}
+
+std::vector<std::pair<std::string, double> > PhaseProfile::phase_seconds ( ) const{
+    std::vector<std::pair<std::string, double> > times;
+    for ( std::size_t n = 0; n < phases.size ( ); n++ ){
+        times.push_back ( std::make_pair ( phases[ n ].name, phases[ n ].seconds ) );
+    }
+    return times;
+}
+
+std::string PhaseProfile::report ( const std::string &title ) const{
+    std::ostringstream os;
+    os.setf ( std::ios::fixed );
+    double in_phases = 0.;
+    for ( std::size_t n = 0; n < phases.size ( ); n++ )  in_phases += phases[ n ].seconds;
+    double other = total > in_phases ? total - in_phases : 0.;
+    double all = total > in_phases ? total : in_phases;
+    int per = iterations > 0 ? iterations : 1;
+
+    os << " " << title << ": " << iterations << " iterations in " << std::setprecision ( 2 ) << all << " s\n";
+    os << "   " << std::left << std::setw ( 34 ) << "phase" << std::right << std::setw ( 8 ) << "calls"
+       << std::setw ( 12 ) << "s" << std::setw ( 8 ) << "%" << std::setw ( 14 ) << "ms/iteration" << "\n";
+    for ( std::size_t n = 0; n <= phases.size ( ); n++ ){
+        std::string name = n < phases.size ( ) ? phases[ n ].name : "other";
+        double seconds = n < phases.size ( ) ? phases[ n ].seconds : other;
+        long calls = n < phases.size ( ) ? phases[ n ].calls : 0;
+        os << "   " << std::left << std::setw ( 34 ) << name << std::right << std::setw ( 8 ) << calls
+           << std::setw ( 12 ) << std::setprecision ( 3 ) << seconds
+           << std::setw ( 8 ) << std::setprecision ( 1 ) << ( all > 0. ? 100. * seconds / all : 0. )
+           << std::setw ( 14 ) << std::setprecision ( 2 ) << 1000. * seconds / per << "\n";
+    }
+    if ( !counting ( ) )  return os.str ( );
+
+    // a last level cache miss loads one cache line of 64 bytes from the memory
+    os << "\n   " << std::left << std::setw ( 34 ) << "phase" << std::right << std::setw ( 12 ) << "Gcycles"
+       << std::setw ( 8 ) << "IPC" << std::setw ( 14 ) << "LLC miss %" << std::setw ( 10 ) << "GB/s" << "\n";
+    for ( std::size_t n = 0; n < phases.size ( ); n++ ){
+        const double *count = phases[ n ].counts.count;
+        os << "   " << std::left << std::setw ( 34 ) << phases[ n ].name << std::right
+           << std::setw ( 12 ) << std::setprecision ( 3 ) << 1.e-9 * count[ PerfCounters::cycles ]
+           << std::setw ( 8 ) << std::setprecision ( 2 )
+           << ( count[ PerfCounters::cycles ] > 0. ? count[ PerfCounters::instructions ] / count[ PerfCounters::cycles ] : 0. )
+           << std::setw ( 14 ) << std::setprecision ( 1 )
+           << ( count[ PerfCounters::llc_references ] > 0. ? 
+                100. * count[ PerfCounters::llc_misses ] / count[ PerfCounters::llc_references ] : 0. )
+           << std::setw ( 10 ) << std::setprecision ( 2 )
+           << ( phases[ n ].seconds > 0. ? 64.e-9 * count[ PerfCounters::llc_misses ] / phases[ n ].seconds : 0. ) << "\n";
+    }
+    return os.str ( );
+}
+
+void PhaseProfile::write_json ( const std::string &path, const std::string &model, int Ma ) const{
+    std::ofstream f ( path );
+    if ( !f.is_open ( ) ){
+        std::cerr << "ERROR: could not open the phase report " << path << "\n";
+        abort();
+    }
+    f.precision ( 9 );
+    f << "{\n  \"model\": " << json_string ( model ) << ",\n  \"Ma\": " << Ma
+      << ",\n  \"iterations\": " << iterations << ",\n  \"total_seconds\": " << total << ",\n  \"phases\": [";
+    for ( std::size_t n = 0; n < phases.size ( ); n++ ){
+        f << ( n ? ",\n" : "\n" ) << "    { \"name\": " << json_string ( phases[ n ].name )
+          << ", \"calls\": " << phases[ n ].calls << ", \"seconds\": " << phases[ n ].seconds;
+        if ( counting ( ) ){
+            const double *count = phases[ n ].counts.count;
+            f << ", \"cycles\": " << count[ PerfCounters::cycles ] << ", \"instructions\": " 
+              << count[ PerfCounters::instructions ] << ", \"llc_references\": " << count[ PerfCounters::llc_references ]
+              << ", \"llc_misses\": " << count[ PerfCounters::llc_misses ];
+        }
+        f << " }";
+    }
+    f << "\n  ]\n}\n";
+}
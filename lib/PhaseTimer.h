@@ -0,0 +1,142 @@
+/*
+ * Atmosphere General Circulation Modell ( AGCM ) applied to laminar flow
+ * Program for the computation of geo-atmospherical circulating flows in a spherical shell
+ * Finite difference scheme for the solution of the 3D Navier-Stokes equations
+ * with 2 additional transport equations to describe the water vapour and co2 concentration
+ * 4. order Runge-Kutta scheme to solve 2. order differential equations
+ *
+ * classes to measure the time spent in the phases of the iterations of a time slice
+*/
+
+#ifndef _PHASETIMER_
+#define _PHASETIMER_
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "PerfCounters.h"
+#include "TraceRecorder.h"
+
+namespace AtomUtils{
+    // the timers are built with -DATOM_PHASE_TIMERS ( make PHASE_TIMERS=1, the default ), without it a PhaseTimer
+    // does nothing and is removed by the compiler
+#ifdef ATOM_PHASE_TIMERS
+    const bool phase_timers_enabled = true;
+#else
+    const bool phase_timers_enabled = false;
+#endif
+
+    // wall time and number of calls of the named phases of the iterations in the order of their first use
+    class PhaseProfile{
+        private:
+            struct Phase{
+                std::string name;
+                double seconds;
+                long calls;
+                PerfCounters::Values counts;
+            };
+            std::vector<Phase> phases;
+            double total;
+            int iterations;
+            std::unique_ptr<PerfCounters> counters;
+
+        public:
+            PhaseProfile ( );
+
+            void reset ( );
+
+            // hardware counters of the phases, opened for each thread of the OpenMP team of the calling thread,
+            // logs why when they are not available
+            void count_hardware ( bool count );
+            bool counting ( ) const{ return counters && counters->available ( ); }
+            void read_counters ( PerfCounters::Values &values ) const{ counters->read ( values ); }
+
+            // the phases are told apart by their names, equal names from different files are one phase
+            void add ( const char *name, double seconds, const PerfCounters::Values &counts = PerfCounters::Values ( ) );
+
+            // time of the whole iterations, the part not in a phase is reported as other
+            void add_total ( double seconds ){ total += seconds; }
+            void iteration ( ){ iterations++; }
+
+            bool empty ( ) const{ return phases.empty ( ); }
+
+            // time of each phase since the last reset ( )
+            std::vector<std::pair<std::string, double> > phase_seconds ( ) const;
+
+            // table of the phases with their share of the total time and the time per iteration,
+            // with the instructions per cycle, last level cache miss rate and memory bandwidth while counting
+            std::string report ( const std::string &title ) const;
+
+            void write_json ( const std::string &path, const std::string &model, int Ma ) const;
+    };
+
+    // adds the time from its construction to its destruction to the phase name of profile,
+    // and to the timeline of the TraceRecorder while it records
+    class PhaseTimer{
+        private:
+            typedef std::chrono::steady_clock Clock;
+            PhaseProfile &profile;
+            const char *name;
+            Clock::time_point start;
+            PerfCounters::Values start_counts;
+
+        public:
+            PhaseTimer ( PhaseProfile &profile, const char *name ) :
+                profile ( profile ),
+                name ( name )
+            {
+                if ( phase_timers_enabled ){
+                    if ( profile.counting ( ) )  profile.read_counters ( start_counts );
+                    start = Clock::now ( );
+                }
+            }
+
+            ~PhaseTimer ( ){
+                if ( phase_timers_enabled ){
+                    Clock::time_point end = Clock::now ( );
+                    PerfCounters::Values end_counts;
+                    if ( profile.counting ( ) )  profile.read_counters ( end_counts );
+                    profile.add ( name, std::chrono::duration<double> ( end - start ).count ( ), end_counts - start_counts );
+                    if ( TraceRecorder::active ( ) )  TraceRecorder::complete ( name, "phase", start, end );
+                }
+            }
+
+            PhaseTimer ( const PhaseTimer& ) = delete;
+            PhaseTimer& operator= ( const PhaseTimer& ) = delete;
+    };
+
+    // times the whole iterations, counted by iteration ( ), until stop ( ) or its destruction
+    class IterationTimer{
+        private:
+            typedef std::chrono::steady_clock Clock;
+            PhaseProfile &profile;
+            Clock::time_point start;
+            bool running;
+
+        public:
+            explicit IterationTimer ( PhaseProfile &profile ) :
+                profile ( profile ),
+                running ( true )
+            {
+                if ( phase_timers_enabled )  start = Clock::now ( );
+            }
+
+            ~IterationTimer ( ){
+                stop ( );
+            }
+
+            void stop ( ){
+                if ( phase_timers_enabled && running ){
+                    profile.add_total ( std::chrono::duration<double> ( Clock::now ( ) - start ).count ( ) );
+                }
+                running = false;
+            }
+
+            IterationTimer ( const IterationTimer& ) = delete;
+            IterationTimer& operator= ( const IterationTimer& ) = delete;
+    };
+}
+#endif
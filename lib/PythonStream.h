@@ -9,7 +9,6 @@
 class PythonStream : public std::stringbuf
 {
 public:
-    static void OverrideCout();
     static bool is_enable();
 private:
     virtual int sync();
@@ -0,0 +1,98 @@
+#include <algorithm>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <sstream>
+#include <thread>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <SliceFarm.h>
+#include <Utils.h>
+
+using namespace AtomUtils;
+
+SliceFarm::SliceFarm ( int max_workers, double memory_budget_MB, std::size_t slice_memory ) :
+    max_workers ( max_workers < 1 ? 1 : max_workers )
+{
+    if ( memory_budget_MB > 0. && slice_memory > 0 ){
+        int fit = ( int ) ( memory_budget_MB * 1024. * 1024. / ( double ) slice_memory );
+        if ( fit < 1 )  fit = 1;
+        if ( fit < this->max_workers )  this->max_workers = fit;
+    }
+#ifdef _OPENMP
+    team_size = std::max ( 1, omp_get_max_threads() / this->max_workers );
+#else
+    team_size = 1;
+#endif
+}
+
+void SliceFarm::run ( const std::vector<int> &slices, const std::function<bool ( int )> &depends_on_previous,
+                      const std::function<void ( int, std::ostream& )> &compute ){
+    enum { PENDING, RUNNING, DONE };
+
+    int n = slices.size();
+    std::vector<int> state ( n, PENDING );
+    std::vector<bool> chained ( n, false );
+    std::vector<std::thread> threads ( n );
+    std::vector<std::ostringstream> printout ( n );
+    std::vector<int> finished;
+    std::exception_ptr error;
+
+    for ( int s = 1; s < n; s++ )  chained[ s ] = depends_on_previous ( slices[ s ] );
+
+    std::mutex mutex;
+    std::condition_variable slice_done;
+    int running = 0, done = 0;
+
+    std::unique_lock<std::mutex> lock ( mutex );
+    while ( done < n ){
+        // start the slices in order of time as long as workers are free, a failed slice stops further starts
+        for ( int s = 0; s < n && running < max_workers && !error; s++ ){
+            if ( state[ s ] != PENDING || ( chained[ s ] && state[ s - 1 ] != DONE ) )  continue;
+            state[ s ] = RUNNING;
+            running++;
+            threads[ s ] = std::thread ( [ &, s ] ( ){
+#ifdef _OPENMP
+                omp_set_num_threads ( team_size );
+#endif
+                std::exception_ptr slice_error;
+                try{
+                    compute ( slices[ s ], printout[ s ] );
+                }catch ( ... ){
+                    slice_error = std::current_exception ( );
+                }
+                std::lock_guard<std::mutex> guard ( mutex );
+                if ( slice_error && !error )  error = slice_error;
+                finished.push_back ( s );
+                slice_done.notify_one ( );
+            } );
+        }
+        if ( running == 0 )  break;  // nothing can be started any more after an error
+
+        slice_done.wait ( lock, [ & ] ( ){ return !finished.empty ( ); } );
+        std::vector<int> ready;
+        ready.swap ( finished );
+        lock.unlock ( );
+
+        for ( size_t l = 0; l < ready.size ( ); l++ ){
+            int s = ready[ l ];
+            threads[ s ].join ( );
+            get_output ( ) << printout[ s ].str ( ) << std::flush;
+            printout[ s ].str ( "" );
+            logger() << "time slice farm: Ma = " << slices[ s ] << " finished" << std::endl;
+        }
+
+        lock.lock ( );
+        for ( size_t l = 0; l < ready.size ( ); l++ ){
+            state[ ready[ l ] ] = DONE;
+            running--;
+            done++;
+        }
+    }
+    lock.unlock ( );
+
+    if ( error )  std::rethrow_exception ( error );
+}
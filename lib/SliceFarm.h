@@ -0,0 +1,46 @@
+/*
+ * Atmosphere General Circulation Modell ( AGCM ) applied to laminar flow
+ * Program for the computation of geo-atmospherical circulating flows in a spherical shell
+ * Finite difference scheme for the solution of the 3D Navier-Stokes equations
+ * with 2 additional transport equations to describe the water vapour and co2 concentration
+ * 4. order Runge-Kutta scheme to solve 2. order differential equations
+ *
+ * class to compute the time slices of a model run concurrently
+*/
+
+#ifndef _SLICEFARM_
+#define _SLICEFARM_
+
+#include <cstddef>
+#include <functional>
+#include <ostream>
+#include <vector>
+
+namespace AtomUtils{
+    // runs the time slices of Run() on a pool of threads, each slice on its own model instance
+    // a slice for which depends_on_previous ( Ma ) is true is started only after the preceding slice has finished,
+    // e.g. when its input is reconstructed from the results of the preceding slice
+    // at most max_workers slices and at most memory_budget / slice_memory slices run at the same time,
+    // a memory_budget <= 0 sets no limit, at least one slice always runs
+    // the OpenMP threads of the process are shared out among the workers, so that the parallel regions of the
+    // concurrent slices together use no more threads than a single slice would
+    class SliceFarm{
+        private:
+            int max_workers;
+            int team_size;
+
+        public:
+            SliceFarm ( int max_workers, double memory_budget_MB, std::size_t slice_memory );
+
+            int workers ( ) const{ return max_workers; }
+
+            // OpenMP threads of the parallel regions of each worker
+            int threads ( ) const{ return team_size; }
+
+            // compute ( Ma, out ) computes the slice Ma and writes its printout to out, the printout of a finished
+            // slice is passed on to get_output() by the calling thread, so the slices are not interleaved
+            void run ( const std::vector<int> &slices, const std::function<bool ( int )> &depends_on_previous,
+                       const std::function<void ( int, std::ostream& )> &compute );
+    };
+}
+#endif
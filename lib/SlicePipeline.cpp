@@ -0,0 +1,118 @@
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <sstream>
+#include <thread>
+#include <utility>
+
+#include <SlicePipeline.h>
+
+using namespace AtomUtils;
+
+namespace{
+    typedef std::chrono::steady_clock Clock;
+
+    double seconds_since ( const Clock::time_point &start ){
+        return std::chrono::duration<double> ( Clock::now ( ) - start ).count ( );
+    }
+}
+
+SlicePipeline::SlicePipeline ( int depth ) :
+    depth ( depth < 1 ? 1 : depth ),
+    slices_done ( 0 ),
+    wall ( 0. ),
+    atmosphere_busy ( 0. ),
+    atmosphere_blocked ( 0. ),
+    hydrosphere_busy ( 0. ),
+    hydrosphere_waiting ( 0. ),
+    queue_length_sum ( 0. )
+{}
+
+void SlicePipeline::run ( const std::vector<int> &slices,
+                          const std::function<SurfaceTransfer ( int )> &atmosphere,
+                          const std::function<void ( int, const SurfaceTransfer& )> &hydrosphere ){
+    std::deque<std::pair<int, SurfaceTransfer> > queue;
+    std::mutex mutex;
+    std::condition_variable not_full, not_empty;
+    bool atmosphere_done = false, failed = false;
+    std::exception_ptr error;
+
+    Clock::time_point start = Clock::now ( );
+
+    std::thread atmosphere_thread ( [ & ] ( ){
+        try{
+            for ( size_t s = 0; s < slices.size ( ); s++ ){
+                Clock::time_point busy = Clock::now ( );
+                SurfaceTransfer transfer = atmosphere ( slices[ s ] );
+                atmosphere_busy += seconds_since ( busy );
+
+                std::unique_lock<std::mutex> lock ( mutex );
+                Clock::time_point blocked = Clock::now ( );
+                not_full.wait ( lock, [ & ] ( ){ return ( int ) queue.size ( ) < depth || failed; } );
+                atmosphere_blocked += seconds_since ( blocked );
+                if ( failed )  break;
+
+                queue.push_back ( std::make_pair ( slices[ s ], std::move ( transfer ) ) );
+                not_empty.notify_one ( );
+            }
+        }catch ( ... ){
+            std::lock_guard<std::mutex> guard ( mutex );
+            if ( !error )  error = std::current_exception ( );
+            failed = true;
+        }
+        std::lock_guard<std::mutex> guard ( mutex );
+        atmosphere_done = true;
+        not_empty.notify_one ( );
+    } );
+
+    try{
+        while ( true ){
+            std::unique_lock<std::mutex> lock ( mutex );
+            Clock::time_point waiting = Clock::now ( );
+            not_empty.wait ( lock, [ & ] ( ){ return !queue.empty ( ) || atmosphere_done; } );
+            hydrosphere_waiting += seconds_since ( waiting );
+            if ( queue.empty ( ) || failed )  break;
+
+            queue_length_sum += queue.size ( );
+            std::pair<int, SurfaceTransfer> item = std::move ( queue.front ( ) );
+            queue.pop_front ( );
+            not_full.notify_one ( );
+            lock.unlock ( );
+
+            Clock::time_point busy = Clock::now ( );
+            hydrosphere ( item.first, item.second );
+            hydrosphere_busy += seconds_since ( busy );
+            slices_done++;
+        }
+    }catch ( ... ){
+        std::lock_guard<std::mutex> guard ( mutex );
+        if ( !error )  error = std::current_exception ( );
+        failed = true;
+        not_full.notify_one ( );
+    }
+
+    atmosphere_thread.join ( );
+    wall = seconds_since ( start );
+
+    if ( error )  std::rethrow_exception ( error );
+}
+
+std::string SlicePipeline::report ( ) const{
+    std::ostringstream os;
+    os.precision ( 1 );
+    os.setf ( std::ios::fixed );
+
+    double percent = wall > 0. ? 100. / wall : 0.;
+    os << " coupled pipeline: " << slices_done << " time slices in " << wall << " s" << std::endl
+       << "   atmosphere busy " << atmosphere_busy << " s ( " << atmosphere_busy * percent << " % ), blocked by a full queue "
+       << atmosphere_blocked << " s" << std::endl
+       << "   hydrosphere busy " << hydrosphere_busy << " s ( " << hydrosphere_busy * percent << " % ), waiting for the atmosphere "
+       << hydrosphere_waiting << " s" << std::endl;
+
+    os.precision ( 2 );
+    os << "   mean queue length " << ( slices_done > 0 ? queue_length_sum / slices_done : 0. ) << " of depth " << depth
+       << ", speedup over the alternating run " << ( wall > 0. ? ( atmosphere_busy + hydrosphere_busy ) / wall : 0. );
+    return os.str ( );
+}
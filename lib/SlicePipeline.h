@@ -0,0 +1,43 @@
+/*
+ * Atmosphere General Circulation Modell ( AGCM ) applied to laminar flow
+ * Program for the computation of geo-atmospherical circulating flows in a spherical shell
+ * Finite difference scheme for the solution of the 3D Navier-Stokes equations
+ * with 2 additional transport equations to describe the water vapour and co2 concentration
+ * 4. order Runge-Kutta scheme to solve 2. order differential equations
+ *
+ * class to compute the atmosphere and the hydrosphere of consecutive time slices at the same time
+*/
+
+#ifndef _SLICEPIPELINE_
+#define _SLICEPIPELINE_
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "SurfaceTransfer.h"
+
+namespace AtomUtils{
+    // two stage pipeline over the time slices: the atmosphere computes the slices in order on a thread of its own
+    // and hands the surface data of each slice to the hydrosphere, which computes the slices in order on the
+    // calling thread, so the ocean of slice Ma runs while the atmosphere of the next slice computes
+    // at most depth slices of surface data wait between the stages, a full queue blocks the atmosphere
+    class SlicePipeline{
+        private:
+            int depth;
+            int slices_done;
+            double wall, atmosphere_busy, atmosphere_blocked, hydrosphere_busy, hydrosphere_waiting;
+            double queue_length_sum;
+
+        public:
+            SlicePipeline ( int depth );
+
+            void run ( const std::vector<int> &slices,
+                       const std::function<SurfaceTransfer ( int )> &atmosphere,
+                       const std::function<void ( int, const SurfaceTransfer& )> &hydrosphere );
+
+            // occupancy of both stages and of the queue, in seconds of wall time
+            std::string report ( ) const;
+    };
+}
+#endif
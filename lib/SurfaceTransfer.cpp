@@ -0,0 +1,41 @@
+#include <SurfaceTransfer.h>
+
+using namespace AtomUtils;
+
+void SurfaceTransfer::store ( const std::string &bathymetry_name, int jm, int km, double u_0, Array &v, Array &w,
+                              Array &t, Array &p_dyn, Array_2D &Evaporation_Dalton, Array_2D &Precipitation ){
+    this->bathymetry_name = bathymetry_name;
+    this->jm = jm;
+    this->km = km;
+
+    std::vector<double>* fields[ ] = { &this->v, &this->w, &this->t, &this->p_dyn, &this->Evaporation_Dalton,
+                                       &this->Precipitation };
+    for ( std::vector<double> *field : fields )  field->resize ( jm * km );
+
+    for ( int j = 0; j < jm; j++ ){
+        for ( int k = 0; k < km; k++ ){
+            int n = j * km + k;
+            this->v[ n ] = v.x[ 0 ][ j ][ k ] * u_0;     // dimensional v and w values
+            this->w[ n ] = w.x[ 0 ][ j ][ k ] * u_0;
+            this->t[ n ] = t.x[ 0 ][ j ][ k ];
+            this->p_dyn[ n ] = p_dyn.x[ 0 ][ j ][ k ];
+            this->Evaporation_Dalton[ n ] = Evaporation_Dalton.y[ j ][ k ];
+            this->Precipitation[ n ] = Precipitation.y[ j ][ k ];
+        }
+    }
+}
+
+void SurfaceTransfer::load ( int im, Array &v, Array &w, Array &t, Array &p_dyn, Array_2D &Evaporation_Dalton,
+                             Array_2D &Precipitation ) const{
+    for ( int j = 0; j < jm; j++ ){
+        for ( int k = 0; k < km; k++ ){
+            int n = j * km + k;
+            v.x[ im-1 ][ j ][ k ] = this->v[ n ];
+            w.x[ im-1 ][ j ][ k ] = this->w[ n ];
+            t.x[ im-1 ][ j ][ k ] = this->t[ n ];
+            p_dyn.x[ im-1 ][ j ][ k ] = 0.;
+            Evaporation_Dalton.y[ j ][ k ] = this->Evaporation_Dalton[ n ];
+            Precipitation.y[ j ][ k ] = this->Precipitation[ n ];
+        }
+    }
+}
@@ -0,0 +1,44 @@
+/*
+ * Atmosphere General Circulation Modell ( AGCM ) applied to laminar flow
+ * Program for the computation of geo-atmospherical circulating flows in a spherical shell
+ * Finite difference scheme for the solution of the 3D Navier-Stokes equations
+ * with 2 additional transport equations to describe the water vapour and co2 concentration
+ * 4. order Runge-Kutta scheme to solve 2. order differential equations
+ *
+ * class to hand the surface fields of the atmosphere to the hydrosphere in memory
+*/
+
+#ifndef _SURFACETRANSFER_
+#define _SURFACETRANSFER_
+
+#include <string>
+#include <vector>
+
+#include "Array.h"
+#include "Array_2D.h"
+
+namespace AtomUtils{
+    // the values of the [<bathymetry>]_Transfer_Atm.vw file: dimensional v and w, dimensionless t and p_dyn
+    // at sea level, evaporation by Dalton and precipitation, stored in the order j * km + k
+    class SurfaceTransfer{
+        private:
+            std::string bathymetry_name;
+            int jm, km;
+            std::vector<double> v, w, t, p_dyn, Evaporation_Dalton, Precipitation;
+
+        public:
+            SurfaceTransfer ( ) : jm ( 0 ), km ( 0 ){}
+
+            // true if the fields belong to the time slice of the bathymetry file
+            bool is_available ( const std::string &name ) const{ return !name.empty() && name == bathymetry_name; }
+
+            // called by the atmosphere, takes the fields at i = 0
+            void store ( const std::string &bathymetry_name, int jm, int km, double u_0, Array &v, Array &w, Array &t,
+                         Array &p_dyn, Array_2D &Evaporation_Dalton, Array_2D &Precipitation );
+
+            // called by the hydrosphere, sets the fields at i = im-1, p_dyn is set to 0 as by the transfer file
+            void load ( int im, Array &v, Array &w, Array &t, Array &p_dyn, Array_2D &Evaporation_Dalton,
+                        Array_2D &Precipitation ) const;
+    };
+}
+#endif
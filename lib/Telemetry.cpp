@@ -0,0 +1,66 @@
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+
+#include <Telemetry.h>
+
+using namespace AtomUtils;
+
+void TelemetrySink::open ( const std::string &path, const std::string &model, bool append ){
+    file.open ( path.c_str ( ), append ? std::ios::app : std::ios::trunc );
+    if ( !file.is_open ( ) ){
+        std::cerr << "ERROR: could not open the telemetry file " << path << "\n";
+        abort();
+    }
+    this->model = model;
+    phases_before.clear ( );
+    last = Clock::now ( );
+}
+
+void TelemetrySink::record ( const Iteration &iteration, const std::vector<FieldChange> &changes,
+                             const PhaseProfile &profile ){
+    Clock::time_point now = Clock::now ( );
+    std::ostringstream os;
+    os << std::setprecision ( 9 );
+    os << "{\"model\": \"" << model << "\", \"Ma\": " << iteration.Ma << ", \"n\": " << iteration.n
+       << ", \"pressure_iter\": " << iteration.pressure_iter << ", \"velocity_iter\": " << iteration.velocity_iter
+       << ", \"pressure_step\": false, \"dt\": " << iteration.dt << ", \"residuum\": " << iteration.residuum << ", \"emin\": " << iteration.emin
+       << ", \"steady_change\": " << iteration.steady_change << ", \"changes\": {";
+    for ( std::size_t n = 0; n < changes.size ( ); n++ ){
+        const FieldChange &change = changes[ n ];
+        os << ( n ? ", " : "" ) << "\"" << change.name << "\": {\"max\": " << change.value << ", \"at\": ["
+           << change.i << ", " << change.j << ", " << change.k << "]}";
+    }
+    os << "}, ";
+    write_phases ( os, profile, now );
+}
+
+void TelemetrySink::record_pressure_step ( int Ma, int n, int pressure_iter, const PhaseProfile &profile ){
+    Clock::time_point now = Clock::now ( );
+    std::ostringstream os;
+    os << std::setprecision ( 9 );
+    os << "{\"model\": \"" << model << "\", \"Ma\": " << Ma << ", \"n\": " << n << ", \"pressure_iter\": "
+       << pressure_iter << ", \"pressure_step\": true, ";
+    write_phases ( os, profile, now );
+}
+
+void TelemetrySink::write_phases ( std::ostringstream &os, const PhaseProfile &profile, Clock::time_point now ){
+    os << "\"seconds\": " << std::chrono::duration<double> ( now - last ).count ( ) << ", \"phases\": {";
+
+    // the phases record their total time, the record holds the time since the last one
+    std::vector<std::pair<std::string, double> > phases = profile.phase_seconds ( );
+    bool first = true;
+    for ( std::size_t n = 0; n < phases.size ( ); n++ ){
+        double seconds = phases[ n ].second - phases_before[ phases[ n ].first ];
+        phases_before[ phases[ n ].first ] = phases[ n ].second;
+        if ( seconds <= 0. )  continue;
+        os << ( first ? "" : ", " ) << "\"" << phases[ n ].first << "\": " << seconds;
+        first = false;
+    }
+    os << "}}\n";
+
+    file << os.str ( );
+    file.flush ( );
+    last = now;
+}
@@ -0,0 +1,62 @@
+/*
+ * Atmosphere General Circulation Modell ( AGCM ) applied to laminar flow
+ * Program for the computation of geo-atmospherical circulating flows in a spherical shell
+ * Finite difference scheme for the solution of the 3D Navier-Stokes equations
+ * with 2 additional transport equations to describe the water vapour and co2 concentration
+ * 4. order Runge-Kutta scheme to solve 2. order differential equations
+ *
+ * class to record the convergence of the iterations
+*/
+
+#ifndef _TELEMETRY_
+#define _TELEMETRY_
+
+#include <chrono>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "PhaseTimer.h"
+
+namespace AtomUtils{
+    // largest change of a field between two iterations and its location
+    struct FieldChange{
+        std::string name;
+        double value;
+        int i, j, k;
+    };
+
+    // convergence telemetry of the 3D iterations of a time slice, one JSON line per iteration
+    // ( pandas.read_json ( path, lines = True ) ) with the iteration counters, the residuum, emin, the largest change of
+    // each field and its location and the time of the phases and of the whole iteration since the last record,
+    // the pressure step closing a pressure iteration gets a record of its own with "pressure_step": true
+    class TelemetrySink{
+        private:
+            typedef std::chrono::steady_clock Clock;
+            std::ofstream file;
+            std::string model;
+            std::map<std::string, double> phases_before;
+            Clock::time_point last;
+
+            // the time of each phase since the last record
+            void write_phases ( std::ostringstream &os, const PhaseProfile &profile, Clock::time_point now );
+
+        public:
+            struct Iteration{
+                int Ma, n, pressure_iter, velocity_iter;
+                double dt, residuum, emin, steady_change;
+            };
+
+            // a resumed time slice appends to the records of the interrupted run
+            void open ( const std::string &path, const std::string &model, bool append );
+            bool is_open ( ) const{ return file.is_open ( ); }
+
+            void record ( const Iteration &iteration, const std::vector<FieldChange> &changes, const PhaseProfile &profile );
+
+            // the phases after the velocity loop of pressure_iter, the pressure computation and the output files
+            void record_pressure_step ( int Ma, int n, int pressure_iter, const PhaseProfile &profile );
+    };
+}
+#endif
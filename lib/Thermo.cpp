@@ -0,0 +1,40 @@
+#include <Thermo.h>
+
+using namespace AtomUtils;
+
+const double SaturationTable::T_min = 150.;
+const double SaturationTable::T_max = 350.;
+const double SaturationTable::dT = .1;
+
+const SaturationTable AtomUtils::saturation_water ( 17.2694, 35.86 );
+const SaturationTable AtomUtils::saturation_ice ( 21.8746, 7.66 );
+const SaturationTable AtomUtils::saturation_magnus ( 17.0809, 273.15 - 234.175 );
+
+SaturationTable::SaturationTable ( double co_1, double co_2 ) :
+    co_1 ( co_1 ),
+    co_2 ( co_2 ),
+    co_d ( co_1 * ( 273.15 - co_2 ) ),
+    n_nodes ( ( int ) ( ( T_max - T_min ) / dT + .5 ) + 1 ),
+    tab ( 2 * n_nodes )
+{
+    for ( int n = 0; n < n_nodes; n++ ){
+        double T = T_min + n * dT;
+        double d = T - co_2;
+        double f = exact_E ( T );
+        tab[ 2 * n ] = f;
+        tab[ 2 * n + 1 ] = dT * f * co_d / ( d * d );  // Hermite tangent scaled by the step size
+    }
+}
+
+double SaturationTable::max_rel_error ( ) const
+{
+    double err = 0.;
+    for ( int n = 0; n < n_nodes - 1; n++ ){
+        for ( int m = 1; m < 4; m++ ){
+            double T = T_min + ( n + .25 * m ) * dT;
+            double f = exact_E ( T );
+            err = fmax ( err, fabs ( E_interp ( T ) - f ) / f );
+        }
+    }
+    return err;
+}
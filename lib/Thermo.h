@@ -0,0 +1,85 @@
+/*
+ * Atmosphere General Circulation Modell ( AGCM ) applied to laminar flow
+ * Program for the computation of geo-atmospherical circulating flows in a spherical shell
+ * Finite difference scheme for the solution of the 3D Navier-Stokes equations
+ * with 2 additional transport equations to describe the water vapour and co2 concentration
+ * 4. order Runge-Kutta scheme to solve 2. order differential equations
+ *
+ * class to tabulate the saturation water vapour pressure curves
+*/
+
+#ifndef _THERMO_
+#define _THERMO_
+
+#include <cmath>
+#include <vector>
+
+namespace AtomUtils{
+    // saturation curve f( T ) = exp ( co_1 * ( T - 273.15 ) / ( T - co_2 ) ), the same as exp_func, multiplied by hp
+    // it gives the saturation water vapour pressure in hPa
+    //
+    // f and df/dT are precomputed on a uniform grid of dT = 0.1 K between T_min = 150 K and T_max = 350 K and
+    // evaluated by cubic Hermite interpolation, the interpolation error is bounded by dT^4 / 384 * max| f'''' |,
+    // for the water, ice and Magnus curves this is a relative error below 5e-9 of the exact value
+    // ( see max_rel_error ), temperatures outside of the table range fall back to the exact formula
+    class SaturationTable{
+        private:
+            double co_1, co_2, co_d;
+            int n_nodes;
+            std::vector<double> tab;  // f and h * df/dT interleaved for each node
+
+        public:
+            static const double T_min, T_max, dT;
+
+            SaturationTable ( double co_1, double co_2 );
+
+            inline double exact_E ( double T_K ) const{
+                return exp ( co_1 * ( T_K - 273.15 ) / ( T_K - co_2 ) );
+            }
+
+            // the interpolated curve
+            inline double E_interp ( double T_K ) const{
+                double x = ( T_K - T_min ) / dT;
+                if ( !( x >= 0. && x < n_nodes - 1 ) )  return exact_E ( T_K );
+                int n = ( int ) x;
+                double s = x - n;
+                const double *p = &tab[ 2 * n ];
+                double s2 = s * s, s3 = s2 * s;
+                return p[ 0 ] * ( 2. * s3 - 3. * s2 + 1. ) + p[ 1 ] * ( s3 - 2. * s2 + s )
+                    + p[ 2 ] * ( - 2. * s3 + 3. * s2 ) + p[ 3 ] * ( s3 - s2 );
+            }
+
+            // exact evaluates the exact formula, used for validation ( parameter saturation_table_exact )
+            inline double E ( double T_K, bool exact ) const{
+                return exact ? exact_E ( T_K ) : E_interp ( T_K );
+            }
+
+            // derivative df/dT = f * co_1 * ( 273.15 - co_2 ) / ( T - co_2 )², gradient of the saturation curve in 1/K
+            inline double dE ( double T_K, bool exact ) const{
+                double d = T_K - co_2;
+                return E ( T_K, exact ) * co_d / ( d * d );
+            }
+
+            // largest relative deviation of the interpolated from the exact curve, sampled between the nodes
+            double max_rel_error ( ) const;
+    };
+
+    extern const SaturationTable saturation_water;  // water phase, co_1 = 17.2694, co_2 = 35.86
+    extern const SaturationTable saturation_ice;  // ice phase, co_1 = 21.8746, co_2 = 7.66
+    extern const SaturationTable saturation_magnus;  // water phase by Magnus, 17.0809 * t / ( 234.175 + t ), t in °C
+
+    // water vapour amount at saturation in kg/kg, E and p_h in hPa
+    inline double q_sat ( double ep, double E, double p_h ){
+        return ep * E / ( p_h - E );
+    }
+
+    // water vapour amount at saturation in kg/kg with respect to the water and the ice phase
+    inline double q_sat_water ( double ep, double hp, double T_K, double p_h, bool exact ){
+        return q_sat ( ep, hp * saturation_water.E ( T_K, exact ), p_h );
+    }
+
+    inline double q_sat_ice ( double ep, double hp, double T_K, double p_h, bool exact ){
+        return q_sat ( ep, hp * saturation_ice.E ( T_K, exact ), p_h );
+    }
+}
+#endif
@@ -0,0 +1,120 @@
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <mutex>
+
+#include <unistd.h>
+
+#include <TraceRecorder.h>
+#include <Utils.h>
+
+using namespace AtomUtils;
+
+namespace{
+    std::atomic<bool> recording ( false );
+    std::atomic<int> thread_count ( 0 );
+    std::mutex trace_mutex;
+
+    // the file is closed as a complete JSON array at the exit of the process
+    struct TraceFile{
+        std::FILE *file;
+        std::string path;
+        TraceRecorder::Clock::time_point origin;
+        bool first;
+
+        TraceFile ( ) : file ( nullptr ), first ( true ){}
+
+        ~TraceFile ( ){
+            std::lock_guard<std::mutex> guard ( trace_mutex );
+            if ( file ){
+                recording = false;
+                std::fputs ( "\n]\n", file );
+                std::fclose ( file );
+                file = nullptr;
+            }
+        }
+    };
+    TraceFile trace;
+
+    // small thread numbers instead of the thread ids are easier to read in the viewer
+    int thread_number ( ){
+        thread_local int number = ++thread_count;
+        return number;
+    }
+
+    std::string json_string ( const std::string &s ){
+        std::string quoted = "\"";
+        for ( std::size_t n = 0; n < s.size ( ); n++ ){
+            if ( s[ n ] == '"' || s[ n ] == '\\' )  quoted += '\\';
+            if ( ( unsigned char ) s[ n ] >= 0x20 )  quoted += s[ n ];
+        }
+        return quoted + "\"";
+    }
+
+    void write_event ( const std::string &event ){
+        std::fputs ( trace.first ? "\n" : ",\n", trace.file );
+        std::fputs ( event.c_str ( ), trace.file );
+        trace.first = false;
+    }
+}
+
+void TraceRecorder::open ( const std::string &path ){
+    std::lock_guard<std::mutex> guard ( trace_mutex );
+    if ( trace.file ){
+        if ( path != trace.path ){
+            logger() << "trace file " << path << " not used, the timeline is already recorded into "
+                << trace.path << std::endl;
+        }
+        return;
+    }
+    trace.file = std::fopen ( path.c_str ( ), "w" );
+    if ( !trace.file ){
+        std::cerr << "ERROR: could not open the trace file " << path << "\n";
+        abort();
+    }
+    trace.path = path;
+    trace.origin = Clock::now ( );
+    trace.first = true;
+    std::fputs ( "[", trace.file );
+    recording = true;
+}
+
+bool TraceRecorder::active ( ){
+    return recording.load ( );
+}
+
+void TraceRecorder::complete ( const char *name, const char *category, Clock::time_point start,
+                               Clock::time_point end, const char *arg_name, long arg ){
+    if ( !active ( ) )  return;
+    char times[ 96 ];
+    std::snprintf ( times, sizeof ( times ), "\"ts\": %.3f, \"dur\": %.3f, \"pid\": %d, \"tid\": %d",
+                    std::chrono::duration<double, std::micro> ( start - trace.origin ).count ( ),
+                    std::chrono::duration<double, std::micro> ( end - start ).count ( ),
+                    ( int ) getpid ( ), thread_number ( ) );
+    std::string event = "{\"name\": " + json_string ( name ) + ", \"cat\": " + json_string ( category )
+                        + ", \"ph\": \"X\", " + times;
+    if ( arg_name )  event += ", \"args\": {" + json_string ( arg_name ) + ": " + std::to_string ( arg ) + "}";
+    event += "}";
+
+    std::lock_guard<std::mutex> guard ( trace_mutex );
+    if ( trace.file )  write_event ( event );
+}
+
+void TraceRecorder::name_thread ( const std::string &name ){
+    if ( !active ( ) )  return;
+    thread_local std::string thread_name;
+    if ( name == thread_name )  return;
+    thread_name = name;
+
+    std::string event = "{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": " + std::to_string ( getpid ( ) )
+                        + ", \"tid\": " + std::to_string ( thread_number ( ) )
+                        + ", \"args\": {\"name\": " + json_string ( name ) + "}}";
+    std::lock_guard<std::mutex> guard ( trace_mutex );
+    if ( trace.file )  write_event ( event );
+}
+
+void TraceRecorder::flush ( ){
+    std::lock_guard<std::mutex> guard ( trace_mutex );
+    if ( trace.file )  std::fflush ( trace.file );
+}
@@ -0,0 +1,75 @@
+/*
+ * Atmosphere General Circulation Modell ( AGCM ) applied to laminar flow
+ * Program for the computation of geo-atmospherical circulating flows in a spherical shell
+ * Finite difference scheme for the solution of the 3D Navier-Stokes equations
+ * with 2 additional transport equations to describe the water vapour and co2 concentration
+ * 4. order Runge-Kutta scheme to solve 2. order differential equations
+ *
+ * classes to record a timeline of the computation as a Chrome trace-event file
+*/
+
+#ifndef _TRACERECORDER_
+#define _TRACERECORDER_
+
+#include <chrono>
+#include <string>
+
+namespace AtomUtils{
+    // process-wide timeline of the time slices, iterations, phases and output writing of all threads,
+    // written as Chrome trace-event JSON to be viewed in chrome://tracing or https://ui.perfetto.dev,
+    // the events are written as they end, a file cut off by a killed process can still be viewed
+    class TraceRecorder{
+        public:
+            typedef std::chrono::steady_clock Clock;
+
+            // starts the recording into path, the models of a process share one file, a second path is ignored
+            static void open ( const std::string &path );
+            static bool active ( );
+
+            // an event of the calling thread, name and category have to be string literals,
+            // arg_name and arg add one named number to the event
+            static void complete ( const char *name, const char *category, Clock::time_point start,
+                                   Clock::time_point end, const char *arg_name = nullptr, long arg = 0 );
+
+            // name of the calling thread in the timeline
+            static void name_thread ( const std::string &name );
+
+            // writes the buffered events to the file
+            static void flush ( );
+    };
+
+    // records the time from its construction to end ( ) or its destruction as an event of the calling thread
+    class TraceScope{
+        private:
+            const char *name, *category, *arg_name;
+            long arg;
+            bool running;
+            TraceRecorder::Clock::time_point start;
+
+        public:
+            TraceScope ( const char *name, const char *category, const char *arg_name = nullptr, long arg = 0 ) :
+                name ( name ),
+                category ( category ),
+                arg_name ( arg_name ),
+                arg ( arg ),
+                running ( TraceRecorder::active ( ) )
+            {
+                if ( running )  start = TraceRecorder::Clock::now ( );
+            }
+
+            ~TraceScope ( ){
+                end ( );
+            }
+
+            void end ( ){
+                if ( running ){
+                    TraceRecorder::complete ( name, category, start, TraceRecorder::Clock::now ( ), arg_name, arg );
+                }
+                running = false;
+            }
+
+            TraceScope ( const TraceScope& ) = delete;
+            TraceScope& operator= ( const TraceScope& ) = delete;
+    };
+}
+#endif
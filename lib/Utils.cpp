@@ -2,9 +2,55 @@
 
 using namespace AtomUtils;
 
-std::ofstream& AtomUtils::get_logger(){
-    static std::ofstream o("atom_log.txt", std::ofstream::out);
-    return o;
+namespace{
+    thread_local std::ostream *output_current = NULL;
+    thread_local std::ostream *log_current = NULL;
+    thread_local LogLevel level_current = LOG_INFO;
+
+    void drain ( std::ostream *stream ){
+        BufferedStreambuf *buffer = dynamic_cast<BufferedStreambuf*> ( stream->rdbuf() );
+        if ( buffer )  buffer->drain();
+        else  stream->flush();
+    }
+}
+
+std::ostream& AtomUtils::get_output(){
+    return output_current ? *output_current : std::cout;
+}
+
+std::ostream& AtomUtils::get_logger(){
+    return log_current ? *log_current : std::clog;
+}
+
+void AtomUtils::drain_streams(){
+    if ( output_current )  drain ( output_current );
+    if ( log_current )  drain ( log_current );
+}
+
+LogLevel AtomUtils::get_log_level(){
+    return level_current;
+}
+
+bool AtomUtils::log_enabled ( LogLevel level ){
+    return level <= level_current;
+}
+
+StreamScope::StreamScope ( std::ostream &output, std::ostream &log, LogLevel level ):
+    output_previous(output_current),
+    log_previous(log_current),
+    level_previous(level_current)
+{
+    output_current = &output;
+    log_current = &log;
+    level_current = level;
+}
+
+StreamScope::~StreamScope ( ){
+    if ( output_current != output_previous )  drain ( output_current );
+    if ( log_current != log_previous )  drain ( log_current );
+    output_current = output_previous;
+    log_current = log_previous;
+    level_current = level_previous;
 }
 
 HemisphereCoords AtomUtils::convert_coords(double lon, double lat){
@@ -3,11 +3,15 @@
 #include <limits>
 
 #include "Array.h"
+#include "Logger.h"
 
-#define logger() \
-if (false) ; \
+// the text of a message above the log level of the running model is not formatted
+#define log_at(level) \
+if ( !AtomUtils::log_enabled ( level ) ) ; \
 else get_logger()
 
+#define logger() log_at ( AtomUtils::LOG_INFO )
+
 namespace AtomUtils{
     using namespace std;
     struct HemisphereCoords{
@@ -17,7 +21,34 @@ namespace AtomUtils{
 
     HemisphereCoords convert_coords(double lon, double lat);
 
-    std::ofstream& get_logger();
+    // output and log stream of the model running on the calling thread, bound by a StreamScope for the duration
+    // of a model call, so that several models can run side by side, std::cout and std::clog outside of any model
+    std::ostream& get_output();
+    std::ostream& get_logger();
+
+    LogLevel get_log_level();
+
+    // whether a message of level goes to the log, by the log level of the model running on the calling thread,
+    // LOG_INFO outside of any model
+    bool log_enabled ( LogLevel level );
+
+    // drains the BufferedStreambuf of the output and the log of the model running on the calling thread,
+    // registered with Checkpoint::set_drain ( ) so that the buffered text is not lost when a signal ends the process
+    void drain_streams();
+
+    // leaving the outermost scope of a model call drains the BufferedStreambuf of its output and log
+    class StreamScope{
+        public:
+            StreamScope ( std::ostream &output, std::ostream &log, LogLevel level = LOG_INFO );
+            ~StreamScope ( );
+
+            StreamScope ( const StreamScope& ) = delete;
+            StreamScope& operator= ( const StreamScope& ) = delete;
+
+        private:
+            std::ostream *output_previous, *log_previous;
+            LogLevel level_previous;
+    };
 
     inline bool is_land(const Array& h, int i, int j, int k){
         return fabs(h.x[i][j][k] - 1) < std::numeric_limits<double>::epsilon();
@@ -60,7 +91,7 @@ namespace AtomUtils{
         if (n % 2 == 0){
             for (int i = 1; i < n; i+=2){sum_odd += 4*value[i];}
             for (int i = 2; i < n; i+=2){sum_even += 2*value[i];}
-        }else cout << "       n    must be an even number to use the Simpson integration method" << endl;
+        }else get_output() << "       n    must be an even number to use the Simpson integration method" << endl;
         return dstep/3 * (value[0] + sum_odd + sum_even + value[n]);             // Simpson Rule integration
     }
 
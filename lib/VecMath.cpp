@@ -0,0 +1,32 @@
+#include <VecMath.h>
+
+using namespace AtomUtils;
+
+int AtomUtils::checked_vm_accuracy ( int accuracy ){
+    if ( accuracy < VM_LIBM || accuracy > VM_FAST )  return VM_LIBM;
+    return accuracy;
+}
+
+void AtomUtils::vm_exp ( int n, const double *x, double *y, int vm_accuracy ){
+    if ( vm_accuracy == VM_ULP ){
+        #pragma omp simd
+        for ( int l = 0; l < n; l++ )  y[ l ] = vm_exp_poly<false> ( x[ l ] );
+    }else if ( vm_accuracy == VM_FAST ){
+        #pragma omp simd
+        for ( int l = 0; l < n; l++ )  y[ l ] = vm_exp_poly<true> ( x[ l ] );
+    }else{
+        for ( int l = 0; l < n; l++ )  y[ l ] = exp ( x[ l ] );
+    }
+}
+
+void AtomUtils::vm_pow ( int n, const double *x, double e, double *y, int vm_accuracy ){
+    if ( vm_accuracy == VM_ULP ){
+        #pragma omp simd
+        for ( int l = 0; l < n; l++ )  y[ l ] = vm_exp_poly<false> ( e * vm_log_poly<false> ( x[ l ] ) );
+    }else if ( vm_accuracy == VM_FAST ){
+        #pragma omp simd
+        for ( int l = 0; l < n; l++ )  y[ l ] = vm_exp_poly<true> ( e * vm_log_poly<true> ( x[ l ] ) );
+    }else{
+        for ( int l = 0; l < n; l++ )  y[ l ] = pow ( x[ l ], e );
+    }
+}
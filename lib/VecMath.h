@@ -0,0 +1,125 @@
+/*
+ * Atmosphere General Circulation Modell ( AGCM ) applied to laminar flow
+ * Program for the computation of geo-atmospherical circulating flows in a spherical shell
+ * Finite difference scheme for the solution of the 3D Navier-Stokes equations
+ * with 2 additional transport equations to describe the water vapour and co2 concentration
+ * 4. order Runge-Kutta scheme to solve 2. order differential equations
+ *
+ * exp, log and pow approximations of selectable accuracy for the physics hot spots
+*/
+
+#ifndef _VECMATH_
+#define _VECMATH_
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+namespace AtomUtils{
+    // accuracy levels, selected by the parameter math_accuracy of each model and passed to every call
+    // VM_LIBM: the functions of the C library
+    // VM_ULP:  polynomial approximations, exp within 2 ulp, log within 3 ulp and pow within 16 ulp ( relative error
+    //          below 4e-15 ) for | y * log ( x ) | < 10
+    // VM_FAST: shorter polynomials, relative error of exp below 1e-8, of log below 1e-9 and of pow below 2e-8
+    //          for | y * log ( x ) | < 10
+    // the approximations expect arguments in the normal range: exp is clamped to -708 <= x <= 709, log and pow need x > 0
+    enum VecMathAccuracy{ VM_LIBM = 0, VM_ULP = 1, VM_FAST = 2 };
+
+    // accuracy itself if it is one of the levels, VM_LIBM otherwise
+    int checked_vm_accuracy ( int accuracy );
+
+    // the integer conversions go through the bits of 2^52-shifted doubles, so that the loops stay vectorizable
+
+    // y * 2^n for integral -1022 <= n <= 1023
+    inline double vm_scale2 ( double y, double n ){
+        double k = n + ( 1023. + 6755399441055744. );  // the low mantissa bits hold n + 1023
+        uint64_t bits;
+        memcpy ( &bits, &k, sizeof ( bits ) );
+        bits = bits << 52;
+        double s;
+        memcpy ( &s, &bits, sizeof ( s ) );
+        return y * s;
+    }
+
+    // exp by the reduction x = n * ln2 + r, | r | <= ln2 / 2, and a Taylor polynomial of degree 13 or 7 for exp ( r )
+    template<bool fast>
+    inline double vm_exp_poly ( double x ){
+        const double shift = 6755399441055744.;  // 1.5 * 2^52, rounds to the nearest integer
+        x = x < -708. ? -708. : x;
+        x = x > 709. ? 709. : x;
+        double n = ( x * 1.4426950408889634 + shift ) - shift;
+        double r = ( x - n * 6.93147180369123816490e-01 ) - n * 1.90821492927058770002e-10;
+        double p;
+        if ( fast ){
+            p = 1. + r * ( 1. + r * ( 1. / 2. + r * ( 1. / 6. + r * ( 1. / 24. + r * ( 1. / 120. + r * ( 1. / 720.
+                + r * ( 1. / 5040. ) ) ) ) ) ) );
+        }else{
+            p = 1. + r * ( 1. + r * ( 1. / 2. + r * ( 1. / 6. + r * ( 1. / 24. + r * ( 1. / 120. + r * ( 1. / 720.
+                + r * ( 1. / 5040. + r * ( 1. / 40320. + r * ( 1. / 362880. + r * ( 1. / 3628800.
+                + r * ( 1. / 39916800. + r * ( 1. / 479001600. + r * ( 1. / 6227020800. ) ) ) ) ) ) ) ) ) ) ) ) );
+        }
+        return vm_scale2 ( p, n );
+    }
+
+    // log by the decomposition x = 2^e * m, 1/sqrt(2) <= m < sqrt(2), and the series of atanh ( ( m - 1 ) / ( m + 1 ) )
+    template<bool fast>
+    inline double vm_log_poly ( double x ){
+        uint64_t bits, e_bits;
+        memcpy ( &bits, &x, sizeof ( bits ) );
+        e_bits = ( ( bits >> 52 ) & 0x7ff ) | 0x4330000000000000ULL;  // 2^52 + biased exponent
+        bits = ( bits & 0x000fffffffffffffULL ) | 0x3ff0000000000000ULL;
+        double e, m;
+        memcpy ( &e, &e_bits, sizeof ( e ) );
+        memcpy ( &m, &bits, sizeof ( m ) );
+        e = e - ( 4503599627370496. + 1023. );
+        bool upper = m > 1.4142135623730951;
+        m = upper ? .5 * m : m;
+        e = upper ? e + 1. : e;
+        double s = ( m - 1. ) / ( m + 1. );
+        double s2 = s * s;
+        double p;
+        if ( fast ){
+            p = 1. + s2 * ( 1. / 3. + s2 * ( 1. / 5. + s2 * ( 1. / 7. + s2 * ( 1. / 9. ) ) ) );
+        }else{
+            p = 1. + s2 * ( 1. / 3. + s2 * ( 1. / 5. + s2 * ( 1. / 7. + s2 * ( 1. / 9. + s2 * ( 1. / 11.
+                + s2 * ( 1. / 13. + s2 * ( 1. / 15. + s2 * ( 1. / 17. + s2 * ( 1. / 19. + s2 * ( 1. / 21. ) ) ) ) ) ) ) ) ) );
+        }
+        return e * 6.93147180369123816490e-01 + ( 2. * s * p + e * 1.90821492927058770002e-10 );
+    }
+
+    inline double vm_exp ( double x, int vm_accuracy ){
+        if ( vm_accuracy == VM_ULP )  return vm_exp_poly<false> ( x );
+        if ( vm_accuracy == VM_FAST )  return vm_exp_poly<true> ( x );
+        return exp ( x );
+    }
+
+    inline double vm_log ( double x, int vm_accuracy ){
+        if ( vm_accuracy == VM_ULP )  return vm_log_poly<false> ( x );
+        if ( vm_accuracy == VM_FAST )  return vm_log_poly<true> ( x );
+        return log ( x );
+    }
+
+    inline double vm_pow ( double x, double y, int vm_accuracy ){
+        if ( vm_accuracy == VM_ULP )  return vm_exp_poly<false> ( y * vm_log_poly<false> ( x ) );
+        if ( vm_accuracy == VM_FAST )  return vm_exp_poly<true> ( y * vm_log_poly<true> ( x ) );
+        return pow ( x, y );
+    }
+
+    // x^4 and x^(1/4), as used by the Stefan-Boltzmann law
+    inline double vm_pow4 ( double x, int vm_accuracy ){
+        if ( vm_accuracy == VM_LIBM )  return pow ( x, 4. );
+        double x2 = x * x;
+        return x2 * x2;
+    }
+
+    inline double vm_root4 ( double x, int vm_accuracy ){
+        if ( vm_accuracy == VM_LIBM )  return pow ( x, ( 1. / 4. ) );
+        return sqrt ( sqrt ( x ) );
+    }
+
+    // array versions, y[ n ] = exp ( x[ n ] ) and y[ n ] = pow ( x[ n ], e ), executed as SIMD loops
+    void vm_exp ( int n, const double *x, double *y, int vm_accuracy );
+
+    void vm_pow ( int n, const double *x, double e, double *y, int vm_accuracy );
+}
+#endif
@@ -0,0 +1,165 @@
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+#include <zlib.h>
+
+#include <VtkWriter.h>
+
+using namespace AtomUtils;
+
+namespace{
+    // uncompressed size of the blocks zlib compresses one by one
+    const std::size_t zlib_block_size = 1 << 20;
+
+    bool little_endian ( ){
+        const std::uint16_t one = 1;
+        unsigned char first;
+        std::memcpy ( &first, &one, 1 );
+        return first == 1;
+    }
+
+    void append_uint32 ( std::vector<char> &to, std::size_t value ){
+        std::uint32_t v = ( std::uint32_t ) value;
+        const char *bytes = reinterpret_cast<const char*> ( &v );
+        to.insert ( to.end ( ), bytes, bytes + sizeof ( v ) );
+    }
+}
+
+VtkWriter::VtkWriter ( std::ofstream &f, int format, bool float64 ) :
+    f ( f ),
+    format ( format ),
+    float64 ( float64 )
+{}
+
+void VtkWriter::put ( double value ){
+    if ( float64 ){
+        const char *bytes = reinterpret_cast<const char*> ( &value );
+        block.insert ( block.end ( ), bytes, bytes + sizeof ( value ) );
+    }else{
+        float v = ( float ) value;
+        const char *bytes = reinterpret_cast<const char*> ( &v );
+        block.insert ( block.end ( ), bytes, bytes + sizeof ( v ) );
+    }
+}
+
+void VtkWriter::value ( double a ){
+    if ( is_binary ( ) )  put ( a );
+    else                  f << a << "\n";
+}
+
+void VtkWriter::value ( double a, double b, double c ){
+    if ( is_binary ( ) ){
+        put ( a );
+        put ( b );
+        put ( c );
+    }else{
+        f << a << " " << b << " " << c << "\n";
+    }
+}
+
+VtsWriter::VtsWriter ( std::ofstream &f, int format, bool float64 ) :
+    VtkWriter ( f, format, float64 )
+{}
+
+std::string VtsWriter::file_attributes ( ) const{
+    std::string attributes = little_endian ( ) ? " byte_order=\"LittleEndian\"" : " byte_order=\"BigEndian\"";
+    if ( format == ZLIB )  attributes += " compressor=\"vtkZLibDataCompressor\"";
+    return attributes;
+}
+
+void VtsWriter::begin_array ( const std::string &name, int components ){
+    f << "    <DataArray type=\"" << ( float64 ? "Float64" : "Float32" ) << "\"";
+    if ( !name.empty ( ) )  f << " Name=\"" << name << "\"";
+    if ( components > 1 )  f << " NumberOfComponents=\"" << components << "\"";
+    if ( is_binary ( ) ){
+        f << " format=\"appended\" offset=\"" << appended.size ( ) << "\"/>\n";
+    }else{
+        f << " format=\"ascii\">\n";
+    }
+    block.clear ( );
+}
+
+void VtsWriter::end_array ( ){
+    if ( !is_binary ( ) ){
+        f << "    </DataArray>\n";
+        return;
+    }
+
+    if ( format != ZLIB ){
+        // raw data, preceded by its size in bytes
+        append_uint32 ( appended, block.size ( ) );
+        appended.insert ( appended.end ( ), block.begin ( ), block.end ( ) );
+    }else{
+        // header of number of blocks, block size, size of the last block and the compressed sizes, then the blocks
+        std::size_t n_blocks = ( block.size ( ) + zlib_block_size - 1 ) / zlib_block_size;
+        std::size_t header = appended.size ( );
+        append_uint32 ( appended, n_blocks );
+        append_uint32 ( appended, zlib_block_size );
+        append_uint32 ( appended, n_blocks > 0 ? block.size ( ) - ( n_blocks - 1 ) * zlib_block_size : 0 );
+        for ( std::size_t b = 0; b < n_blocks; b++ )  append_uint32 ( appended, 0 );
+
+        std::vector<Bytef> compressed ( compressBound ( zlib_block_size ) );
+        for ( std::size_t b = 0; b < n_blocks; b++ ){
+            std::size_t begin = b * zlib_block_size;
+            std::size_t size = std::min ( zlib_block_size, block.size ( ) - begin );
+            uLongf compressed_size = compressed.size ( );
+            if ( compress2 ( compressed.data ( ), &compressed_size, reinterpret_cast<const Bytef*> ( &block[ begin ] ),
+                             size, Z_BEST_SPEED ) != Z_OK ){
+                std::cerr << "ERROR: zlib compression of a paraview data array failed " << __FILE__ << " at line "
+                          << __LINE__ << "\n";
+                abort();
+            }
+            std::uint32_t c = ( std::uint32_t ) compressed_size;
+            std::memcpy ( &appended[ header + ( 3 + b ) * sizeof ( c ) ], &c, sizeof ( c ) );
+            appended.insert ( appended.end ( ), compressed.begin ( ), compressed.begin ( ) + compressed_size );
+        }
+    }
+    block.clear ( );
+}
+
+void VtsWriter::append_data ( ){
+    if ( !is_binary ( ) )  return;
+    f << " <AppendedData encoding=\"raw\">\n_";
+    f.write ( appended.data ( ), appended.size ( ) );
+    f << "\n </AppendedData>\n";
+    appended.clear ( );
+}
+
+VtkLegacyWriter::VtkLegacyWriter ( std::ofstream &f, int format, bool float64 ) :
+    VtkWriter ( f, format, float64 )
+{}
+
+const char *VtkLegacyWriter::file_format ( ) const{
+    return is_binary ( ) ? "BINARY" : "ASCII";
+}
+
+const char *VtkLegacyWriter::data_type ( ) const{
+    return float64 ? "double" : "float";
+}
+
+void VtkLegacyWriter::points ( int n ){
+    f << "POINTS " << n << " " << data_type ( ) << "\n";
+}
+
+void VtkLegacyWriter::scalars ( const std::string &name ){
+    f << "SCALARS " << name << " " << data_type ( ) << " 1\n";
+    f << "LOOKUP_TABLE default\n";
+}
+
+void VtkLegacyWriter::vectors ( const std::string &name ){
+    f << "VECTORS " << name << " " << data_type ( ) << "\n";
+}
+
+void VtkLegacyWriter::end_values ( ){
+    if ( !is_binary ( ) )  return;
+    if ( little_endian ( ) ){
+        std::size_t width = float64 ? sizeof ( double ) : sizeof ( float );
+        for ( std::size_t b = 0; b < block.size ( ); b += width )  std::reverse ( &block[ b ], &block[ b ] + width );
+    }
+    f.write ( block.data ( ), block.size ( ) );
+    f << "\n";
+    block.clear ( );
+}
@@ -0,0 +1,81 @@
+/*
+ * Atmosphere General Circulation Modell ( AGCM ) applied to laminar flow
+ * Program for the computation of geo-atmospherical circulating flows in a spherical shell
+ * Finite difference scheme for the solution of the 3D Navier-Stokes equations
+ * with 2 additional transport equations to describe the water vapour and co2 concentration
+ * 4. order Runge-Kutta scheme to solve 2. order differential equations
+ *
+ * classes to write the data arrays of the paraview files as ascii text or binary data
+*/
+
+#ifndef _VTKWRITER_
+#define _VTKWRITER_
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace AtomUtils{
+    // format of the paraview files: 0 = ascii text, 1 = raw binary data,
+    // 2 = binary data compressed by zlib, the legacy .vtk format knows no compression and writes 2 like 1
+    // binary values are written as Float32 unless float64 is set, ascii values keep the precision of the stream
+    class VtkWriter{
+        public:
+            enum { ASCII = 0, BINARY = 1, ZLIB = 2 };
+
+        protected:
+            std::ofstream &f;
+            int format;
+            bool float64;
+            std::vector<char> block;  // binary values of the current data array
+
+            void put ( double value );
+
+        public:
+            VtkWriter ( std::ofstream &f, int format, bool float64 );
+
+            bool is_binary ( ) const{ return format != ASCII; }
+
+            // one scalar per line or one vector per line in ascii format
+            void value ( double a );
+            void value ( double a, double b, double c );
+    };
+
+    // XML StructuredGrid files ( .vts ), binary data arrays are collected in the appended data section
+    // which append_data ( ) writes between </StructuredGrid> and </VTKFile>
+    class VtsWriter : public VtkWriter{
+        private:
+            std::vector<char> appended;
+
+        public:
+            VtsWriter ( std::ofstream &f, int format, bool float64 );
+
+            // byte_order and compressor attributes of the VTKFile element
+            std::string file_attributes ( ) const;
+
+            // an empty name is used for the coordinates of the Points element
+            void begin_array ( const std::string &name, int components = 1 );
+            void end_array ( );
+
+            void append_data ( );
+    };
+
+    // legacy files ( .vtk ), binary values are big endian and follow the SCALARS, VECTORS or POINTS line directly
+    class VtkLegacyWriter : public VtkWriter{
+        public:
+            VtkLegacyWriter ( std::ofstream &f, int format, bool float64 );
+
+            // "ASCII" or "BINARY" for the header and "float" or "double" for the data lines
+            const char *file_format ( ) const;
+            const char *data_type ( ) const;
+
+            // the lines in front of the values of a section
+            void points ( int n );
+            void scalars ( const std::string &name );
+            void vectors ( const std::string &name );
+
+            // to be called after the values of each SCALARS, VECTORS or POINTS section
+            void end_values ( );
+    };
+}
+#endif
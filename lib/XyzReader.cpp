@@ -0,0 +1,167 @@
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <XyzReader.h>
+#include <Utils.h>
+
+using namespace AtomUtils;
+
+namespace{
+    const double powers_of_ten[] = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14,
+                                     1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22 };
+
+    inline bool is_blank ( char c ){ return c == ' ' || c == '\t' || c == '\r'; }
+    inline bool is_digit ( char c ){ return c >= '0' && c <= '9'; }
+
+    // parses the number at p up to end, a mantissa of at most 19 digits below 2^53 with a power of ten up to 22
+    // is converted exactly by one multiplication or division, all other numbers, nan and inf are left to strtod
+    bool parse_number ( const char *&p, const char *end, double &value ){
+        while ( p < end && is_blank ( *p ) )  p++;
+        const char *begin = p;
+
+        bool negative = false;
+        if ( p < end && ( *p == '-' || *p == '+' ) ){
+            negative = *p == '-';
+            p++;
+        }
+        std::uint64_t mantissa = 0;
+        int digits = 0, exponent = 0;
+        bool any = false, exact = true;
+        for ( ; p < end && is_digit ( *p ); p++, any = true ){
+            if ( digits < 19 ){
+                mantissa = mantissa * 10 + ( *p - '0' );
+                if ( mantissa )  digits++;
+            }else{
+                exponent++;
+                exact = false;
+            }
+        }
+        if ( p < end && *p == '.' ){
+            for ( p++; p < end && is_digit ( *p ); p++, any = true ){
+                if ( digits < 19 ){
+                    mantissa = mantissa * 10 + ( *p - '0' );
+                    if ( mantissa )  digits++;
+                    exponent--;
+                }else if ( *p != '0' ){
+                    exact = false;
+                }
+            }
+        }
+        if ( any && p < end && ( *p == 'e' || *p == 'E' ) ){
+            p++;
+            bool exponent_negative = false;
+            if ( p < end && ( *p == '-' || *p == '+' ) ){
+                exponent_negative = *p == '-';
+                p++;
+            }
+            if ( p == end || !is_digit ( *p ) )  any = false;
+            int e = 0;
+            for ( ; p < end && is_digit ( *p ); p++ ){
+                if ( e < 10000 )  e = e * 10 + ( *p - '0' );
+            }
+            exponent += exponent_negative ? -e : e;
+        }
+
+        if ( any && ( p == end || is_blank ( *p ) ) && exact && mantissa < ( std::uint64_t( 1 ) << 53 )
+             && exponent >= -22 && exponent <= 22 ){
+            value = exponent < 0 ? ( double ) mantissa / powers_of_ten[ -exponent ]
+                                 : ( double ) mantissa * powers_of_ten[ exponent ];
+            if ( negative )  value = -value;
+            return true;
+        }
+
+        // slow path
+        p = begin;
+        while ( p < end && !is_blank ( *p ) )  p++;
+        if ( p == begin )  return false;
+        std::string token ( begin, p );
+        char *token_end;
+        value = strtod ( token.c_str ( ), &token_end );
+        return token_end == token.c_str ( ) + token.size ( );
+    }
+}
+
+XyzReader::XyzReader ( const std::string &path, const std::string &description ) :
+    path ( path ),
+    data ( nullptr ),
+    end ( nullptr ),
+    pos ( nullptr ),
+    size ( 0 ),
+    line_number ( 0 ),
+    bad ( 0 )
+{
+    int fd = open ( path.c_str ( ), O_RDONLY );
+    struct stat info;
+    if ( fd < 0 || fstat ( fd, &info ) != 0 ){
+        if ( fd >= 0 )  close ( fd );
+        std::cerr << "ERROR: could not open " << description << " file at " << path << "\n";
+        abort();
+    }
+    size = info.st_size;
+    if ( size > 0 ){
+        void *map = mmap ( nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0 );
+        if ( map == MAP_FAILED ){
+            close ( fd );
+            std::cerr << "ERROR: could not map " << description << " file at " << path << "\n";
+            abort();
+        }
+        madvise ( map, size, MADV_SEQUENTIAL );
+        data = static_cast<const char*> ( map );
+    }
+    close ( fd );
+    pos = data;
+    end = data + size;
+}
+
+XyzReader::~XyzReader ( ){
+    if ( data )  munmap ( const_cast<char*> ( data ), size );
+}
+
+bool XyzReader::next ( double &x, double &y, double &z ){
+    while ( pos < end ){
+        line_number++;
+        const char *eol = static_cast<const char*> ( memchr ( pos, '\n', end - pos ) );
+        if ( !eol )  eol = end;
+        const char *p = pos;
+        pos = eol < end ? eol + 1 : end;
+
+        const char *first = p;
+        while ( first < eol && is_blank ( *first ) )  first++;
+        if ( first == eol )  continue;
+
+        if ( parse_number ( p, eol, x ) && parse_number ( p, eol, y ) && parse_number ( p, eol, z ) ){
+            while ( p < eol && is_blank ( *p ) )  p++;
+            if ( p == eol )  return true;
+        }
+        bad++;
+        logger() << "bad data in " << path << " at line " << line_number << ": " << std::string ( first, eol ) << std::endl;
+        x = y = z = NAN;
+        return true;
+    }
+    return false;
+}
+
+int XyzReader::read_grid ( int rows, int cols, double missing, std::vector<double> &z ){
+    int bad_before = bad;
+    int n = 0, n_grid = rows * cols;
+    double x, y, value;
+    z.assign ( n_grid, missing );
+    while ( next ( x, y, value ) ){
+        if ( n < n_grid && !std::isnan ( value ) )  z[ n ] = value;
+        n++;
+    }
+    if ( n != n_grid ){
+        std::cerr << "ERROR: " << path << " holds " << n << " lines instead of a grid of " << rows << " x " << cols
+                  << " lines\n";
+        abort();
+    }
+    return bad - bad_before;
+}
@@ -0,0 +1,46 @@
+/*
+ * Atmosphere General Circulation Modell ( AGCM ) applied to laminar flow
+ * Program for the computation of geo-atmospherical circulating flows in a spherical shell
+ * Finite difference scheme for the solution of the 3D Navier-Stokes equations
+ * with 2 additional transport equations to describe the water vapour and co2 concentration
+ * 4. order Runge-Kutta scheme to solve 2. order differential equations
+ *
+ * class to read the x y z lines of the .xyz input files
+*/
+
+#ifndef _XYZREADER_
+#define _XYZREADER_
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace AtomUtils{
+    // the file is memory mapped and the numbers are parsed in place, empty lines are skipped,
+    // a line which does not hold three numbers is a bad line, it is reported to the log file with its line number
+    class XyzReader{
+        private:
+            std::string path;
+            const char *data, *end, *pos;
+            std::size_t size;
+            int line_number, bad;
+
+        public:
+            // description names the file in the error message when it cannot be opened
+            XyzReader ( const std::string &path, const std::string &description );
+            ~XyzReader ( );
+
+            XyzReader ( const XyzReader& ) = delete;
+            XyzReader& operator= ( const XyzReader& ) = delete;
+
+            // the numbers of the next line, false at the end of the file, a bad line gives NaN values
+            bool next ( double &x, double &y, double &z );
+
+            // z values of a grid of rows x cols lines in the order of the lines, bad lines give the value missing,
+            // aborts when the file does not hold rows x cols lines, returns the number of bad lines
+            int read_grid ( int rows, int cols, double missing, std::vector<double> &z );
+
+            int bad_lines ( ) const{ return bad; }
+    };
+}
+#endif
@@ -13,6 +13,8 @@ def main():
             ( 'verbose', '', 'bool', False ),
             ( 'output_path', 'directory where model outputs should be placed ( must end in / )', 'string', 'output' ),
             ( 'paraview_panorama_vts','flag to control if create paraview panorama', 'bool', False),
+            ( 'vtk_format', 'format of the paraview files: 0 = ascii, 1 = binary, 2 = binary compressed by zlib ( .vts only )', 'int', 1 ),
+            ( 'vtk_float64', 'flag to write the binary paraview values in double instead of single precision', 'bool', False ),
             ( 'debug','flag to control if the program is running in debug mode', 'bool', False),
         
             #parameters for data reconstruction
@@ -26,6 +28,20 @@ def main():
             ( 'time_start', 'start time', 'int', 0 ),
             ( 'time_end', 'end time', 'int', 60 ),
             ( 'time_step', 'step size between timeslices', 'int', 5 ),
+            ( 'slice_concurrency', 'number of time slices Run() computes at the same time, each slice needs a model instance of its own', 'int', 1 ),
+            ( 'memory_budget', 'memory in MB the concurrent time slices may use, 0 means no limit', 'double', 0.0 ),
+            ( 'output_queue_depth', 'number of result snapshots the background output writer may hold while the computation continues, 0 writes the results synchronously', 'int', 1 ),
+            ( 'pipeline_depth', 'number of atmosphere time slices the coupled driver may compute ahead of the hydrosphere', 'int', 1 ),
+            ( 'restart', 'write a restart file of the 3D iterations into output_path on SIGINT or SIGTERM and resume an interrupted time slice from it', 'bool', False ),
+            ( 'restart_interval', 'number of 3D iterations between two restart files while restart is set, 0 writes it only on SIGINT or SIGTERM', 'int', 0 ),
+            ( 'phase_report', 'print the time spent in the phases of the 3D iterations after each time slice and write it to <Ma>Ma_atm_phases.json or <Ma>Ma_hyd_phases.json in output_path', 'bool', False ),
+            ( 'trace_file', 'Chrome trace-event file ( chrome://tracing, ui.perfetto.dev ) recording the timeline of the time slices, iterations, phases and output writing of all threads, empty records none', 'string', '' ),
+            ( 'memory_report', 'print the memory of the fields of the model at the start and the end of each time slice, with the high-water mark of the process', 'bool', False ),
+            ( 'perf_counters', 'count cycles, instructions and last level cache misses of the phases of the 3D iterations with perf_event_open, phase_report adds IPC, cache miss rate and memory bandwidth per phase', 'bool', False ),
+            ( 'telemetry', 'write one JSON line per 3D iteration to <Ma>Ma_atm_telemetry.jsonl or <Ma>Ma_hyd_telemetry.jsonl in output_path with the residuum, emin, the largest change of each field and its location, dt and the time of the phases', 'bool', False ),
+            ( 'paraview_output', 'write the paraview files of the radial, longitudinal and zonal sections, without them only the PlotData files are written and the fields only needed for them are not allocated', 'bool', True ),
+            ( 'log_levels', 'log level of the models, a default level and component=level pairs like info,atm=debug,hyd=warning with the components atm and hyd and the levels off, error, warning, info and debug, messages above the level are not formatted', 'string', 'info' ),
+            ( 'log_flush_interval', 'seconds between two writes of the buffered printout and log of a model to the terminal, Python or log_file, 0 writes each line at once', 'double', 1.0 ),
         ],
 
 
@@ -35,12 +51,21 @@ def main():
             ( 'velocity_iter_max', 'the number of velocity iterations', 'int', 2 ),
             ( 'pressure_iter_max', 'the number of pressure iterations', 'int', 2 ),
             ( 'checkpoint', "control when to write output files(every how many pressure iterations)", 'int', 2 ),
+            ( 'log_file', 'log file of the model, models running side by side in one process need different log files', 'string', 'atom_log.txt' ),
 
             ( 'WaterVapour', 'water vapour influence on atmospheric thermodynamics', 'double', 1.0 ),
             ( 'Buoyancy', 'buoyancy effect on the vertical velocity', 'double', 1.0 ),
             ( 'CO2', 'CO2 influence on atmospheric thermodynamics', 'double', 1.0 ),
 
             ( 'epsres', 'accuracy of relative and absolute errors', 'double', 0.00001 ),
+            ( 'math_accuracy', 'accuracy of exp, log and pow in the physics hot spots: 0 = C library, 1 = within a few ulp, 2 = fast with relative error below 2e-8', 'int', 1 ),
+            ( 'saturation_table_exact', 'evaluate the saturation water vapour pressure exactly instead of the interpolated table, for validation', 'bool', False ),
+            ( 'convergence_window', 'number of consecutive iterations the convergence criteria have to hold to terminate a time slice early, 0 runs all iterations', 'int', 0 ),
+            ( 'convergence_steady_eps', 'largest change of the flow properties between two iterations regarded as steady', 'double', 0.0001 ),
+            ( 'transfer_file', 'write the surface data for the hydrosphere into the _Transfer_Atm.vw file, not needed when the hydrosphere is coupled in memory', 'bool', True ),
+            ( 'warm_start', 'initialize a time slice from the converged flow of the previous time slice instead of the analytic profiles', 'bool', False ),
+            ( 'diagnostics_interval', 'print the extrema of the fields every diagnostics_interval 3D iterations, 0 prints none, they are searched in each iteration', 'int', 1 ),
+            ( 'diagnostics_json', 'write the extrema of the fields and their locations of each 3D iteration as one JSON line to <Ma>Ma_atm_diagnostics.jsonl in output_path', 'bool', False ),
 
             ( 'sun', 'while no variable sun position wanted', 'int', 0 ),
             ( 'NASATemperature', 'surface temperature given by NASA', 'int', 1 ),
@@ -137,6 +162,7 @@ def main():
             ( 'velocity_iter_max', 'the number of velocity iterations', 'int', 2 ),
             ( 'pressure_iter_max', 'the number of pressure iterations', 'int', 2 ),
             ( 'checkpoint', "control when to write output files(every how many pressure iterations)", 'int', 1),
+            ( 'log_file', 'log file of the model, models running side by side in one process need different log files', 'string', 'atom_hyd_log.txt' ),
 
             ( 'Buoyancy', 'buoyancy effect on the vertical velocity', 'double', 1.0 ),
 
@@ -155,6 +181,8 @@ def main():
             ( 'r_0_water', 'reference density of fresh water in kg/m3', 'double', 1000.0 ),
 
             ( 'epsres', 'accuracy for relative and absolute errors0,988571429', 'double', 0.0005 ),
+            ( 'convergence_window', 'number of consecutive iterations the convergence criteria have to hold to terminate a time slice early, 0 runs all iterations', 'int', 0 ),
+            ( 'convergence_steady_eps', 'largest change of the flow properties between two iterations regarded as steady', 'double', 0.0001 ),
 
             ( 'ua', 'initial velocity component in r-direction', 'double', 0.0 ),
             ( 'va', 'initial velocity component in theta-direction', 'double', 0.0 ),
@@ -209,6 +237,16 @@ def main():
 
                     f.write ( '  %s = %s;\n' % ( slug, rhs ) )
 
+            f.write ( "}\n\n" )
+
+            f.write ( "void %s::CopyConfig(const %s &model) {\n" % ( classname, classname ) )
+
+            for section in sections:
+                f.write ( '\n  // %s section\n' % section )
+
+                for slug, desc, ctype, default in PARAMS[section]:
+                    f.write ( '  %s = model.%s;\n' % ( slug, slug ) )
+
             f.write ( "}" )
 
 
@@ -229,60 +267,21 @@ def main():
                 for slug, desc, ctype, default in PARAMS [ section ]:
                     func_name = XML_READ_FUNCS [ ctype ]
                     f.write( '    Config::%s(%s, "%s", %s );\n' % ( func_name, element_var_name, slug, slug ) )
-                    if 'atmosphere' in filename:
-                        f.write( '  AtmParameters::{0}={0};\n'.format(slug))
-                    else:
-                        f.write( '  HydParameters::{0}={0};\n'.format(slug))
                 f.write ( "  }\n" )
 
 
-    def write_cpp_params ( filename, classname, sections ):
-        with open ( filename, 'w' ) as f:
-            f.write ( "// config files\n" )
-            f.write ( "// THIS FILE IS AUTOMATICALLY GENERATED BY param.py\n" )
-            f.write ( "// ANY CHANGES WILL BE OVERWRITTEN AT COMPILE TIME\n" )
-            f.write ( "\n" )
-
-            if classname == 'cAtmosphereModel':
-                f.write("#include\"AtmParameters.h\"\n")
-                f.write("namespace AtmParameters{\n") 
-            else:
-                f.write("#include\"HydParameters.h\"\n")
-                f.write("namespace HydParameters{\n")
-
-            for section in sections:
-                f.write ( '\n  // %s section\n' % section )
-
-                for slug, desc, ctype, default in PARAMS[section]:
-                    f.write ( '  %s %s;\n' % ( ctype, slug ) )
-            
-            f.write("}\n")
-
-    def write_cpp_headers ( filename, sections, is_extern=False ):
+    def write_cpp_headers ( filename, sections ):
         with open ( filename, 'w' ) as f:
             f.write ( "// header files\n" )
             f.write ( "// THIS FILE IS AUTOMATICALLY GENERATED BY param.py\n" )
             f.write ( "// ANY CHANGES WILL BE OVERWRITTEN AT COMPILE TIME\n" )
             f.write ( "\n" )
-            if is_extern:
-                f.write("#include<string>\n\n")
-                f.write("using namespace std;\n")
-                if 'atmosphere' in filename:
-                    f.write("namespace AtmParameters{\n")
-                else:
-                    f.write("namespace HydParameters{\n")
 
             for section in sections:
                 f.write ( '\n// %s section\n' % section )
 
                 for slug, desc, ctype, default in PARAMS [ section ]:
-                    if is_extern:
-                        f.write('   extern %s %s;\n' % ( ctype, slug ) )
-                    else:
-                        f.write('%s %s;\n' % ( ctype, slug ) )
-            
-            if is_extern:
-                f.write("}\n")
+                    f.write('%s %s;\n' % ( ctype, slug ) )
 
     def write_pxi ( input_filename, output_filename, substitutions ):
         data = open ( input_filename, 'rb' ).read()
@@ -317,7 +316,7 @@ def main():
 
 
 
-    def write_pxd ( filename, model, sections ):
+    def write_pxd ( filename, model, sections, methods ):
         with open ( filename, 'w' ) as f:
             # Sadly, Cython docs are incorrect on usage of 'include', so we must include a whole lot of boilerplate
             f.write ( """# pxd files\n""" )
@@ -331,6 +330,9 @@ cdef extern from "c%sModel.h":
         void RunTimeSlice ( int time_slice )
 """ % ( model, model, model ) )
 
+            for method in methods:
+                f.write ( '        %s\n' % method )
+
             for section in sections:
                 f.write ( '        # %s section\n' % section )
 
@@ -379,13 +381,6 @@ cdef extern from "c%sModel.h":
         write_cpp_load_config ( filename, classname, sections )
 
 
-    for filename, classname, sections in [
-        ( 'atmosphere/AtmParameters.cpp', 'cAtmosphereModel', atmosphere_sections ),
-        ( 'hydrosphere/HydParameters.cpp', 'cHydrosphereModel', hydrosphere_sections )
-    ]:
-        write_cpp_params ( filename, classname, sections )
-
-
     for filename, sections in [
         ( 'atmosphere/AtmosphereParams.h.inc', atmosphere_sections ),
         ( 'hydrosphere/HydrosphereParams.h.inc', hydrosphere_sections )
@@ -393,14 +388,6 @@ cdef extern from "c%sModel.h":
         write_cpp_headers ( filename, sections )
 
 
-    for filename, sections in [
-        ( 'atmosphere/AtmParameters.h', atmosphere_sections ), 
-        ( 'hydrosphere/HydParameters.h', hydrosphere_sections )
-    ]:
-        write_cpp_headers ( filename, sections, True )
-
-
-
     write_pxi ('python/pyatom.pyx.template', 'python/pyatom.pyx', [
         ( 'atmosphere_params', 'Atmosphere', atmosphere_sections ),
         ( 'hydrosphere_params', 'Hydrosphere', hydrosphere_sections ) ]
@@ -408,11 +395,13 @@ cdef extern from "c%sModel.h":
 
 
 
-    for filename, model, sections in [
-        ( 'python/atmosphere_pxd.pxi', 'Atmosphere', atmosphere_sections ),
-        ( 'python/hydrosphere_pxd.pxi', 'Hydrosphere', hydrosphere_sections )
+    for filename, model, sections, methods in [
+        ( 'python/atmosphere_pxd.pxi', 'Atmosphere', atmosphere_sections,
+            [ 'const SurfaceTransfer& GetSurfaceTransfer()' ] ),
+        ( 'python/hydrosphere_pxd.pxi', 'Hydrosphere', hydrosphere_sections,
+            [ 'void SetSurfaceTransfer ( const SurfaceTransfer &transfer )' ] )
     ]:
-        write_pxd ( filename, model, sections )
+        write_pxd ( filename, model, sections, methods )
 
 
     for  filename, sections in [
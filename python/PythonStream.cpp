@@ -13,12 +13,6 @@ bool PythonStream::is_enable(){
     return true;
 }
 
-void PythonStream::OverrideCout() {
-    // FIXME: leaks a PythonStream object
-    // also permanently mangles the output, but that's fine in this application
-    cout.rdbuf(new PythonStream());
-}
-
 int PythonStream::sync() {
     // call the python print function with this->str()
     PythonPrint(str().c_str());
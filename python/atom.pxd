@@ -1,6 +1,10 @@
 from libcpp cimport bool
 from libcpp.string cimport string
 
+cdef extern from "SurfaceTransfer.h" namespace "AtomUtils":
+    cppclass SurfaceTransfer:
+        pass
+
 include "atmosphere_pxd.pxi"
 
 include "hydrosphere_pxd.pxi"
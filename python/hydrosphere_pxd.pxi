@@ -0,0 +1,79 @@
+# pxd files
+# THIS FILE IS AUTOMATICALLY GENERATED BY param.py
+# ANY CHANGES WILL BE OVERWRITTEN AT COMPILE TIME
+cdef extern from "cHydrosphereModel.h":
+    cppclass cHydrosphereModel:
+        cHydrosphereModel() except +  # NB! std::bad_alloc will be converted to MemoryError
+        void LoadConfig ( const char *filename )
+        void Run()
+        void RunTimeSlice ( int time_slice )
+        void SetSurfaceTransfer ( const SurfaceTransfer &transfer )
+        # common section
+        string bathymetry_path
+        string BathymetrySuffix
+        bool verbose
+        string output_path
+        bool paraview_panorama_vts
+        int vtk_format
+        bool vtk_float64
+        bool debug
+        string temperature_file
+        string precipitation_file
+        string salinity_file
+        string temperature_curve_file
+        string reconstruction_script_path
+        bool use_earthbyte_reconstruction
+        int time_start
+        int time_end
+        int time_step
+        int slice_concurrency
+        double memory_budget
+        int output_queue_depth
+        int pipeline_depth
+        bool restart
+        int restart_interval
+        bool phase_report
+        string trace_file
+        bool memory_report
+        bool perf_counters
+        bool telemetry
+        bool paraview_output
+        string log_levels
+        double log_flush_interval
+        # hydrosphere section
+        string input_path
+        int velocity_iter_max_2D
+        int pressure_iter_max_2D
+        int velocity_iter_max
+        int pressure_iter_max
+        int checkpoint
+        string log_file
+        double Buoyancy
+        double L_hyd
+        double re
+        double sc
+        double pr
+        double g
+        double cp_w
+        double p_0
+        double t_0
+        double c_0
+        double u_0
+        double r_0_water
+        double epsres
+        int convergence_window
+        double convergence_steady_eps
+        double ua
+        double va
+        double wa
+        double pa
+        double ta
+        double ca
+        double ca_max
+        double t_cretaceous_max
+        double r0
+        double the0
+        double phi0
+        double t_average
+        double t_equator
+        double t_pole
@@ -56,6 +56,8 @@ class Model ( object ):
     def run_Model_hyd ( self, t_s ):
         self.time_slice = t_s
         print ( "\n   run_Model for the Hydrosphere code prepared for time-slice    Ma = %s\n" % ( self.time_slice ) )
+        # surface data of the atmosphere of the same time slice in memory, otherwise the transfer file is read
+        self.hyd.couple_atmosphere ( self.atm )
         self.hyd.run_time_slice( self.time_slice )
         print ( "\n    successfully terminated Hydrosphere code for time-slice    Ma = %s\n" % ( self.time_slice ) )
 
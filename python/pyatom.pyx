@@ -0,0 +1,1865 @@
+# pxi files
+# THIS FILE IS AUTOMATICALLY GENERATED BY param.py
+# ANY CHANGES WILL BE OVERWRITTEN AT COMPILE TIME
+
+import sys
+
+from atom cimport cAtmosphereModel, cHydrosphereModel
+
+from libcpp cimport bool
+from libcpp.string cimport string
+
+class Model:
+    """
+    ATOM Model Object
+    """
+    def __init__( self ):
+        self.atmosphere = Atmosphere()
+        self.hydrosphere = Hydrosphere()
+        self.output_path = ""
+        self.time_slice = 0
+        self.config_xml = ""
+
+    def run_atm ( self, t_s, output_path, cfg_xml ):
+        self.time_slice = t_s
+        self.output_path = output_path
+        self.config_xml = cfg_xml
+        print self.time_slice 
+        print self.output_path 
+        print self.config_xml 
+        self.atmosphere.load_config ( self.config_xml )
+        self.atmosphere.run_time_slice ( self.time_slice )
+
+    def run_hyd ( self, t_s, output_path, cfg_xml ):
+        self.time_slice = t_s
+        self.input_path = output_path
+        self.output_path = output_path
+        self.config_xml = cfg_xml
+        print self.time_slice 
+        print self.output_path 
+        print self.config_xml 
+        self.hydrosphere.load_config ( self.config_xml )
+        self.hydrosphere.run_time_slice ( self.time_slice )
+
+
+
+
+cdef class Atmosphere:
+    """ 
+    Cython wrapper class for C++ class Atmosphere
+    """
+    cdef:
+        cAtmosphereModel *_thisptr
+
+    def __cinit__(Atmosphere self):
+        # Initialize the "this pointer" to NULL so __dealloc__
+        # knows if there is something to deallocate. Do not 
+        # call new cAtmosphereModel() here.
+        self._thisptr = NULL
+        
+    def __init__(Atmosphere self):
+        # Constructing the C++ object might raise std::bad_alloc
+        # which is automatically converted to a Python MemoryError
+        # by Cython. We therefore need to call "new cAtmosphereModel()" in
+        # __init__ instead of __cinit__.
+        self._thisptr = new cAtmosphereModel() 
+
+    def __dealloc__(Atmosphere self):
+        # Only call del if the C++ object is alive, 
+        # or we will get a segfault.
+        if self._thisptr != NULL:
+            del self._thisptr
+            
+    cdef int _check_alive(Atmosphere self) except -1:
+        # Because of the context manager protocol, the C++ object
+        # might die before PyAtmosphere self is reclaimed.
+        # We therefore need a small utility to check for the
+        # availability of self._thisptr
+        if self._thisptr == NULL:
+            raise RuntimeError("Wrapped C++ object is deleted")
+        else:
+            return 0
+
+    def load_config(Atmosphere self, str filename):
+        self._check_alive()
+        self._thisptr.LoadConfig(filename)
+        return None
+    
+    def run(Atmosphere self):
+        self._check_alive()
+        self._thisptr.Run()
+        return None
+
+    def run_time_slice(Atmosphere self, int t):
+        self._check_alive()
+        self._thisptr.RunTimeSlice(t)
+        return None
+
+    # common section
+    property bathymetry_path:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.bathymetry_path
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.bathymetry_path = <string> value
+    
+    property BathymetrySuffix:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.BathymetrySuffix
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.BathymetrySuffix = <string> value
+    
+    property verbose:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.verbose
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.verbose = <bool> value
+    
+    property output_path:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.output_path
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.output_path = <string> value
+    
+    property paraview_panorama_vts:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.paraview_panorama_vts
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.paraview_panorama_vts = <bool> value
+    
+    property vtk_format:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.vtk_format
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.vtk_format = <int> value
+    
+    property vtk_float64:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.vtk_float64
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.vtk_float64 = <bool> value
+    
+    property debug:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.debug
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.debug = <bool> value
+    
+    property temperature_file:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.temperature_file
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.temperature_file = <string> value
+    
+    property precipitation_file:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.precipitation_file
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.precipitation_file = <string> value
+    
+    property salinity_file:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.salinity_file
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.salinity_file = <string> value
+    
+    property temperature_curve_file:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.temperature_curve_file
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.temperature_curve_file = <string> value
+    
+    property reconstruction_script_path:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.reconstruction_script_path
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.reconstruction_script_path = <string> value
+    
+    property use_earthbyte_reconstruction:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.use_earthbyte_reconstruction
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.use_earthbyte_reconstruction = <bool> value
+    
+    property time_start:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.time_start
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.time_start = <int> value
+    
+    property time_end:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.time_end
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.time_end = <int> value
+    
+    property time_step:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.time_step
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.time_step = <int> value
+    
+    property slice_concurrency:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.slice_concurrency
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.slice_concurrency = <int> value
+    
+    property memory_budget:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.memory_budget
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.memory_budget = <double> value
+    
+    property output_queue_depth:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.output_queue_depth
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.output_queue_depth = <int> value
+    
+    property pipeline_depth:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.pipeline_depth
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.pipeline_depth = <int> value
+    
+    property restart:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.restart
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.restart = <bool> value
+    
+    property restart_interval:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.restart_interval
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.restart_interval = <int> value
+    
+    property phase_report:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.phase_report
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.phase_report = <bool> value
+    
+    property trace_file:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.trace_file
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.trace_file = <string> value
+    
+    property memory_report:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.memory_report
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.memory_report = <bool> value
+    
+    property perf_counters:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.perf_counters
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.perf_counters = <bool> value
+    
+    property telemetry:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.telemetry
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.telemetry = <bool> value
+    
+    property paraview_output:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.paraview_output
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.paraview_output = <bool> value
+    
+    property log_levels:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.log_levels
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.log_levels = <string> value
+    
+    property log_flush_interval:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.log_flush_interval
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.log_flush_interval = <double> value
+    
+    # atmosphere section
+    property velocity_iter_max_2D:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.velocity_iter_max_2D
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.velocity_iter_max_2D = <int> value
+    
+    property pressure_iter_max_2D:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.pressure_iter_max_2D
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.pressure_iter_max_2D = <int> value
+    
+    property velocity_iter_max:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.velocity_iter_max
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.velocity_iter_max = <int> value
+    
+    property pressure_iter_max:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.pressure_iter_max
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.pressure_iter_max = <int> value
+    
+    property checkpoint:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.checkpoint
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.checkpoint = <int> value
+    
+    property log_file:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.log_file
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.log_file = <string> value
+    
+    property WaterVapour:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.WaterVapour
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.WaterVapour = <double> value
+    
+    property Buoyancy:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.Buoyancy
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.Buoyancy = <double> value
+    
+    property CO2:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.CO2
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.CO2 = <double> value
+    
+    property epsres:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.epsres
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.epsres = <double> value
+    
+    property math_accuracy:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.math_accuracy
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.math_accuracy = <int> value
+    
+    property saturation_table_exact:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.saturation_table_exact
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.saturation_table_exact = <bool> value
+    
+    property convergence_window:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.convergence_window
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.convergence_window = <int> value
+    
+    property convergence_steady_eps:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.convergence_steady_eps
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.convergence_steady_eps = <double> value
+    
+    property transfer_file:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.transfer_file
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.transfer_file = <bool> value
+    
+    property warm_start:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.warm_start
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.warm_start = <bool> value
+    
+    property diagnostics_interval:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.diagnostics_interval
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.diagnostics_interval = <int> value
+    
+    property diagnostics_json:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.diagnostics_json
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.diagnostics_json = <bool> value
+    
+    property sun:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.sun
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.sun = <int> value
+    
+    property NASATemperature:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.NASATemperature
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.NASATemperature = <int> value
+    
+    property RadiationModel:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.RadiationModel
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.RadiationModel = <int> value
+    
+    property declination:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.declination
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.declination = <int> value
+    
+    property sun_position_lat:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.sun_position_lat
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.sun_position_lat = <int> value
+    
+    property sun_position_lon:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.sun_position_lon
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.sun_position_lon = <int> value
+    
+    property Ma_max:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.Ma_max
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.Ma_max = <int> value
+    
+    property Ma_max_half:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.Ma_max_half
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.Ma_max_half = <int> value
+    
+    property L_atm:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.L_atm
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.L_atm = <double> value
+    
+    property tropopause_pole:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.tropopause_pole
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.tropopause_pole = <int> value
+    
+    property tropopause_equator:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.tropopause_equator
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.tropopause_equator = <int> value
+    
+    property rad_equator:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.rad_equator
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.rad_equator = <double> value
+    
+    property rad_pole:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.rad_pole
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.rad_pole = <double> value
+    
+    property sigma:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.sigma
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.sigma = <double> value
+    
+    property albedo_pole:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.albedo_pole
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.albedo_pole = <double> value
+    
+    property albedo_equator:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.albedo_equator
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.albedo_equator = <double> value
+    
+    property epsilon_equator:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.epsilon_equator
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.epsilon_equator = <double> value
+    
+    property epsilon_pole:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.epsilon_pole
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.epsilon_pole = <double> value
+    
+    property epsilon_tropopause:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.epsilon_tropopause
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.epsilon_tropopause = <double> value
+    
+    property re:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.re
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.re = <double> value
+    
+    property sc_WaterVapour:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.sc_WaterVapour
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.sc_WaterVapour = <double> value
+    
+    property sc_CO2:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.sc_CO2
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.sc_CO2 = <double> value
+    
+    property pr:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.pr
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.pr = <double> value
+    
+    property g:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.g
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.g = <double> value
+    
+    property ep:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.ep
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.ep = <double> value
+    
+    property hp:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.hp
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.hp = <double> value
+    
+    property R_Air:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.R_Air
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.R_Air = <double> value
+    
+    property r_air:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.r_air
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.r_air = <double> value
+    
+    property R_WaterVapour:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.R_WaterVapour
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.R_WaterVapour = <double> value
+    
+    property r_water_vapour:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.r_water_vapour
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.r_water_vapour = <double> value
+    
+    property R_co2:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.R_co2
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.R_co2 = <double> value
+    
+    property lv:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.lv
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.lv = <double> value
+    
+    property ls:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.ls
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.ls = <double> value
+    
+    property cp_l:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.cp_l
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.cp_l = <double> value
+    
+    property lamda:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.lamda
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.lamda = <double> value
+    
+    property r_co2:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.r_co2
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.r_co2 = <double> value
+    
+    property gam:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.gam
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.gam = <double> value
+    
+    property u_0:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.u_0
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.u_0 = <double> value
+    
+    property p_0:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.p_0
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.p_0 = <double> value
+    
+    property t_0:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.t_0
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.t_0 = <double> value
+    
+    property c_0:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.c_0
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.c_0 = <double> value
+    
+    property co2_0:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.co2_0
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.co2_0 = <double> value
+    
+    property ua:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.ua
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.ua = <double> value
+    
+    property va:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.va
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.va = <double> value
+    
+    property wa:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.wa
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.wa = <double> value
+    
+    property pa:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.pa
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.pa = <double> value
+    
+    property ca:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.ca
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.ca = <double> value
+    
+    property ta:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.ta
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.ta = <double> value
+    
+    property coa:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.coa
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.coa = <double> value
+    
+    property t_cretaceous_max:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.t_cretaceous_max
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.t_cretaceous_max = <double> value
+    
+    property t_cretaceous:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.t_cretaceous
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.t_cretaceous = <double> value
+    
+    property t_average:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.t_average
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.t_average = <double> value
+    
+    property t_equator:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.t_equator
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.t_equator = <double> value
+    
+    property t_pole:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.t_pole
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.t_pole = <double> value
+    
+    property t_tropopause:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.t_tropopause
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.t_tropopause = <double> value
+    
+    property t_land:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.t_land
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.t_land = <double> value
+    
+    property c_tropopause:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.c_tropopause
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.c_tropopause = <double> value
+    
+    property c_ocean:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.c_ocean
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.c_ocean = <double> value
+    
+    property c_land:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.c_land
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.c_land = <double> value
+    
+    property co2_average:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.co2_average
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.co2_average = <double> value
+    
+    property co2_equator:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.co2_equator
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.co2_equator = <double> value
+    
+    property co2_tropopause:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.co2_tropopause
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.co2_tropopause = <double> value
+    
+    property co2_pole:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.co2_pole
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.co2_pole = <double> value
+    
+    property co2_cretaceous:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.co2_cretaceous
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.co2_cretaceous = <double> value
+    
+    property co2_vegetation:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.co2_vegetation
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.co2_vegetation = <double> value
+    
+    property co2_ocean:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.co2_ocean
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.co2_ocean = <double> value
+    
+    property co2_land:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.co2_land
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.co2_land = <double> value
+    
+    property co2_factor:
+        def __get__(Atmosphere self ):
+            self._check_alive()
+            return self._thisptr.co2_factor
+    
+        def __set__(Atmosphere self, value ):
+            self._check_alive()
+            self._thisptr.co2_factor = <double> value
+    
+
+
+    # The context manager protocol allows us to precisely
+    # control the liftetime of the wrapped C++ object. del
+    # is called deterministically and independently of 
+    # the Python garbage collection.
+
+    def __enter__(Atmosphere self):
+        self._check_alive()
+        return self
+    
+    def __exit__(Atmosphere self, exc_tp, exc_val, exc_tb):
+        if self._thisptr != NULL:
+            del self._thisptr 
+            self._thisptr = NULL # inform __dealloc__
+        return False # propagate exceptions
+
+
+
+
+
+cdef class Hydrosphere:
+    """ 
+    Cython wrapper class for C++ class Hydrosphere
+    """
+    cdef:
+        cHydrosphereModel *_thisptr
+
+    def __cinit__(Hydrosphere self):
+        # Initialize the "this pointer" to NULL so __dealloc__
+        # knows if there is something to deallocate. Do not 
+        # call new cHydrosphereModel() here.
+        self._thisptr = NULL
+        
+    def __init__(Hydrosphere self):
+        # Constructing the C++ object might raise std::bad_alloc
+        # which is automatically converted to a Python MemoryError
+        # by Cython. We therefore need to call "new cHydrosphereModel()" in
+        # __init__ instead of __cinit__.
+        self._thisptr = new cHydrosphereModel() 
+
+    def __dealloc__(Hydrosphere self):
+        # Only call del if the C++ object is alive, 
+        # or we will get a segfault.
+        if self._thisptr != NULL:
+            del self._thisptr
+            
+    cdef int _check_alive(Hydrosphere self) except -1:
+        # Beacuse of the context manager protocol, the C++ object
+        # might die before PyHydrosphere self is reclaimed.
+        # We therefore need a small utility to check for the
+        # availability of self._thisptr
+        if self._thisptr == NULL:
+            raise RuntimeError("Wrapped C++ object is deleted")
+        else:
+            return 0
+
+
+
+    def load_config(Hydrosphere self, str filename):
+        self._check_alive()
+        self._thisptr.LoadConfig(filename)
+        return None
+    
+    def run(Hydrosphere self):
+        self._check_alive()
+        self._thisptr.Run()
+        return None
+
+    def run_time_slice(Hydrosphere self, int t):
+        self._check_alive()
+        self._thisptr.RunTimeSlice(t)
+        return None
+
+    def couple_atmosphere(Hydrosphere self, Atmosphere atm):
+        # the next time slice takes the surface data of atm instead of reading the transfer file
+        self._check_alive()
+        atm._check_alive()
+        self._thisptr.SetSurfaceTransfer(atm._thisptr.GetSurfaceTransfer())
+        return None
+
+
+
+    # common section
+    property bathymetry_path:
+        def __get__(Hydrosphere self ):
+            self._check_alive()
+            return self._thisptr.bathymetry_path
+    
+        def __set__(Hydrosphere self, value ):
+            self._check_alive()
+            self._thisptr.bathymetry_path = <string> value
+    
+    property BathymetrySuffix:
+        def __get__(Hydrosphere self ):
+            self._check_alive()
+            return self._thisptr.BathymetrySuffix
+    
+        def __set__(Hydrosphere self, value ):
+            self._check_alive()
+            self._thisptr.BathymetrySuffix = <string> value
+    
+    property verbose:
+        def __get__(Hydrosphere self ):
+            self._check_alive()
+            return self._thisptr.verbose
+    
+        def __set__(Hydrosphere self, value ):
+            self._check_alive()
+            self._thisptr.verbose = <bool> value
+    
+    property output_path:
+        def __get__(Hydrosphere self ):
+            self._check_alive()
+            return self._thisptr.output_path
+    
+        def __set__(Hydrosphere self, value ):
+            self._check_alive()
+            self._thisptr.output_path = <string> value
+    
+    property paraview_panorama_vts:
+        def __get__(Hydrosphere self ):
+            self._check_alive()
+            return self._thisptr.paraview_panorama_vts
+    
+        def __set__(Hydrosphere self, value ):
+            self._check_alive()
+            self._thisptr.paraview_panorama_vts = <bool> value
+    
+    property vtk_format:
+        def __get__(Hydrosphere self ):
+            self._check_alive()
+            return self._thisptr.vtk_format
+    
+        def __set__(Hydrosphere self, value ):
+            self._check_alive()
+            self._thisptr.vtk_format = <int> value
+    
+    property vtk_float64:
+        def __get__(Hydrosphere self ):
+            self._check_alive()
+            return self._thisptr.vtk_float64
+    
+        def __set__(Hydrosphere self, value ):
+            self._check_alive()
+            self._thisptr.vtk_float64 = <bool> value
+    
+    property debug:
+        def __get__(Hydrosphere self ):
+            self._check_alive()
+            return self._thisptr.debug
+    
+        def __set__(Hydrosphere self, value ):
+            self._check_alive()
+            self._thisptr.debug = <bool> value
+    
+    property temperature_file:
+        def __get__(Hydrosphere self ):
+            self._check_alive()
+            return self._thisptr.temperature_file
+    
+        def __set__(Hydrosphere self, value ):
+            self._check_alive()
+            self._thisptr.temperature_file = <string> value
+    
+    property precipitation_file:
+        def __get__(Hydrosphere self ):
+            self._check_alive()
+            return self._thisptr.precipitation_file
+    
+        def __set__(Hydrosphere self, value ):
+            self._check_alive()
+            self._thisptr.precipitation_file = <string> value
+    
+    property salinity_file:
+        def __get__(Hydrosphere self ):
+            self._check_alive()
+            return self._thisptr.salinity_file
+    
+        def __set__(Hydrosphere self, value ):
+            self._check_alive()
+            self._thisptr.salinity_file = <string> value
+    
+    property temperature_curve_file:
+        def __get__(Hydrosphere self ):
+            self._check_alive()
+            return self._thisptr.temperature_curve_file
+    
+        def __set__(Hydrosphere self, value ):
+            self._check_alive()
+            self._thisptr.temperature_curve_file = <string> value
+    
+    property reconstruction_script_path:
+        def __get__(Hydrosphere self ):
+            self._check_alive()
+            return self._thisptr.reconstruction_script_path
+    
+        def __set__(Hydrosphere self, value ):
+            self._check_alive()
+            self._thisptr.reconstruction_script_path = <string> value
+    
+    property use_earthbyte_reconstruction:
+        def __get__(Hydrosphere self ):
+            self._check_alive()
+            return self._thisptr.use_earthbyte_reconstruction
+    
+        def __set__(Hydrosphere self, value ):
+            self._check_alive()
+            self._thisptr.use_earthbyte_reconstruction = <bool> value
+    
+    property time_start:
+        def __get__(Hydrosphere self ):
+            self._check_alive()
+            return self._thisptr.time_start
+    
+        def __set__(Hydrosphere self, value ):
+            self._check_alive()
+            self._thisptr.time_start = <int> value
+    
+    property time_end:
+        def __get__(Hydrosphere self ):
+            self._check_alive()
+            return self._thisptr.time_end
+    
+        def __set__(Hydrosphere self, value ):
+            self._check_alive()
+            self._thisptr.time_end = <int> value
+    
+    property time_step:
+        def __get__(Hydrosphere self ):
+            self._check_alive()
+            return self._thisptr.time_step
+    
+        def __set__(Hydrosphere self, value ):
+            self._check_alive()
+            self._thisptr.time_step = <int> value
+    
+    property slice_concurrency:
+        def __get__(Hydrosphere self ):
+            self._check_alive()
+            return self._thisptr.slice_concurrency
+    
+        def __set__(Hydrosphere self, value ):
+            self._check_alive()
+            self._thisptr.slice_concurrency = <int> value
+    
+    property memory_budget:
+        def __get__(Hydrosphere self ):
+            self._check_alive()
+            return self._thisptr.memory_budget
+    
+        def __set__(Hydrosphere self, value ):
+            self._check_alive()
+            self._thisptr.memory_budget = <double> value
+    
+    property output_queue_depth:
+        def __get__(Hydrosphere self ):
+            self._check_alive()
+            return self._thisptr.output_queue_depth
+    
+        def __set__(Hydrosphere self, value ):
+            self._check_alive()
+            self._thisptr.output_queue_depth = <int> value
+    
+    property pipeline_depth:
+        def __get__(Hydrosphere self ):
+            self._check_alive()
+            return self._thisptr.pipeline_depth
+    
+        def __set__(Hydrosphere self, value ):
+            self._check_alive()
+            self._thisptr.pipeline_depth = <int> value
+    
+    property restart:
+        def __get__(Hydrosphere self ):
+            self._check_alive()
+            return self._thisptr.restart
+    
+        def __set__(Hydrosphere self, value ):
+            self._check_alive()
+            self._thisptr.restart = <bool> value
+    
+    property restart_interval:
+        def __get__(Hydrosphere self ):
+            self._check_alive()
+            return self._thisptr.restart_interval
+    
+        def __set__(Hydrosphere self, value ):
+            self._check_alive()
+            self._thisptr.restart_interval = <int> value
+    
+    property phase_report:
+        def __get__(Hydrosphere self ):
+            self._check_alive()
+            return self._thisptr.phase_report
+    
+        def __set__(Hydrosphere self, value ):
+            self._check_alive()
+            self._thisptr.phase_report = <bool> value
+    
+    property trace_file:
+        def __get__(Hydrosphere self ):
+            self._check_alive()
+            return self._thisptr.trace_file
+    
+        def __set__(Hydrosphere self, value ):
+            self._check_alive()
+            self._thisptr.trace_file = <string> value
+    
+    property memory_report:
+        def __get__(Hydrosphere self ):
+            self._check_alive()
+            return self._thisptr.memory_report
+    
+        def __set__(Hydrosphere self, value ):
+            self._check_alive()
+            self._thisptr.memory_report = <bool> value
+    
+    property perf_counters:
+        def __get__(Hydrosphere self ):
+            self._check_alive()
+            return self._thisptr.perf_counters
+    
+        def __set__(Hydrosphere self, value ):
+            self._check_alive()
+            self._thisptr.perf_counters = <bool> value
+    
+    property telemetry:
+        def __get__(Hydrosphere self ):
+            self._check_alive()
+            return self._thisptr.telemetry
+    
+        def __set__(Hydrosphere self, value ):
+            self._check_alive()
+            self._thisptr.telemetry = <bool> value
+    
+    property paraview_output:
+        def __get__(Hydrosphere self ):
+            self._check_alive()
+            return self._thisptr.paraview_output
+    
+        def __set__(Hydrosphere self, value ):
+            self._check_alive()
+            self._thisptr.paraview_output = <bool> value
+    
+    property log_levels:
+        def __get__(Hydrosphere self ):
+            self._check_alive()
+            return self._thisptr.log_levels
+    
+        def __set__(Hydrosphere self, value ):
+            self._check_alive()
+            self._thisptr.log_levels = <string> value
+    
+    property log_flush_interval:
+        def __get__(Hydrosphere self ):
+            self._check_alive()
+            return self._thisptr.log_flush_interval
+    
+        def __set__(Hydrosphere self, value ):
+            self._check_alive()
+            self._thisptr.log_flush_interval = <double> value
+    
+    # hydrosphere section
+    property input_path:
+        def __get__(Hydrosphere self ):
+            self._check_alive()
+            return self._thisptr.input_path
+    
+        def __set__(Hydrosphere self, value ):
+            self._check_alive()
+            self._thisptr.input_path = <string> value
+    
+    property velocity_iter_max_2D:
+        def __get__(Hydrosphere self ):
+            self._check_alive()
+            return self._thisptr.velocity_iter_max_2D
+    
+        def __set__(Hydrosphere self, value ):
+            self._check_alive()
+            self._thisptr.velocity_iter_max_2D = <int> value
+    
+    property pressure_iter_max_2D:
+        def __get__(Hydrosphere self ):
+            self._check_alive()
+            return self._thisptr.pressure_iter_max_2D
+    
+        def __set__(Hydrosphere self, value ):
+            self._check_alive()
+            self._thisptr.pressure_iter_max_2D = <int> value
+    
+    property velocity_iter_max:
+        def __get__(Hydrosphere self ):
+            self._check_alive()
+            return self._thisptr.velocity_iter_max
+    
+        def __set__(Hydrosphere self, value ):
+            self._check_alive()
+            self._thisptr.velocity_iter_max = <int> value
+    
+    property pressure_iter_max:
+        def __get__(Hydrosphere self ):
+            self._check_alive()
+            return self._thisptr.pressure_iter_max
+    
+        def __set__(Hydrosphere self, value ):
+            self._check_alive()
+            self._thisptr.pressure_iter_max = <int> value
+    
+    property checkpoint:
+        def __get__(Hydrosphere self ):
+            self._check_alive()
+            return self._thisptr.checkpoint
+    
+        def __set__(Hydrosphere self, value ):
+            self._check_alive()
+            self._thisptr.checkpoint = <int> value
+    
+    property log_file:
+        def __get__(Hydrosphere self ):
+            self._check_alive()
+            return self._thisptr.log_file
+    
+        def __set__(Hydrosphere self, value ):
+            self._check_alive()
+            self._thisptr.log_file = <string> value
+    
+    property Buoyancy:
+        def __get__(Hydrosphere self ):
+            self._check_alive()
+            return self._thisptr.Buoyancy
+    
+        def __set__(Hydrosphere self, value ):
+            self._check_alive()
+            self._thisptr.Buoyancy = <double> value
+    
+    property L_hyd:
+        def __get__(Hydrosphere self ):
+            self._check_alive()
+            return self._thisptr.L_hyd
+    
+        def __set__(Hydrosphere self, value ):
+            self._check_alive()
+            self._thisptr.L_hyd = <double> value
+    
+    property re:
+        def __get__(Hydrosphere self ):
+            self._check_alive()
+            return self._thisptr.re
+    
+        def __set__(Hydrosphere self, value ):
+            self._check_alive()
+            self._thisptr.re = <double> value
+    
+    property sc:
+        def __get__(Hydrosphere self ):
+            self._check_alive()
+            return self._thisptr.sc
+    
+        def __set__(Hydrosphere self, value ):
+            self._check_alive()
+            self._thisptr.sc = <double> value
+    
+    property pr:
+        def __get__(Hydrosphere self ):
+            self._check_alive()
+            return self._thisptr.pr
+    
+        def __set__(Hydrosphere self, value ):
+            self._check_alive()
+            self._thisptr.pr = <double> value
+    
+    property g:
+        def __get__(Hydrosphere self ):
+            self._check_alive()
+            return self._thisptr.g
+    
+        def __set__(Hydrosphere self, value ):
+            self._check_alive()
+            self._thisptr.g = <double> value
+    
+    property cp_w:
+        def __get__(Hydrosphere self ):
+            self._check_alive()
+            return self._thisptr.cp_w
+    
+        def __set__(Hydrosphere self, value ):
+            self._check_alive()
+            self._thisptr.cp_w = <double> value
+    
+    property p_0:
+        def __get__(Hydrosphere self ):
+            self._check_alive()
+            return self._thisptr.p_0
+    
+        def __set__(Hydrosphere self, value ):
+            self._check_alive()
+            self._thisptr.p_0 = <double> value
+    
+    property t_0:
+        def __get__(Hydrosphere self ):
+            self._check_alive()
+            return self._thisptr.t_0
+    
+        def __set__(Hydrosphere self, value ):
+            self._check_alive()
+            self._thisptr.t_0 = <double> value
+    
+    property c_0:
+        def __get__(Hydrosphere self ):
+            self._check_alive()
+            return self._thisptr.c_0
+    
+        def __set__(Hydrosphere self, value ):
+            self._check_alive()
+            self._thisptr.c_0 = <double> value
+    
+    property u_0:
+        def __get__(Hydrosphere self ):
+            self._check_alive()
+            return self._thisptr.u_0
+    
+        def __set__(Hydrosphere self, value ):
+            self._check_alive()
+            self._thisptr.u_0 = <double> value
+    
+    property r_0_water:
+        def __get__(Hydrosphere self ):
+            self._check_alive()
+            return self._thisptr.r_0_water
+    
+        def __set__(Hydrosphere self, value ):
+            self._check_alive()
+            self._thisptr.r_0_water = <double> value
+    
+    property epsres:
+        def __get__(Hydrosphere self ):
+            self._check_alive()
+            return self._thisptr.epsres
+    
+        def __set__(Hydrosphere self, value ):
+            self._check_alive()
+            self._thisptr.epsres = <double> value
+    
+    property convergence_window:
+        def __get__(Hydrosphere self ):
+            self._check_alive()
+            return self._thisptr.convergence_window
+    
+        def __set__(Hydrosphere self, value ):
+            self._check_alive()
+            self._thisptr.convergence_window = <int> value
+    
+    property convergence_steady_eps:
+        def __get__(Hydrosphere self ):
+            self._check_alive()
+            return self._thisptr.convergence_steady_eps
+    
+        def __set__(Hydrosphere self, value ):
+            self._check_alive()
+            self._thisptr.convergence_steady_eps = <double> value
+    
+    property ua:
+        def __get__(Hydrosphere self ):
+            self._check_alive()
+            return self._thisptr.ua
+    
+        def __set__(Hydrosphere self, value ):
+            self._check_alive()
+            self._thisptr.ua = <double> value
+    
+    property va:
+        def __get__(Hydrosphere self ):
+            self._check_alive()
+            return self._thisptr.va
+    
+        def __set__(Hydrosphere self, value ):
+            self._check_alive()
+            self._thisptr.va = <double> value
+    
+    property wa:
+        def __get__(Hydrosphere self ):
+            self._check_alive()
+            return self._thisptr.wa
+    
+        def __set__(Hydrosphere self, value ):
+            self._check_alive()
+            self._thisptr.wa = <double> value
+    
+    property pa:
+        def __get__(Hydrosphere self ):
+            self._check_alive()
+            return self._thisptr.pa
+    
+        def __set__(Hydrosphere self, value ):
+            self._check_alive()
+            self._thisptr.pa = <double> value
+    
+    property ta:
+        def __get__(Hydrosphere self ):
+            self._check_alive()
+            return self._thisptr.ta
+    
+        def __set__(Hydrosphere self, value ):
+            self._check_alive()
+            self._thisptr.ta = <double> value
+    
+    property ca:
+        def __get__(Hydrosphere self ):
+            self._check_alive()
+            return self._thisptr.ca
+    
+        def __set__(Hydrosphere self, value ):
+            self._check_alive()
+            self._thisptr.ca = <double> value
+    
+    property ca_max:
+        def __get__(Hydrosphere self ):
+            self._check_alive()
+            return self._thisptr.ca_max
+    
+        def __set__(Hydrosphere self, value ):
+            self._check_alive()
+            self._thisptr.ca_max = <double> value
+    
+    property t_cretaceous_max:
+        def __get__(Hydrosphere self ):
+            self._check_alive()
+            return self._thisptr.t_cretaceous_max
+    
+        def __set__(Hydrosphere self, value ):
+            self._check_alive()
+            self._thisptr.t_cretaceous_max = <double> value
+    
+    property r0:
+        def __get__(Hydrosphere self ):
+            self._check_alive()
+            return self._thisptr.r0
+    
+        def __set__(Hydrosphere self, value ):
+            self._check_alive()
+            self._thisptr.r0 = <double> value
+    
+    property the0:
+        def __get__(Hydrosphere self ):
+            self._check_alive()
+            return self._thisptr.the0
+    
+        def __set__(Hydrosphere self, value ):
+            self._check_alive()
+            self._thisptr.the0 = <double> value
+    
+    property phi0:
+        def __get__(Hydrosphere self ):
+            self._check_alive()
+            return self._thisptr.phi0
+    
+        def __set__(Hydrosphere self, value ):
+            self._check_alive()
+            self._thisptr.phi0 = <double> value
+    
+    property t_average:
+        def __get__(Hydrosphere self ):
+            self._check_alive()
+            return self._thisptr.t_average
+    
+        def __set__(Hydrosphere self, value ):
+            self._check_alive()
+            self._thisptr.t_average = <double> value
+    
+    property t_equator:
+        def __get__(Hydrosphere self ):
+            self._check_alive()
+            return self._thisptr.t_equator
+    
+        def __set__(Hydrosphere self, value ):
+            self._check_alive()
+            self._thisptr.t_equator = <double> value
+    
+    property t_pole:
+        def __get__(Hydrosphere self ):
+            self._check_alive()
+            return self._thisptr.t_pole
+    
+        def __set__(Hydrosphere self, value ):
+            self._check_alive()
+            self._thisptr.t_pole = <double> value
+    
+
+
+
+
+    # The context manager protocol allows us to precisely
+    # control the liftetime of the wrapped C++ object. del
+    # is called deterministically and independently of 
+    # the Python garbage collection.
+
+    def __enter__(Hydrosphere self):
+        self._check_alive()
+        return self
+    
+    def __exit__(Hydrosphere self, exc_tp, exc_val, exc_tb):
+        if self._thisptr != NULL:
+            del self._thisptr 
+            self._thisptr = NULL # inform __dealloc__
+        return False # propagate exceptions
+
+
+
+
+cdef public void PythonPrint(const char *s):
+    print s,
+    sys.stdout.flush()
@@ -9,8 +9,9 @@ ext_modules = [
                   'PythonStream.cpp'
               ],
               language = 'c++',
-              extra_compile_args=["-std=c++11"],
-              libraries = [ 'atom' ],
+              extra_compile_args=["-std=c++11", "-fopenmp"],
+              extra_link_args=["-fopenmp"],
+              libraries = [ 'atom', 'z' ],
               include_dirs = [ '../atmosphere', '../hydrosphere', '../lib', '../tinyxml2' ],
               library_dirs = [ '..' ]
               ) ]
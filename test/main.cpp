@@ -1,6 +1,20 @@
 #include <iostream>
+#include <cmath>
+#include <cstdio>
+#include <csignal>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <vector>
+#include <sys/wait.h>
+#include <unistd.h>
 #include "cAtmosphereModel.h"
 #include "BC_Thermo.h"
+#include "VecMath.h"
+#include "GridArchive.h"
+#include "XyzReader.h"
+
+using namespace AtomUtils;
 
 class AtomTest
 {
@@ -31,10 +45,190 @@ public:
         std::cout <<"Mean Temperature:" <<model.GetMeanTemperature() << std::endl;
         */
     }
+
+    // global means of the formulas migrated to the vector math layer compared with the C library results
+    int check_vecmath()
+    {
+        const int im = 41, jm = 181, km = 361;
+        const double g = 9.8066, R_Air = 287.1, gam = .65, sigma = 5.670280e-8, L_atm = 16000.;
+        const double exp_pressure = g / ( 1.e-2 * gam * R_Air );
+        const double tolerance[] = { 0., 1.e-13, 1.e-7 };
+        const char *name[] = { "libm", "ulp", "fast" };
+
+        double reference[ 4 ] = { 0. };
+        int failed = 0;
+        for ( int accuracy = VM_LIBM; accuracy <= VM_FAST; accuracy++ ){
+            double sum[ 4 ] = { 0. };
+            std::vector<double> ratio ( km ), p ( km );
+            for ( int i = 0; i < im; i++ ){
+                double hight = ( double ) i * ( L_atm / ( double ) ( im-1 ) );
+                for ( int j = 0; j < jm; j++ ){
+                    double lat = ( j - 90. ) / 90.;
+                    for ( int k = 0; k < km; k++ ){
+                        double t_0 = 300. - 60. * lat * lat + 5. * sin ( k * M_PI / 180. );
+                        double t_u = t_0 - gam * hight * 1.e-2;
+                        ratio[ k ] = t_u / t_0;
+                        sum[ 1 ] += sigma * vm_pow4 ( t_u, accuracy );
+                        sum[ 2 ] += vm_root4 ( sigma * vm_pow4 ( t_u, accuracy ) / sigma, accuracy );
+                        sum[ 3 ] += vm_exp ( - g * hight / ( R_Air * t_u ), accuracy );
+                    }
+                    vm_pow ( km, &ratio[ 0 ], exp_pressure, &p[ 0 ], accuracy );
+                    for ( int k = 0; k < km; k++ )  sum[ 0 ] += p[ k ];
+                }
+            }
+            for ( int n = 0; n < 4; n++ ){
+                if ( accuracy == VM_LIBM )  reference[ n ] = sum[ n ];
+                double diff = fabs ( sum[ n ] / reference[ n ] - 1. );
+                cout << "vector math " << name[ accuracy ] << ": mean " << n << " relative deviation " << diff << endl;
+                if ( diff > tolerance[ accuracy ] )  failed++;
+            }
+        }
+        return failed + check_vecmath_pointwise();
+    }
+
+    // largest relative error of exp, log and pow at single points against the bounds documented in VecMath.h,
+    // the error of log relative to max ( 1, | log ( x ) | ), pow with | y * log ( x ) | < 10
+    int check_vecmath_pointwise()
+    {
+        const double bound[] = { 0., 4.e-15, 2.e-8 };
+        const char *name[] = { "libm", "ulp", "fast" };
+        const double exponents[] = { -14., -2.5, -0.5, 0.25, 1.5, 5.26, 14. };
+
+        int failed = 0;
+        for ( int accuracy = VM_ULP; accuracy <= VM_FAST; accuracy++ ){
+            double max_error[ 3 ] = { 0. };
+            for ( int n = 0; n <= 200000; n++ ){
+                double x = -700. + 1400. * n / 200000.;
+                max_error[ 0 ] = std::max ( max_error[ 0 ], fabs ( vm_exp ( x, accuracy ) / exp ( x ) - 1. ) );
+
+                double y = pow ( 10., -300. + 600. * n / 200000. );
+                max_error[ 1 ] = std::max ( max_error[ 1 ], fabs ( vm_log ( y, accuracy ) - log ( y ) ) 
+                                                            / std::max ( 1., fabs ( log ( y ) ) ) );
+
+                double ratio = 0.5 + 1.5 * n / 200000.;
+                for ( double e : exponents ){
+                    max_error[ 2 ] = std::max ( max_error[ 2 ], fabs ( vm_pow ( ratio, e, accuracy ) / pow ( ratio, e ) - 1. ) );
+                }
+            }
+            const char *function[] = { "exp", "log", "pow" };
+            for ( int n = 0; n < 3; n++ ){
+                cout << "vector math " << name[ accuracy ] << ": " << function[ n ] << " max relative error " 
+                     << max_error[ n ] << endl;
+                if ( max_error[ n ] > bound[ accuracy ] )  failed++;
+            }
+        }
+        return failed;
+    }
+
+    // the numbers of the .xyz parser against strtod at the limits of its exact fast path, with \n and \r\n line ends,
+    // the bad lines give NaN and are counted, a grid of the wrong shape aborts
+    int check_xyz_reader()
+    {
+        const char *numbers[] = { "0", "-0", "+1.5", "0.1", "123.456", "1234567890123456789", "12345678901234567890",
+                                  "0.1234567890123456789", "0.12345678901234567891", "9007199254740991", 
+                                  "9007199254740993", "446673754019253275e-7", "1961.9769415762462", "1e22", "1e-22", "1e23", "3e23", "1e-23", "4.5e22", "4.5e-22", 
+                                  "123456789e-22", "000000000000000000000000123.5", "0.000000000000000000000000125", 
+                                  "1E+5", "-2.5e-3", ".5", "5.", "nan", "inf", "-inf", "1.7976931348623157e308", 
+                                  "4.9e-324" };
+        const char *bad[] = { "-", "+", "1e", "1e+", "1.2.3", "12abc", "." };
+        const int n_numbers = sizeof ( numbers ) / sizeof ( numbers[ 0 ] ), n_bad = sizeof ( bad ) / sizeof ( bad[ 0 ] );
+
+        char file_name[] = "/tmp/atom_xyz_XXXXXX";
+        int fd = mkstemp ( file_name );
+        if ( fd < 0 )  return 1;
+        close ( fd );
+        {
+            std::ofstream ofile ( file_name, std::ios::binary );
+            for ( int n = 0; n < n_numbers; n++ ){
+                ofile << " -180\t" << n << "  " << numbers[ n ] << ( n % 2 ? "\r\n" : "\n" );
+            }
+            for ( int n = 0; n < n_bad; n++ )  ofile << "-180 90 " << bad[ n ] << "\r\n";
+            ofile << "\n-179 90 1.25 extra\n-179 91 2.5";
+        }
+
+        int failed = 0;
+        {
+            XyzReader reader ( file_name, "test xyz" );
+            double x, y, z;
+            for ( int n = 0; n < n_numbers; n++ ){
+                double expected = strtod ( numbers[ n ], nullptr );
+                if ( !reader.next ( x, y, z ) || x != -180. || y != n
+                     || !( std::isnan ( expected ) ? std::isnan ( z ) 
+                                                    : std::memcmp ( &z, &expected, sizeof ( z ) ) == 0 ) ){
+                    cout << "xyz reader: " << numbers[ n ] << " read as " << z << endl;
+                    failed++;
+                }
+            }
+            for ( int n = 0; n < n_bad + 1; n++ ){
+                if ( !reader.next ( x, y, z ) || !std::isnan ( x ) || !std::isnan ( y ) || !std::isnan ( z ) ){
+                    cout << "xyz reader: bad line " << n << " not read as NaN" << endl;
+                    failed++;
+                }
+            }
+            if ( !reader.next ( x, y, z ) || z != 2.5 || reader.next ( x, y, z ) )  failed++;
+            if ( reader.bad_lines() != n_bad + 1 )  failed++;
+        }
+
+        std::vector<double> grid;
+        if ( XyzReader ( file_name, "test xyz" ).read_grid ( 1, n_numbers + n_bad + 2, -1., grid ) != n_bad + 1
+             || grid[ n_numbers ] != -1. || grid.back() != 2.5 )  failed++;
+
+        //  a grid of another number of lines aborts
+        pid_t child = fork();
+        if ( child == 0 ){
+            std::freopen ( "/dev/null", "w", stderr );
+            XyzReader ( file_name, "test xyz" ).read_grid ( 2, 2, -1., grid );
+            _exit ( 0 );
+        }
+        int status = 0;
+        if ( child < 0 || waitpid ( child, &status, 0 ) != child || !WIFSIGNALED ( status ) 
+             || WTERMSIG ( status ) != SIGABRT )  failed++;
+
+        cout << "xyz reader: " << failed << " failed checks" << endl;
+        std::remove ( file_name );
+        return failed;
+    }
+
+    // a grid read from the archive has the values of the text file, and a changed text file is read again
+    int check_grid_archive()
+    {
+        char directory[] = "/tmp/atom_grids_XXXXXX";
+        if ( !mkdtemp ( directory ) )  return 1;
+        std::string path = std::string ( directory ) + "/grid.xyz";
+        {
+            std::ofstream ofile ( path );
+            ofile << "-180 90 0.1\n-179 90 -1234.5678\n-180 89 3.14159265358979\n-179 89 bad line\n";
+        }
+
+        int failed = 0;
+        std::vector<double> text, archived;
+        XyzReader ( path, "test grid" ).read_grid ( 2, 2, NAN, text );
+        GridArchive::round ( text );
+        if ( GridArchive::build ( directory ) != 1 || !GridArchive::read ( path, 2, 2, archived ) )  failed++;
+        else{
+            for ( int n = 0; n < 4; n++ ){
+                if ( !( text[ n ] == archived[ n ] || ( std::isnan ( text[ n ] ) && std::isnan ( archived[ n ] ) ) ) )  failed++;
+            }
+        }
+        if ( GridArchive::read ( path, 4, 1, archived ) )  failed++;
+
+        {
+            std::ofstream ofile ( path, std::ios::app );
+            ofile << "\n";
+        }
+        if ( GridArchive::read ( path, 2, 2, archived ) )  failed++;
+
+        cout << "grid archive: " << failed << " failed checks" << endl;
+        std::remove ( path.c_str() );
+        std::remove ( ( std::string ( directory ) + "/" + GridArchive::file_name ).c_str() );
+        rmdir ( directory );
+        return failed;
+    }
 };
 
 int main(int argc, char **argv) {
     AtomTest test;
     test.run();
+    return test.check_vecmath() + test.check_xyz_reader() + test.check_grid_archive();
 }
 